@@ -22,6 +22,7 @@
 
 // C/C++ include files
 #include <list>
+#include <mutex>
 #include <set>
 
 /// Namespace for the AIDA detector description toolkit
@@ -60,6 +61,8 @@ namespace dd4hep {
       ConditionsManager m_mgr;
       /// Property: input data source definitions
       Sources           m_sources;
+      /// Serializes the loader invocations of concurrently prepared conditions slices
+      std::mutex        m_lock;
 
     protected:
       /// Queue update to manager.
@@ -76,6 +79,8 @@ namespace dd4hep {
       virtual void initialize()    {}
       /// Access conditions manager
       ConditionsManager manager() const  {  return m_mgr; }
+      /// Access the lock to be held while invoking the loader from concurrent threads
+      std::mutex& lock()                 {  return m_lock; }
       /// Access to properties
       Property& operator[](const std::string& property_name);
       /// Access to properties (CONST)
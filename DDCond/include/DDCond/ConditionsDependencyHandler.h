@@ -19,6 +19,14 @@
 #include "DDCond/ConditionsPool.h"
 #include "DDCond/ConditionsManager.h"
 
+// C/C++ include files
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
 
@@ -44,6 +52,18 @@ namespace dd4hep {
      *  ConditionResolver interface in order to allow for upgrades of
      *  this implementation which might not be polymorph.
      *
+     *  If the conditions manager property "ComputeThreads" is bigger than 1,
+     *  the declared dependencies are sorted into levels, where every item
+     *  only depends on items of lower levels. The items of one level are
+     *  computed concurrently in the first pass and resolved concurrently in
+     *  the second pass, so that the handler state seen by the callbacks is
+     *  the same as for the sequential processing. Insertions by the callbacks
+     *  are serialized. Accesses to conditions not declared
+     *  as dependency are resolved on demand. The callbacks must then be
+     *  thread safe. The result does not depend on the number of threads.
+     *  Circular accesses between threads are reported like the ones
+     *  of the sequential processing.
+     *
      *  \author  M.Frank
      *  \version 1.0
      */
@@ -65,6 +85,10 @@ namespace dd4hep {
         int                        callstack = 0;
         /// Current conversion state of the item
         State                      state     = INVALID;
+        /// Parallel processing: item is being processed by the worker thread
+        bool                       busy      = false;
+        /// Parallel processing: thread processing the item
+        std::thread::id            worker;
       public:
         /// Inhibit default constructor
         Work() = delete;
@@ -103,15 +127,33 @@ namespace dd4hep {
       State                       m_state = CREATED;
       /// Current block work item
       Work*                       m_block = 0;
-      /// Current item of the block
-      Work*                       m_currentWork = 0;
+      /// Number of threads to compute the derived conditions
+      size_t                      m_numThreads = 1;
+      /// Flag if the work items are processed concurrently
+      bool                        m_parallel = false;
+      /// Parallel processing: protection of the work item states
+      std::mutex                  m_lock;
+      /// Parallel processing: signal completion of work items
+      std::condition_variable     m_done;
+      /// Parallel processing: work items the threads are waiting for
+      std::map<std::thread::id, const Work*> m_waiting;
+      /// Parallel processing: work items sorted into dependency levels
+      std::vector<std::vector<Work*> > m_levels;
     public:
       /// Number of callbacks to the handler for monitoring
-      mutable size_t              num_callback;
+      mutable std::atomic<size_t> num_callback;
 
     protected:
       /// Internal call to trigger update callback
       void do_callback(Work* dep);
+      /// Parallel processing: compute and optionally resolve one item unless done or in work by another thread
+      void do_process(Work* dep, bool resolve);
+      /// Parallel processing: process all levels with the worker threads
+      void process_levels(bool resolve);
+      /// Parallel processing: check if the worker of a busy item (indirectly) waits for the given thread
+      bool waits_for(const Work* work, std::thread::id thread)  const;
+      /// Sort the work items into levels according to the declared dependencies
+      bool build_levels(std::vector<std::vector<Work*> >& levels)  const;
 
     public:
       /// Initializing constructor
@@ -18,7 +18,11 @@
 
 // C/C++ include files
 #include <map>
+#include <mutex>
+#include <atomic>
 #include <memory>
+#include <vector>
+#include <shared_mutex>
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -31,6 +35,17 @@ namespace dd4hep {
      *  Purely internal class to the conditions manager implementation.
      *  Not at all to be accessed by clients!
      *
+     *  Thread safety: the selection functions take the pool lock in shared mode
+     *  and may be invoked concurrently. The conditions manager takes the lock
+     *  exclusively when registering IOVs or conditions and when cleaning the pool.
+     *  Direct access to the elements is not protected.
+     *
+     *  The selections use an index over the IOV keys of the elements. It is
+     *  rebuilt on demand after new pools were added with insert(). Elements
+     *  may only be added using insert() and removed using clean().
+     *  The age of the pools is accounted lazily: the age_value of the pools
+     *  is brought up to date when cleaning.
+     *
      *  \author  M.Frank
      *  \version 1.0
      *  \ingroup DD4HEP_CONDITIONS
@@ -42,16 +57,79 @@ namespace dd4hep {
       /// Shortcut name for the actual conditions container
       typedef std::map<IOV::Key, Element >    Elements;      
 
+      /// Sorted endpoint index over the IOV keys of the elements
+      /**
+       *  The entries are ordered by the lower IOV edge like the elements map.
+       *  A binary tree over the entries holds the maximum upper edge of every
+       *  subrange, a permutation orders the entries by the upper IOV edge.
+       *  Containment and overlap queries take O(log(N) + number of matches).
+       *  Matches are reported in the order of the elements map.
+       *
+       *  \author  M.Frank
+       *  \version 1.0
+       *  \ingroup DD4HEP_CONDITIONS
+       */
+      class Index  {
+      public:
+        typedef IOV::Key_value_type key_type;
+        /// Map entries ordered by the lower IOV edge
+        std::vector<const Elements::value_type*> entries;
+        /// Entry indices ordered by the upper IOV edge
+        std::vector<size_t>                      byUpper;
+        /// Maximum upper IOV edge of every tree node
+        std::vector<key_type>                    maxUpper;
+        /// Age clock value when the entry was selected the last time
+        std::unique_ptr<std::atomic<long>[]>     stamps;
+
+      protected:
+        /// Fill the tree nodes
+        void build_tree(size_t node, size_t lo, size_t hi);
+        /// Collect all entries [0,end) with an upper IOV edge of at least min_upper
+        void collect(size_t node, size_t lo, size_t hi, size_t end,
+                     key_type min_upper, std::vector<size_t>& result)  const;
+
+      public:
+        /// (Re-)build the index from the elements
+        void build(const Elements& elements, long clock);
+        /// Remove all entries
+        void clear();
+        /// Entries with a key containing the test range
+        void containing(const IOV::Key& test, std::vector<size_t>& result)  const;
+        /// Entries with a lower or upper IOV edge within the test range
+        void overlapping(const IOV::Key& test, std::vector<size_t>& result)  const;
+      };
+
       /// Container of IOV dependent conditions pools
       Elements elements;     //! Not ROOT persistent
       /// Reference to the IOV container
       const IOVType* type;   //! Not ROOT persistent
+      /// Reader/writer lock protecting the elements and the content of the pools
+      mutable std::shared_timed_mutex lock; //! Not ROOT persistent
+      /// Serializes the computation of derived conditions registered to this pool
+      std::mutex     computeLock;           //! Not ROOT persistent
+
+    protected:
+      /// Selection index over the elements
+      Index             m_index;            //! Not ROOT persistent
+      /// Flag if the index reflects the elements
+      std::atomic<bool> m_indexValid {false}; //! Not ROOT persistent
+      /// Protection to rebuild the index under the shared lock
+      std::mutex        m_indexLock;        //! Not ROOT persistent
+      /// Number of age accounting selections
+      std::atomic<long> m_ageClock {0};     //! Not ROOT persistent
+
+      /// Access the index. Rebuilt if the elements were modified
+      const Index& i_index();
+      /// Bring the age_value of all indexed pools up to date
+      void i_updateAges();
       
     public:
       /// Default constructor
       ConditionsIOVPool(const IOVType* type);
       /// Default destructor
       virtual ~ConditionsIOVPool();
+      /// Add a new conditions pool. The caller must hold the lock exclusively
+      bool insert(const IOV::Key& key, Element pool);
       /// Retrieve  a condition set given the key according to their validity
       size_t select(Condition::key_type key, const IOV& req_validity, RangeConditions& result);
       /// Retrieve  a condition set given the key according to their validity
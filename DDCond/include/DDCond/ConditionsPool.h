@@ -19,6 +19,7 @@
 #include "DDCond/ConditionsManager.h"
 
 // C/C++ include files
+#include <atomic>
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -63,8 +64,8 @@ namespace dd4hep {
       };
       /// The IOV of the conditions hosted
       IOV* iov;
-      /// Aging value
-      int  age_value;
+      /// Aging value. Updated by concurrent selections
+      std::atomic<int> age_value;
 
     public:
       /// Listener invocation when a condition is registered to the cache
@@ -137,6 +137,7 @@ namespace dd4hep {
       virtual ConditionsIOVPool* iovPool(const IOVType& type)  const  final;
 
       /// Register new condition with the conditions store. Unlocked version, not multi-threaded
+      /** Only the IOV pool is locked against concurrent conditions selections  */
       virtual bool registerUnlocked(ConditionsPool& pool, Condition cond)  final;
 
       /// Register a whole block of conditions with identical IOV.
@@ -18,10 +18,134 @@
 #include "DD4hep/Printout.h"
 #include "TTimeStamp.h"
 
+// C/C++ include files
+#include <algorithm>
+#include <exception>
+#include <functional>
+
 using namespace dd4hep;
 using namespace dd4hep::cond;
 
 namespace {
+  /// Work item currently processed by this thread
+  thread_local ConditionsDependencyHandler::Work* s_currentWork = nullptr;
+
+  /// Helper to reset the current work item of the thread and to restore it on scope exit
+  struct CurrentWork  {
+    ConditionsDependencyHandler::Work* previous;
+    CurrentWork() : previous(s_currentWork)  {  s_currentWork = nullptr;   }
+    ~CurrentWork()                           {  s_currentWork = previous;  }
+  };
+
+  /// Report a non resolvable circular dependency of a work item
+  void recursion_error(const ConditionsDependencyHandler::Work* work)   {
+    except("DependencyHandler",
+           "++ Handler caught in infinite recursion loop. Key:%s %c%s%c",
+           work->context.dependency->target.toString().c_str(),
+#if defined(DD4HEP_CONDITIONS_DEBUG)
+           '[',work->context.dependency->detector.path().c_str(),']'
+#else
+           ' ',"",' '
+#endif
+           );
+  }
+
+  /// Pool of worker threads processing the dependency levels one after the other
+  /**
+   *  The threads are started once and are reused for every level.
+   *  The calling thread participates in the processing of each level.
+   */
+  class LevelWorkers  {
+    typedef ConditionsDependencyHandler::Work  Work;
+    typedef std::vector<Work*>                 Items;
+    std::function<void(Work*)> m_process;
+    std::vector<std::thread>   m_threads;
+    std::mutex                 m_lock;
+    std::condition_variable    m_wakeup;
+    std::condition_variable    m_finished;
+    const Items*               m_items      = nullptr;
+    std::atomic<size_t>        m_next       { 0 };
+    size_t                     m_generation = 0;
+    size_t                     m_running    = 0;
+    bool                       m_stop       = false;
+    std::exception_ptr         m_error;
+
+    /// Process items of the current level until there are no more
+    void work()   {
+      try  {
+        for( size_t i = m_next++; i < m_items->size(); i = m_next++ )
+          m_process((*m_items)[i]);
+      }
+      catch(...)   {
+        std::lock_guard<std::mutex> lock(m_lock);
+        if ( !m_error ) m_error = std::current_exception();
+      }
+    }
+    /// Thread body: wait for the next level and process it
+    void run()   {
+      size_t seen = 0;
+      std::unique_lock<std::mutex> lock(m_lock);
+      while ( true )   {
+        m_wakeup.wait(lock, [this, &seen] { return m_stop || m_generation != seen; });
+        if ( m_stop ) return;
+        seen = m_generation;
+        lock.unlock();
+        work();
+        lock.lock();
+        if ( --m_running == 0 ) m_finished.notify_all();
+      }
+    }
+    /// Stop and join all threads
+    void shutdown()   {
+      {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_stop = true;
+      }
+      m_wakeup.notify_all();
+      for( auto& t : m_threads )
+        if ( t.joinable() ) t.join();
+      m_threads.clear();
+    }
+  public:
+    /// Initializing constructor: start the additional worker threads
+    LevelWorkers(size_t num_threads, std::function<void(Work*)> proc)
+      : m_process(std::move(proc))
+    {
+      try  {
+        for( size_t i = 0; i < num_threads; ++i )
+          m_threads.emplace_back(&LevelWorkers::run, this);
+      }
+      catch(...)   {
+        shutdown();
+        throw;
+      }
+    }
+    /// Default destructor
+    ~LevelWorkers()   {
+      shutdown();
+    }
+    /// Process all items of one level. The first exception is rethrown.
+    void process(const Items& items)   {
+      {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_items   = &items;
+        m_next    = 0;
+        m_running = m_threads.size();
+        ++m_generation;
+      }
+      m_wakeup.notify_all();
+      work();
+      std::unique_lock<std::mutex> lock(m_lock);
+      m_finished.wait(lock, [this] { return m_running == 0; });
+      m_items = nullptr;
+      if ( m_error )  {
+        std::exception_ptr error = m_error;
+        m_error = nullptr;
+        std::rethrow_exception(error);
+      }
+    }
+  };
+
   std::string dependency_name(const ConditionDependency* d)  {
 #if defined(DD4HEP_CONDITIONS_HAVE_NAME)
     return d->target.name;
@@ -76,6 +200,7 @@ ConditionsDependencyHandler::ConditionsDependencyHandler(ConditionsManager   mgr
     p += sizeof(Work);
   }
   m_iovType = iov.iovType;
+  m_numThreads = size_t(std::max(m_manager->computeThreads(), 1));
 }
 
 /// Default destructor
@@ -92,7 +217,15 @@ Detector& ConditionsDependencyHandler::detectorDescription() const  {
 
 /// 1rst pass: Compute/create the missing conditions
 void ConditionsDependencyHandler::compute()   {
+  CurrentWork current;
   m_state = CREATED;
+  if ( m_numThreads > 1 && m_todo.size() > 1 && build_levels(m_levels) )   {
+    // Items are computed level by level: all declared
+    // dependencies of an item are computed before the item is processed.
+    m_parallel = true;
+    process_levels(false);
+    return;
+  }
   for( const auto& i : m_todo )   {
     if ( !i.second->condition )  {
       do_callback(i.second);
@@ -113,12 +246,16 @@ void ConditionsDependencyHandler::resolve()    {
   std::map<IOV::Key,std::vector<Condition> > work_pools;
   Work* w;
 
+  CurrentWork current;
   m_state = RESOLVED;
+  if ( m_parallel )   {
+    process_levels(true);
+  }
   for( const auto& c : m_todo )   {
     w = c.second;
-    m_currentWork = w;
+    s_currentWork = w;
     if ( w->state != RESOLVED )   {
-      w->resolve(m_currentWork);
+      w->resolve(s_currentWork);
     }
     ++num_resolved;
     // Fill an empty map of condition vectors for the block inserts
@@ -160,11 +297,15 @@ void ConditionsDependencyHandler::resolve()    {
 
 /// Interface to handle multi-condition inserts by callbacks: One single insert
 bool ConditionsDependencyHandler::registerOne(const IOV& iov, Condition cond)    {
+  std::unique_lock<std::mutex> lock(m_lock, std::defer_lock);
+  if ( m_parallel ) lock.lock();
   return m_pool.registerOne(iov, cond);
 }
 
 /// Handle multi-condition inserts by callbacks: block insertions of conditions with identical IOV
 size_t ConditionsDependencyHandler::registerMany(const IOV& iov, const std::vector<Condition>& values)   {
+  std::unique_lock<std::mutex> lock(m_lock, std::defer_lock);
+  if ( m_parallel ) lock.lock();
   return m_pool.registerMany(iov, values);
 }
 
@@ -187,8 +328,11 @@ std::vector<Condition> ConditionsDependencyHandler::getByItem(Condition::itemkey
       }
     };
     item_selector proc(key);
+    std::unique_lock<std::mutex> lock(m_lock, std::defer_lock);
+    if ( m_parallel ) lock.lock();
     m_pool.scan(conditionsProcessor(proc));
-    for (auto c : proc.conditions ) m_currentWork->do_intersection(c->iov);
+    if ( m_parallel ) lock.unlock();
+    for (auto c : proc.conditions ) s_currentWork->do_intersection(c->iov);
     return proc.conditions;
   }
   except("DependencyHandler",
@@ -201,8 +345,11 @@ std::vector<Condition> ConditionsDependencyHandler::get(Condition::detkey_type d
   if ( m_state == RESOLVED )   {
     ConditionKey::KeyMaker lower(det_key, Condition::FIRST_ITEM_KEY);
     ConditionKey::KeyMaker upper(det_key, Condition::LAST_ITEM_KEY);
+    std::unique_lock<std::mutex> lock(m_lock, std::defer_lock);
+    if ( m_parallel ) lock.lock();
     std::vector<Condition> conditions = m_pool.get(lower.hash, upper.hash);
-    for (auto c : conditions ) m_currentWork->do_intersection(c->iov);
+    if ( m_parallel ) lock.unlock();
+    for (auto c : conditions ) s_currentWork->do_intersection(c->iov);
     return conditions;
   }
   except("DependencyHandler",
@@ -221,26 +368,38 @@ Condition ConditionsDependencyHandler::get(Condition::key_type key,
                                            bool throw_if_not)
 {
   /// If we are not already resolving here, we follow the normal procedure
+  std::unique_lock<std::mutex> lock(m_lock, std::defer_lock);
+  if ( m_parallel ) lock.lock();
   Condition c = m_pool.get(key);
+  if ( m_parallel ) lock.unlock();
   if ( c.isValid() )  {
-    m_currentWork->do_intersection(c->iov);
+    s_currentWork->do_intersection(c->iov);
     return c;
   }
   auto i = m_todo.find(key);
   if ( i != m_todo.end() )   {
     Work* w = i->second;
-    if ( w->state == RESOLVED )   {
+    if ( m_parallel )   {
+      // Like the sequential processing: accessed items are computed and resolved
+      do_process(w, true);
+      s_currentWork->do_intersection(w->iov);
+      return w->condition;
+    }
+    else if ( w->state == RESOLVED )   {
+      s_currentWork->do_intersection(w->iov);
       return w->condition;
     }
     else if ( w->state == CREATED )   {
-      return w->resolve(m_currentWork);
+      return w->resolve(s_currentWork);
     }
     else if ( w->state == INVALID )  {
       do_callback(w);
-      if ( w->condition && w->state == RESOLVED ) // cross-dependencies...
+      if ( w->condition && w->state == RESOLVED )  { // cross-dependencies...
+        s_currentWork->do_intersection(w->iov);
         return w->condition;
+      }
       else if ( w->condition )
-        return w->resolve(m_currentWork);
+        return w->resolve(s_currentWork);
     }
   }
   if ( throw_if_not )  {
@@ -287,27 +446,19 @@ Condition ConditionsDependencyHandler::get(Condition::key_type key,
 void ConditionsDependencyHandler::do_callback(Work* work)   {
   const ConditionDependency* dep = work->context.dependency;
   try  {
-    Work* previous  = m_currentWork;
-    m_currentWork   = work;
+    Work* previous  = s_currentWork;
+    s_currentWork   = work;
     if ( work->callstack > 0 )   {
       // if we end up here it means a previous construction call never finished
       // because the bugger tried to access another condition, which in turn
       // during the construction tries to access this one.
       // ---> Classic dead-lock
-      except("DependencyHandler",
-             "++ Handler caught in infinite recursion loop. Key:%s %c%s%c",
-             work->context.dependency->target.toString().c_str(),
-#if defined(DD4HEP_CONDITIONS_DEBUG)
-             '[',work->context.dependency->detector.path().c_str(),']'
-#else
-             ' ',"",' '
-#endif
-             );
+      recursion_error(work);
     }
     ++work->callstack;
     work->condition = (*dep->callback)(dep->target, work->context).ptr();
     --work->callstack;
-    m_currentWork   = previous;
+    s_currentWork   = previous;
     if ( work->condition )  {
       if ( !work->iov )  {
         work->_iov = IOV(m_iovType,IOV::Key(IOV::MIN_KEY, IOV::MAX_KEY));
@@ -352,3 +503,107 @@ void ConditionsDependencyHandler::do_callback(Work* work)   {
          "++ Exception while creating dependent Condition %s.",
          dependency_name(dep).c_str());
 }
+
+/// Parallel processing: process all levels with the worker threads
+void ConditionsDependencyHandler::process_levels(bool resolve)   {
+  size_t max_level = 0;
+  for( const auto& level : m_levels )
+    max_level = std::max(max_level, level.size());
+  LevelWorkers workers(std::min(m_numThreads, max_level) - 1,
+                       [this, resolve](Work* w) { do_process(w, resolve); });
+  for( const auto& level : m_levels )
+    workers.process(level);
+}
+
+/// Parallel processing: compute and optionally resolve one item unless done or in work by another thread
+void ConditionsDependencyHandler::do_process(Work* work, bool resolve)   {
+  {
+    std::thread::id self = std::this_thread::get_id();
+    std::unique_lock<std::mutex> lock(m_lock);
+    while ( work->busy )   {
+      // Waiting for an item, which (indirectly) waits for this thread: dead-lock
+      if ( waits_for(work, self) )   {
+        recursion_error(work);
+      }
+      m_waiting[self] = work;
+      m_done.wait(lock);
+      m_waiting.erase(self);
+    }
+    if ( work->state == RESOLVED || (!resolve && work->condition) )  {
+      return;
+    }
+    work->busy   = true;
+    work->worker = std::this_thread::get_id();
+  }
+  try  {
+    if ( !work->condition )  {
+      do_callback(work);
+    }
+    if ( resolve )   {
+      Work* previous = s_currentWork;
+      s_currentWork  = work;
+      work->resolve(s_currentWork);
+      s_currentWork  = previous;
+    }
+  }
+  catch(...)   {
+    std::lock_guard<std::mutex> lock(m_lock);
+    work->busy = false;
+    m_done.notify_all();
+    throw;
+  }
+  std::lock_guard<std::mutex> lock(m_lock);
+  work->busy = false;
+  m_done.notify_all();
+}
+
+/// Parallel processing: check if the worker of a busy item (indirectly) waits for the given thread
+bool ConditionsDependencyHandler::waits_for(const Work* work, std::thread::id thread)  const  {
+  // Follow the chain of threads waiting for busy items. The caller holds the lock.
+  for( size_t n = 0; work && work->busy && n <= m_waiting.size(); ++n )   {
+    if ( work->worker == thread )
+      return true;
+    auto i = m_waiting.find(work->worker);
+    work = i == m_waiting.end() ? nullptr : i->second;
+  }
+  return false;
+}
+
+/// Sort the work items into levels according to the declared dependencies
+bool ConditionsDependencyHandler::build_levels(std::vector<std::vector<Work*> >& levels)  const  {
+  std::map<const Work*, std::vector<Work*> > users;
+  std::map<const Work*, size_t> pending;
+  std::vector<Work*> level;
+  size_t num_items = 0;
+  for( const auto& t : m_todo )   {
+    Work*  w = t.second;
+    size_t n = 0;
+    for( const auto& d : w->context.dependency->dependencies )   {
+      auto j = m_todo.find(d.hash);
+      if ( j != m_todo.end() && j->second != w )   {
+        users[j->second].emplace_back(w);
+        ++n;
+      }
+    }
+    pending[w] = n;
+    if ( n == 0 ) level.emplace_back(w);
+  }
+  while ( !level.empty() )   {
+    std::vector<Work*> next;
+    for( Work* w : level )   {
+      auto u = users.find(w);
+      if ( u != users.end() )   {
+        for( Work* d : u->second )
+          if ( --pending[d] == 0 ) next.emplace_back(d);
+      }
+    }
+    // Keep the key order within a level: the processing order is reproducible
+    std::sort(next.begin(), next.end(), [](const Work* a, const Work* b)  {
+        return a->context.dependency->target.hash < b->context.dependency->target.hash;  });
+    num_items += level.size();
+    levels.emplace_back(std::move(level));
+    level = std::move(next);
+  }
+  // Circular dependencies: leave it to the sequential processing to report them
+  return num_items == m_todo.size();
+}
@@ -20,9 +20,17 @@
 
 #include "DD4hep/detail/ConditionsInterna.h"
 
+// C/C++ include files
+#include <algorithm>
+
 using namespace dd4hep;
 using namespace dd4hep::cond;
 
+namespace {
+  typedef std::shared_lock<std::shared_timed_mutex> read_lock_t;
+  typedef std::unique_lock<std::shared_timed_mutex> write_lock_t;
+}
+
 /// Default constructor
 ConditionsIOVPool::ConditionsIOVPool(const IOVType* typ) : type(typ)  {
   InstanceCount::increment(this);
@@ -39,16 +47,126 @@ ConditionsIOVPool::~ConditionsIOVPool()  {
   InstanceCount::decrement(this);
 }
 
+/// (Re-)build the index from the elements
+void ConditionsIOVPool::Index::build(const Elements& elements, long clock)   {
+  size_t num = elements.size();
+  entries.clear();
+  entries.reserve(num);
+  for( const auto& e : elements )
+    entries.emplace_back(&e);
+  byUpper.resize(num);
+  for( size_t i = 0; i < num; ++i ) byUpper[i] = i;
+  std::stable_sort(byUpper.begin(), byUpper.end(), [this](size_t a, size_t b)  {
+      return entries[a]->first.second < entries[b]->first.second;  });
+  maxUpper.assign(num > 0 ? 4*num : 0, IOV::MIN_KEY);
+  if ( num > 0 ) build_tree(1, 0, num);
+  stamps.reset(new std::atomic<long>[num]);
+  for( size_t i = 0; i < num; ++i ) stamps[i] = clock;
+}
+
+/// Remove all entries
+void ConditionsIOVPool::Index::clear()   {
+  entries.clear();
+  byUpper.clear();
+  maxUpper.clear();
+  stamps.reset();
+}
+
+/// Fill the tree nodes
+void ConditionsIOVPool::Index::build_tree(size_t node, size_t lo, size_t hi)   {
+  if ( hi - lo == 1 )  {
+    maxUpper[node] = entries[lo]->first.second;
+    return;
+  }
+  size_t mid = (lo + hi) / 2;
+  build_tree(2*node,   lo,  mid);
+  build_tree(2*node+1, mid, hi);
+  maxUpper[node] = std::max(maxUpper[2*node], maxUpper[2*node+1]);
+}
+
+/// Collect all entries [0,end) with an upper IOV edge of at least min_upper
+void ConditionsIOVPool::Index::collect(size_t node, size_t lo, size_t hi, size_t end,
+                                       key_type min_upper, std::vector<size_t>& result)  const
+{
+  if ( lo >= end || maxUpper[node] < min_upper )
+    return;
+  if ( hi - lo == 1 )  {
+    result.emplace_back(lo);
+    return;
+  }
+  size_t mid = (lo + hi) / 2;
+  collect(2*node,   lo,  mid, end, min_upper, result);
+  collect(2*node+1, mid, hi,  end, min_upper, result);
+}
+
+/// Entries with a key containing the test range
+void ConditionsIOVPool::Index::containing(const IOV::Key& test, std::vector<size_t>& result)  const  {
+  // Candidates: lower edge <= test.first. Of these take all with upper edge >= test.second
+  auto end = std::upper_bound(entries.begin(), entries.end(), test.first,
+                              [](key_type v, const Elements::value_type* e) { return v < e->first.first; });
+  if ( end != entries.begin() )
+    collect(1, 0, entries.size(), end - entries.begin(), test.second, result);
+}
+
+/// Entries with a lower or upper IOV edge within the test range
+void ConditionsIOVPool::Index::overlapping(const IOV::Key& test, std::vector<size_t>& result)  const  {
+  auto by_lower = [](const Elements::value_type* e, key_type v) { return e->first.first < v; };
+  auto lo = std::lower_bound(entries.begin(), entries.end(), test.first, by_lower);
+  for( ; lo != entries.end() && (*lo)->first.first <= test.second; ++lo )
+    result.emplace_back(lo - entries.begin());
+  // Lower edge before the test range: the upper edge must be in the range
+  size_t num_lower = result.size();
+  auto by_upper = [this](size_t i, key_type v) { return entries[i]->first.second < v; };
+  auto up = std::lower_bound(byUpper.begin(), byUpper.end(), test.first, by_upper);
+  for( ; up != byUpper.end() && entries[*up]->first.second <= test.second; ++up )  {
+    if ( entries[*up]->first.first < test.first )
+      result.emplace_back(*up);
+  }
+  if ( result.size() != num_lower )
+    std::sort(result.begin(), result.end());
+}
+
+/// Access the index. Rebuilt if the elements were modified
+const ConditionsIOVPool::Index& ConditionsIOVPool::i_index()   {
+  if ( !m_indexValid.load(std::memory_order_acquire) )  {
+    std::lock_guard<std::mutex> guard(m_indexLock);
+    if ( !m_indexValid.load(std::memory_order_relaxed) )  {
+      i_updateAges();
+      m_index.build(elements, m_ageClock.load());
+      m_indexValid.store(true, std::memory_order_release);
+    }
+  }
+  return m_index;
+}
+
+/// Bring the age_value of all indexed pools up to date
+void ConditionsIOVPool::i_updateAges()   {
+  long clock = m_ageClock.load();
+  for( size_t i = 0; i < m_index.entries.size(); ++i )  {
+    long age = clock - m_index.stamps[i].exchange(clock);
+    if ( age > 0 ) m_index.entries[i]->second->age_value += int(age);
+  }
+}
+
+/// Add a new conditions pool. The caller must hold the lock exclusively
+bool ConditionsIOVPool::insert(const IOV::Key& key, Element pool)   {
+  if ( elements.emplace(key, std::move(pool)).second )  {
+    m_indexValid = false;
+    return true;
+  }
+  return false;
+}
+
 size_t ConditionsIOVPool::select(Condition::key_type key, const IOV& req_validity, RangeConditions& result)
 {
+  read_lock_t guard(lock);
   if ( !elements.empty() )  {
     size_t len = result.size();
-    const IOV::Key req_key = req_validity.key(); // 16 bytes => better copy!
-    for( const auto& e : elements )  {
-      if ( IOV::key_contains_range(e.first, req_key) )  {
-        e.second->select(key, result);
-      }
-    }
+    const Index& idx = i_index();
+    std::vector<size_t> matches;
+    idx.containing(req_validity.key(), matches);
+    for( size_t i : matches )
+      idx.entries[i]->second->select(key, result);
     return result.size() - len;
   }
   return 0;
@@ -56,26 +174,26 @@ size_t ConditionsIOVPool::select(Condition::key_type key, const IOV& req_validit
 
 size_t ConditionsIOVPool::selectRange(Condition::key_type key, const IOV& req_validity, RangeConditions& result)
 {
+  read_lock_t guard(lock);
   size_t len = result.size();
-  const IOV::Key range = req_validity.key();
-  for( const auto& e : elements )  {
-    const IOV::Key& k = e.first;
-    if ( IOV::key_is_contained(k,range) )
-      // IOV test contained in key. Take it!
-      e.second->select(key, result);
-    else if ( IOV::key_overlaps_lower_end(k,range) )
-      // IOV overlap on test on the lower end of key
-      e.second->select(key, result);
-    else if ( IOV::key_overlaps_higher_end(k,range) )
-      // IOV overlap of test on the higher end of key
-      e.second->select(key, result);
+  if ( !elements.empty() )  {
+    // IOV test contained in key or overlapping on the lower or the higher end of key
+    const Index& idx = i_index();
+    std::vector<size_t> matches;
+    idx.overlapping(req_validity.key(), matches);
+    for( size_t i : matches )
+      idx.entries[i]->second->select(key, result);
   }
   return result.size() - len;
 }
 
 /// Invoke cache cleanup with user defined policy
 int ConditionsIOVPool::clean(const ConditionsCleanup& cleaner)   {
- Elements rest;
+  write_lock_t guard(lock);
+  i_updateAges();
+  m_indexValid = false;
+  m_index.clear();
+  Elements rest;
   int count = 0;
   for( const auto& e : elements )  {
     const ConditionsPool* p = e.second.get();
@@ -92,6 +210,10 @@ int ConditionsIOVPool::clean(const ConditionsCleanup& cleaner)   {
 
 /// Remove all key based pools with an age beyon the minimum age
 int ConditionsIOVPool::clean(int max_age)   {
+  write_lock_t guard(lock);
+  i_updateAges();
+  m_indexValid = false;
+  m_index.clear();
   Elements rest;
   int count = 0;
   for( const auto& e : elements )  {
@@ -112,17 +234,20 @@ size_t ConditionsIOVPool::select(const IOV&        req_validity,
                                  RangeConditions&  valid,
                                  IOV&              cond_validity)
 {
+  read_lock_t guard(lock);
   size_t num_selected = 0;
   if ( !elements.empty() )  {
-    const IOV::Key req_key = req_validity.key(); // 16 bytes => better copy!
-    for( const auto& i : elements )  {
-      if ( !IOV::key_contains_range(i.first, req_key) )  {
-        ++i.second->age_value;
-        continue;
-      }
-      cond_validity.iov_intersection(i.first);
-      num_selected += i.second->select_all(valid);
-      i.second->age_value = 0;
+    // Pools not selected age by one: accounted by the age clock
+    const Index& idx = i_index();
+    long clock = ++m_ageClock;
+    std::vector<size_t> matches;
+    idx.containing(req_validity.key(), matches);
+    for( size_t i : matches )  {
+      const auto* e = idx.entries[i];
+      cond_validity.iov_intersection(e->first);
+      num_selected += e->second->select_all(valid);
+      e->second->age_value = 0;
+      idx.stamps[i] = clock;
     }
   }
   return num_selected;
@@ -133,18 +258,21 @@ size_t ConditionsIOVPool::select(const IOV&              req_validity,
                                  const ConditionsSelect& predicate_processor,
                                  IOV&                    cond_validity)
 {
+  read_lock_t guard(lock);
   size_t num_selected = 0, pool_selected = 0;
   if ( !elements.empty() )  {
-    const IOV::Key req_key = req_validity.key(); // 16 bytes => better copy!
-    for( const auto& i : elements )  {
-      if ( !IOV::key_contains_range(i.first, req_key) )  {
-        ++i.second->age_value;
-        continue;
-      }
-      cond_validity.iov_intersection(i.first);
-      pool_selected = i.second->select_all(predicate_processor);
+    // Pools not selected age by one: accounted by the age clock
+    const Index& idx = i_index();
+    long clock = ++m_ageClock;
+    std::vector<size_t> matches;
+    idx.containing(req_validity.key(), matches);
+    for( size_t i : matches )  {
+      const auto* e = idx.entries[i];
+      cond_validity.iov_intersection(e->first);
+      pool_selected = e->second->select_all(predicate_processor);
       num_selected += pool_selected;
-      i.second->age_value = 0;
+      e->second->age_value = 0;
+      idx.stamps[i] = clock;
     }
   }
   return num_selected;
@@ -165,14 +293,15 @@ size_t ConditionsIOVPool::select(const IOV& req_validity,
 /// Select all ACTIVE conditions, which do match the IOV requirement
 size_t ConditionsIOVPool::select(const IOV& req_validity, Elements&  valid)
 {
+  read_lock_t guard(lock);
   size_t num_selected = 0;
   if ( !elements.empty() )   {
-    const IOV::Key req_key = req_validity.key(); // 16 bytes => better copy!
-    for( const auto& i : elements )  {
-      if ( !IOV::key_contains_range(i.first, req_key) )  {
-        continue;
-      }
-      valid[i.first] = i.second;
+    const Index& idx = i_index();
+    std::vector<size_t> matches;
+    idx.containing(req_validity.key(), matches);
+    for( size_t i : matches )  {
+      const auto* e = idx.entries[i];
+      valid[e->first] = e->second;
       ++num_selected;
     }
   }
@@ -194,14 +323,15 @@ size_t ConditionsIOVPool::select(const IOV&        req_validity,
 /// Select all ACTIVE conditions, which do match the IOV requirement
 size_t ConditionsIOVPool::select(const IOV& req_validity, std::vector<Element>& valid)
 {
+  read_lock_t guard(lock);
   size_t num_selected = 0;
   if ( !elements.empty() )   {
-    const IOV::Key req_key = req_validity.key(); // 16 bytes => better copy!
-    for( const auto& i : elements )  {
-      if ( !IOV::key_contains_range(i.first, req_key) )  {
-        continue;
-      }
-      valid.emplace_back(i.second);
+    const Index& idx = i_index();
+    std::vector<size_t> matches;
+    idx.containing(req_validity.key(), matches);
+    valid.reserve(valid.size() + matches.size());
+    for( size_t i : matches )  {
+      valid.emplace_back(idx.entries[i]->second);
       ++num_selected;
     }
   }
@@ -127,6 +127,16 @@ namespace {
     return false;
   }
 
+  /// Helper: Lock the IOV pool hosting a conditions pool for modifications
+  std::unique_lock<std::shared_timed_mutex>
+  __lock_iov_pool(const Manager_Type1::TypedConditionPool& raw_pool, const ConditionsPool& pool)  {
+    const IOV* iov = pool.iov;
+    size_t typ = iov ? (iov->iovType ? iov->iovType->type : iov->type) : raw_pool.size();
+    if ( typ < raw_pool.size() && raw_pool[typ] )
+      return std::unique_lock<std::shared_timed_mutex>(raw_pool[typ]->lock);
+    return std::unique_lock<std::shared_timed_mutex>();
+  }
+
   template <typename PMF>
   void __callListeners(const Manager_Type1::Listeners& listeners, PMF pmf, Condition& cond)  {
     for(const auto& listener : listeners )
@@ -221,6 +231,8 @@ ConditionsPool* Manager_Type1::registerIOV(const IOVType& typ, IOV::Key key)   {
   if ( !pool )  {
     m_rawPool[typ.type] = pool = new ConditionsIOVPool(&typ);
   }
+  // Concurrent selections must not see the elements while being modified
+  std::unique_lock<std::shared_timed_mutex> pool_lock(pool->lock);
   ConditionsIOVPool::Elements::const_iterator i = pool->elements.find(key);
   if ( i != pool->elements.end() )   {
     return (*i).second.get();
@@ -230,7 +242,7 @@ ConditionsPool* Manager_Type1::registerIOV(const IOVType& typ, IOV::Key key)   {
   iov->keyData   = key;
   const void* argv_pool[] = {this, iov, 0};
   shared_ptr<ConditionsPool> cond_pool(createPlugin<ConditionsPool>(m_poolType,m_detDesc,2,argv_pool));
-  pool->elements.emplace(key,cond_pool);
+  pool->insert(key,cond_pool);
   printout(INFO,"ConditionsMgr","Created IOV Pool for:%s",iov->str().c_str());
   return cond_pool.get();
 }
@@ -243,6 +255,7 @@ ConditionsIOVPool* Manager_Type1::iovPool(const IOVType& iov_type)  const    {
 /// Register new condition with the conditions store. Unlocked version, not multi-threaded
 bool Manager_Type1::registerUnlocked(ConditionsPool& pool, Condition cond)   {
   if ( cond.isValid() )  {
+    auto pool_lock = __lock_iov_pool(m_rawPool, pool);
     cond->iov  = pool.iov;
     cond->setFlag(Condition::ACTIVE);
     pool.insert(cond);
@@ -270,6 +283,7 @@ bool Manager_Type1::registerUnlocked(ConditionsPool& pool, Condition cond)   {
 /// Register a whole block of conditions with identical IOV.
 size_t Manager_Type1::blockRegister(ConditionsPool& pool, const vector<Condition>& cond) const {
   size_t result = 0;
+  auto pool_lock = __lock_iov_pool(m_rawPool, pool);
   //string typ;
   for(auto c : cond)   {
     if ( c.isValid() )    {
@@ -306,6 +320,7 @@ Condition Manager_Type1::__queue_update(cond::Entry* e)   {
 #endif
     c->iov  = p->iov;
     c->hash = ConditionKey::KeyMaker(e->detector,e->name).hash;
+    auto pool_lock = __lock_iov_pool(m_rawPool, *p);
     p->insert(c);
     if ( s_debug > INFO )  {
 #if defined(DD4HEP_MINIMAL_CONDITIONS)
@@ -39,6 +39,11 @@ namespace dd4hep {
      *  Only the ConditionsManager implementation should interact with
      *  this class or any subclass to ensure data integrity.
      *
+     *  Each user pool is private to one conditions slice. Different slices
+     *  may be prepared concurrently: the shared IOV pools and the conditions
+     *  loader are protected by their own locks. The computation of missing
+     *  derived conditions is serialized per IOV pool.
+     *
      *  \author  M.Frank
      *  \version 1.0
      *  \ingroup DD4HEP_CONDITIONS
@@ -58,6 +63,9 @@ namespace dd4hep {
       /// Internal insertion helper
       bool i_insert(Condition::Object* o);
 
+      /// Internal helper to add derived conditions registered meanwhile by other slices
+      template <typename T> size_t i_selectComputed(const IOV& required, T& calc_missing);
+
     public:
       /// Default constructor
       ConditionsMappedUserPool(ConditionsManager mgr, ConditionsIOVPool* pool);
@@ -470,6 +478,7 @@ size_t ConditionsMappedUserPool<MAPPING>::compute(const Dependencies& deps,
       missing.emplace(i);
     }
     if ( !missing.empty() )  {
+      lock_guard<mutex> compute_guard(m_iovPool->computeLock);
       ConditionsManagerObject* mgr(m_manager.access());
       ConditionsDependencyHandler handler(mgr, *this, missing, user_param);
       /// 1rst pass: Compute/create the missing condiions
@@ -500,6 +509,27 @@ namespace {
   };
 }
 
+/// Internal helper to add derived conditions registered meanwhile by other slices
+template<typename MAPPING> template <typename T> size_t
+ConditionsMappedUserPool<MAPPING>::i_selectComputed(const IOV& required, T& calc_missing)   {
+  IOV    pool_iov(required.iovType);
+  size_t num_conditions = m_conditions.size();
+  pool_iov.reset().invert();
+  m_iovPool->select(required, Operators::mapConditionsSelect(m_conditions), pool_iov);
+  if ( m_conditions.size() == num_conditions )  {
+    return 0;
+  }
+  m_iov.iov_intersection(pool_iov);
+  auto last = remove_if(begin(calc_missing), end(calc_missing),
+                        [this](const typename T::value_type& e)  {
+                          return m_conditions.find(e.first) != m_conditions.end(); });
+  size_t num_selected = end(calc_missing) - last;
+  calc_missing.erase(last, end(calc_missing));
+  printout((flags&PRINT_COMPUTE) ? INFO : DEBUG,"UserPool",
+           "%ld derived conditions were computed by concurrent slices.", num_selected);
+  return num_selected;
+}
+
 template<typename MAPPING> ConditionsManager::Result
 ConditionsMappedUserPool<MAPPING>::prepare(const IOV&                  required, 
                                            ConditionsSlice&            slice,
@@ -516,12 +546,6 @@ ConditionsMappedUserPool<MAPPING>::prepare(const IOV&                  required,
   IOV    pool_iov(required.iovType);
   ConditionsManager::Result result;
 
-  // This is a critical operation, because we have to ensure the
-  // IOV pools are ONLY manipulated by the current thread.
-  // Otherwise the selection and the population are unsafe!
-  static mutex lock;
-  lock_guard<mutex> guard(lock);
-
   m_conditions.clear();
   slice_miss_cond.clear();
   slice_miss_calc.clear();
@@ -558,7 +582,10 @@ ConditionsMappedUserPool<MAPPING>::prepare(const IOV&                  required,
   if ( num_cond_miss > 0 )  {
     if ( do_load )  {
       ConditionsDataLoader::LoadedItems loaded;
-      size_t updates = m_loader->load_many(required, cond_missing, loaded, pool_iov);
+      size_t updates = 0;  {
+        lock_guard<mutex> load_guard(m_loader->lock());
+        updates = m_loader->load_many(required, cond_missing, loaded, pool_iov);
+      }
       if ( updates > 0 )  {
         // Need to compute the intersection: All missing entries are required....
         CondMissing load_missing(cond_missing.size()+loaded.size());
@@ -598,6 +625,13 @@ ConditionsMappedUserPool<MAPPING>::prepare(const IOV&                  required,
   //
   if ( num_calc_miss > 0 )  {
     if ( do_load )  {
+      // Derived conditions are registered to the shared IOV pools:
+      // only one slice at a time may compute them.
+      lock_guard<mutex> compute_guard(m_iovPool->computeLock);
+      size_t num_selected = i_selectComputed(required, calc_missing);
+      last_calc = calc_missing.end();
+      result.selected += num_selected;
+      result.missing  -= num_selected;
       map<Condition::key_type,const ConditionDependency*> deps(calc_missing.begin(),last_calc);
       ConditionsDependencyHandler handler(m_manager, *this, deps, user_param);
       /// 1rst pass: Compute/create the missing condiions
@@ -641,12 +675,6 @@ ConditionsMappedUserPool<MAPPING>::load(const IOV&                  required,
   IOV    pool_iov(required.iovType);
   ConditionsManager::Result result;
 
-  // This is a critical operation, because we have to ensure the
-  // IOV pools are ONLY manipulated by the current thread.
-  // Otherwise the selection and the population are unsafe!
-  static mutex lock;
-  lock_guard<mutex> guard(lock);
-
   m_conditions.clear();
   slice_miss_cond.clear();
   pool_iov.reset().invert();
@@ -671,7 +699,10 @@ ConditionsMappedUserPool<MAPPING>::load(const IOV&                  required,
   if ( num_cond_miss > 0 )  {
     if ( do_load )  {
       ConditionsDataLoader::LoadedItems loaded;
-      size_t updates = m_loader->load_many(required, cond_missing, loaded, pool_iov);
+      size_t updates = 0;  {
+        lock_guard<mutex> load_guard(m_loader->lock());
+        updates = m_loader->load_many(required, cond_missing, loaded, pool_iov);
+      }
       if ( updates > 0 )  {
         // Need to compute the intersection: All missing entries are required....
         CondMissing load_missing(cond_missing.size()+loaded.size());
@@ -715,12 +746,6 @@ ConditionsMappedUserPool<MAPPING>::compute(const IOV&                  required,
   IOV    pool_iov(required.iovType);
   ConditionsManager::Result result;
 
-  // This is a critical operation, because we have to ensure the
-  // IOV pools are ONLY manipulated by the current thread.
-  // Otherwise the selection and the population are unsafe!
-  static mutex lock;
-  lock_guard<mutex> guard(lock);
-
   slice_miss_calc.clear();
   CalcMissing calc_missing(slice_calc.size()+m_conditions.size());
   CalcMissing::iterator last_calc = set_difference(begin(slice_calc),   end(slice_calc),
@@ -741,6 +766,13 @@ ConditionsMappedUserPool<MAPPING>::compute(const IOV&                  required,
   //
   if ( num_calc_miss > 0 )  {
     if ( do_load )  {
+      // Derived conditions are registered to the shared IOV pools:
+      // only one slice at a time may compute them.
+      lock_guard<mutex> compute_guard(m_iovPool->computeLock);
+      size_t num_selected = i_selectComputed(required, calc_missing);
+      last_calc = calc_missing.end();
+      result.selected += num_selected;
+      result.missing  -= num_selected;
       map<Condition::key_type,const ConditionDependency*> deps(calc_missing.begin(),last_calc);
       ConditionsDependencyHandler handler(m_manager, *this, deps, user_param);
 
@@ -18,6 +18,9 @@
 #include "DD4hep/AlignmentData.h"
 #include "DD4hep/ConditionsMap.h"
 
+// C/C++ include files
+#include <memory>
+
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
 
@@ -29,6 +32,12 @@ namespace dd4hep {
 
     /// Alignment calculator instance to handle alignment dependencies
     /**
+     *  The calculator may be used in incremental mode (see compute_incremental).
+     *  It then keeps the result of the previous call and only recomputes the
+     *  transformations of detector elements, where either the delta or the
+     *  world transformation of the parent changed. The transformations of all
+     *  other elements are copied from the previous result.
+     *
      *  \author   M.Frank
      *  \version  1.0
      *  \ingroup  DD4HEP_ALIGN
@@ -44,9 +53,11 @@ namespace dd4hep {
        */
       class Result  {
       public:
-        size_t computed = 0;
-        size_t missing  = 0;
-	size_t multiply = 0;
+        size_t computed   = 0;
+        size_t missing    = 0;
+	size_t multiply   = 0;
+        /// Number of alignments, where the transformations were (re-)calculated
+        size_t recomputed = 0;
         Result() = default;
         /// Copy constructor
         Result(const Result& result) = default;
@@ -74,6 +85,8 @@ namespace dd4hep {
 
       typedef std::map<DetElement,const Delta*,PathOrdering> OrderedDeltas;
       typedef std::map<Condition::key_type,DetElement>       ExtractContext;
+      /// Result of the previous incremental computation
+      class Snapshot;
 
       /// Scanner to find all alignment deltas in the detector hierarchy
       /**
@@ -125,10 +138,16 @@ namespace dd4hep {
         int operator()(DetElement de, int)  const;
       };
 
+    protected:
+      /// Transformations of the previous call to compute_incremental
+      std::unique_ptr<Snapshot> m_snapshot;
+
     public:
 
       /// Default constructor
       AlignmentsCalculator() = default;
+      /// Default destructor
+      ~AlignmentsCalculator();
       /// Copy constructor
       AlignmentsCalculator(const AlignmentsCalculator& copy) = delete;
       /// Assignment operator
@@ -142,6 +161,18 @@ namespace dd4hep {
       /// Optimized call using already properly ordered Deltas
       Result compute(const OrderedDeltas& deltas, ConditionsMap& alignments)  const;
 
+      /// Incremental mode: only recompute the alignments of changed detector elements
+      /** The transformations of the previous call are kept. Alignments where
+       *  neither the delta nor the parent transformation changed are copied.
+       *  The number of recalculated alignments is reported in Result::recomputed.
+       */
+      Result compute_incremental(const std::map<DetElement, Delta>& deltas,
+                                 ConditionsMap& alignments);
+      /// Incremental mode using already properly ordered Deltas
+      Result compute_incremental(const OrderedDeltas& deltas, ConditionsMap& alignments);
+      /// Drop the result of the previous incremental computation
+      void reset();
+
       /// Helper: Extract all Delta-conditions from the conditions map
       size_t extract_deltas(cond::ConditionUpdateContext& context,
                             OrderedDeltas& deltas,
@@ -177,17 +208,19 @@ namespace dd4hep {
     /// Add results
     inline AlignmentsCalculator::Result&
     AlignmentsCalculator::Result::operator +=(const Result& result)  {
-      multiply += result.multiply;
-      computed += result.computed;
-      missing  += result.missing;
+      multiply   += result.multiply;
+      computed   += result.computed;
+      missing    += result.missing;
+      recomputed += result.recomputed;
       return *this;
     }
     /// Subtract results
     inline AlignmentsCalculator::Result&
     AlignmentsCalculator::Result::operator -=(const Result& result)  {
-      multiply -= result.multiply;
-      computed -= result.computed;
-      missing  -= result.missing;
+      multiply   -= result.multiply;
+      computed   -= result.computed;
+      missing    -= result.missing;
+      recomputed -= result.recomputed;
       return *this;
     }
 
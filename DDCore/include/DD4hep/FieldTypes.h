@@ -17,6 +17,7 @@
 #include "DD4hep/Fields.h"
 #include "DD4hep/Shapes.h"
 #include <vector>
+#include <memory>
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -62,6 +63,8 @@ namespace dd4hep {
     SolenoidField();
     /// Call to access the field components at a given location
     virtual void fieldComponents(const double* pos, double* field);
+    /// Bounding box of the region where the field is non-zero
+    virtual bool boundingBox(double* lower, double* upper) const;
   };
 
   /// Implementation object of a dipole magnetic field.
@@ -83,6 +86,8 @@ namespace dd4hep {
     DipoleField();
     /// Call to access the field components at a given location
     virtual void fieldComponents(const double* pos, double* field);
+    /// Bounding box of the region where the field is non-zero
+    virtual bool boundingBox(double* lower, double* upper) const;
   };
 
   /// Implementation object of a Multipole magnetic field.
@@ -174,6 +179,102 @@ namespace dd4hep {
     MultipoleField();
     /// Call to access the field components at a given location
     virtual void fieldComponents(const double* pos, double* field);
+    /// Bounding box of the region where the field is non-zero
+    virtual bool boundingBox(double* lower, double* upper) const;
+  };
+
+  /// Implementation object of a magnetic field map on a regular grid.
+  /**
+   *  Field map with the field values given on the points of a regular
+   *  3 dimensional grid. The grid is either Cartesian (x, y, z) or
+   *  cylindrical (r, phi, z). Between the grid points the field
+   *  components are interpolated trilinearly. Outside the grid the
+   *  field map does not contribute.
+   *
+   *  The field values are read from a binary file, which is mapped to
+   *  memory. The file content is shared by all field maps using the
+   *  same file and by all threads - there is no copy of the data.
+   *
+   *  Binary file layout (native byte order):
+   *  - Header (see below)
+   *  - For each grid point 3 float values: (Bx, By, Bz) for Cartesian
+   *    grids, (Br, Bphi, Bz) for cylindrical grids. Unit: tesla.
+   *    The grid points are ordered with the first coordinate
+   *    running fastest: index = i0 + n0 * (i1 + n1 * i2).
+   *
+   *  Grid edges are given in mm (and radian for phi).
+   *  Along a coordinate with a single grid point the field is constant,
+   *  e.g. cylindrical grids with a single phi bin are phi-symmetric.
+   *  Cylindrical grids, where the phi points cover the full circle
+   *  (upper - lower + spacing = 2 pi), are periodic in phi: between the
+   *  last and the first phi point the field is interpolated as well.
+   *  Text field maps are converted to the binary format with the
+   *  plugin DD4hep_FieldMapConverter.
+   *
+   *  \author  M.Frank
+   *  \version 1.0
+   *  \ingroup DD4HEP_CORE
+   */
+  class FieldMap : public CartesianField::Object {
+  public:
+    /// Grid coordinate systems
+    enum Coordinates  {  CARTESIAN = 0, CYLINDRICAL = 1  };
+    /// Header of the binary field map file
+    struct Header  {
+      /// File identifier: "DD4HFMAP"
+      char         magic[8];
+      /// Format version
+      unsigned int version;
+      /// Grid coordinate system (see enum Coordinates)
+      unsigned int coordinates;
+      /// Number of grid points along each coordinate
+      unsigned int points[3];
+      /// Padding
+      unsigned int reserved;
+      /// Position of the first grid point [mm, rad]
+      double       lower[3];
+      /// Position of the last grid point [mm, rad]
+      double       upper[3];
+    };
+    /// Memory mapped field map file
+    class Mapping;
+
+    /// Name of the binary field map file
+    std::string  file;
+
+  protected:
+    /// Handle to the memory mapped file
+    std::shared_ptr<const Mapping> mapping;
+    /// Field values of the grid points (mapped memory)
+    const float* values        { nullptr };
+    /// Grid coordinate system
+    int          coordinates   { CARTESIAN };
+    /// Number of grid points along each coordinate
+    long         points[3]     { 1, 1, 1 };
+    /// Value offset between neighbouring grid points along each coordinate
+    long         stride[3]     { 3, 3, 3 };
+    /// Position of the first grid point in internal units
+    double       lower[3]      { 0e0, 0e0, 0e0 };
+    /// Position of the last grid point in internal units
+    double       upper[3]      { 0e0, 0e0, 0e0 };
+    /// Inverse grid spacing
+    double       inv_step[3]   { 0e0, 0e0, 0e0 };
+    /// Cylindrical grids: the phi points cover the full circle
+    bool         periodic      { false };
+
+  public:
+    /// Initializing constructor
+    FieldMap();
+    /// Default destructor
+    virtual ~FieldMap();
+    /// Map the binary field map file to memory
+    void load(const std::string& file_name);
+    /// Access the grid coordinate system
+    int  coordinateSystem()  const   {  return coordinates;  }
+    /// Call to access the field components at a given location
+    virtual void fieldComponents(const double* pos, double* field);
+    /// Bounding box of the region where the field is non-zero
+    virtual bool boundingBox(double* lower, double* upper) const;
   };
 
 }         /* End namespace dd4hep             */
@@ -80,6 +80,13 @@ namespace dd4hep {
        *  field vector in order to allow for superposition of the fields.
        */
       virtual void fieldComponents(const double* pos, double* field) = 0;
+
+      /** Overwrite to declare the region where the field is non-zero.
+       *  Fill the corners of the axis aligned bounding box and return true.
+       *  Outside the box the field components must be zero.
+       *  The default implementation returns false: the field is unbounded.
+       */
+      virtual bool boundingBox(double* lower, double* upper) const;
     };
 
     /// Default constructor
@@ -131,6 +138,13 @@ namespace dd4hep {
    *  The resulting field vectors are computed by the vector addition
    *  of the individual components.
    *
+   *  If several components declare a bounding box (see
+   *  CartesianField::Object::boundingBox), a coarse 3D grid maps each
+   *  cell to the components contributing in this cell. A field lookup
+   *  then only evaluates these components. The grid is rebuilt when a
+   *  component is added: the parameters defining the extent of a
+   *  component must be set before it is added to the overlay.
+   *
    *  \author  M.Frank
    *  \version 1.0
    *  \ingroup DD4HEP_CORE
@@ -153,18 +167,33 @@ namespace dd4hep {
      */
     class Object: public CartesianField::TypedObject {
     public:
+      /// Spatial index of the field components
+      class Index;
+
       CartesianField electric;
       CartesianField magnetic;
       std::vector<CartesianField> electric_components;
       std::vector<CartesianField> magnetic_components;
       /// Field extensions
       Properties properties;
+      /// Spatial index of the electric field components. Rebuilt when a component is added
+      Index* electric_index  { nullptr };   //! not persistent
+      /// Spatial index of the magnetic field components. Rebuilt when a component is added
+      Index* magnetic_index  { nullptr };   //! not persistent
 
     public:
       /// Default constructor
       Object();
+      /// No copy constructor: the spatial indices are owned by the object
+      Object(const Object&) = delete;
+      /// No move constructor
+      Object(Object&&) = delete;
       /// Default destructor
       virtual ~Object();
+      /// No assignment operator
+      Object& operator=(const Object&) = delete;
+      /// No move assignment
+      Object& operator=(Object&&) = delete;
     };
 
     /// Default constructor
@@ -42,6 +42,9 @@ namespace dd4hep {
   /// Steer redefinition of variable re-definition during expression evaluation. returns old value
   bool set_allow_variable_redefine(bool value);
 
+  /// Steer the literal fast path and the expression cache of the numeric conversions. returns old value
+  bool set_fast_evaluation(bool value);
+
   long num_object_validations();
   void increment_object_validations();
 
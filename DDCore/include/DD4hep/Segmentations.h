@@ -82,6 +82,11 @@ namespace dd4hep {
     Position position(const long64& cellID) const;
     /// determine the cell ID based on the local position
     long64 cellID(const Position& localPosition, const Position& globalPosition, const long64& volumeID) const;
+    /// determine the local positions of n cell IDs
+    void positions(const CellID* cellIDs, Position* localPositions, std::size_t n) const;
+    /// determine the cell IDs of n local positions. All arrays must hold n entries
+    void cellIDs(const Position* localPositions, const Position* globalPositions,
+                 const VolumeID* volumeIDs, CellID* cellIDs, std::size_t n) const;
     /// Determine the volume ID from the full cell ID by removing all local fields
     VolumeID volumeID(const CellID& cellID) const;
     /// Calculates the neighbours of the given cell ID and adds them to the list of neighbours
@@ -42,6 +42,8 @@ namespace dd4hep {
    *  If the sensitive volume is NOT the element's placement,
    *  then the calls are forwarded to an appended invisible structure at the end
    *  of the memory.
+   *  This structure also holds the pre-multiplied transformation from the
+   *  volume to the world, so that localToWorld() is a single matrix operation.
    *
    * \author  M.Frank
    * \version 1.0
@@ -57,6 +59,8 @@ namespace dd4hep {
     VolumeID     mask       = ~0x0ULL;
     /// Flag to indicate optional information
     long         flag       = 0;
+    /// Segmentation of the readout used to encode the identifier. Not persistent
+    Segmentation segmentation;   //!
   public:
     /// Default constructor
     VolumeManagerContext() = default;
@@ -30,6 +30,9 @@
 // ROOT include files
 #include "TGeoMatrix.h"
 
+// C/C++ include files
+#include <unordered_map>
+
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
 
@@ -49,10 +52,16 @@ namespace dd4hep {
       PlacedVolume placement{0};
       /// The transformation of space-points to the coordinate system of the closests detector element
       TGeoHMatrix toElement;
+      /// Cached transformation volume to world: rotation (row-major) and translation. Not persistent
+      double      toWorld[12] { 1e0, 0e0, 0e0, 0e0, 1e0, 0e0, 0e0, 0e0, 1e0, 0e0, 0e0, 0e0 };  //!
+      /// Flag if the cached transformation toWorld is valid. Not persistent
+      bool        haveWorld { false };  //!
       /// Default constructor
       VolumeManagerContextExtension() = default;
       /// Default destructor
       ~VolumeManagerContextExtension() = default;
+      /// Update the cached transformation to the world from the nominal placement of the element
+      void updateWorldTransformation();
     };
   
     /// This structure describes the internal data of the volume manager object
@@ -64,12 +73,31 @@ namespace dd4hep {
      */
     class VolumeManagerObject: public NamedObject {
     public:
+      /// Dispatch table to the subdetector managers sharing the same system field layout
+      /** The table is indexed by the raw bits of the system field
+       *  decoded from the volume identifier.
+       */
+      struct SystemDispatch  {
+        /// Mask of the system field
+        VolumeID                          mask     = 0;
+        /// Offset of the system field
+        unsigned                          offset   = 0;
+        /// Subdetector managers indexed by the system field value
+        std::vector<VolumeManagerObject*> managers;
+      };
+      /// Maximal width of a system field handled by the dispatch table
+      enum { MAX_DISPATCH_WIDTH = 16 };
+
       /// The container of subdetector elements
       std::map<DetElement, VolumeManager>       subdetectors;
       /// The volume managers for the individual subdetector elements
       std::map<VolumeID, VolumeManager>         managers;
       /// The container of placements managed by this instance
       std::map<VolumeID, VolumeManagerContext*> volumes;
+      /// Hash index of the placements managed by this instance. Mirrors volumes
+      std::unordered_map<VolumeID, VolumeManagerContext*> volumeIndex; //! not persistent
+      /// Dispatch tables to the subdetector managers by system field
+      std::vector<SystemDispatch>               dispatch;    //! not persistent
       /// The Detector element handle managed by this instance
       DetElement             detector;
       /// The ID descriptor object
@@ -99,6 +127,10 @@ namespace dd4hep {
       VolumeManagerObject& operator=(const VolumeManagerObject& copy) = delete;
       /// Search the locally cached volumes for a matching ID
       VolumeManagerContext* search(const VolumeID& id) const;
+      /// Register a subdetector manager in the system dispatch table
+      void addDispatch(const BitFieldElement* field, VolumeID sys_id, VolumeManagerObject* mgr);
+      /// Access the subdetector manager responsible for a volume identifier. Null if unknown
+      VolumeManagerObject* dispatchManager(VolumeID id) const;
       /// Update callback when alignment has changed (called only for subdetectors....)
       void update(unsigned long tags, DetElement& det, void* param);
     };
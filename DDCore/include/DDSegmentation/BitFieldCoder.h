@@ -94,7 +94,84 @@ namespace dd4hep {
     };
 
 
-  
+
+    /// Resolved access handle to one field of a BitFieldCoder.
+    /** All properties of the field (offset, mask, signedness and range) are cached
+     *  when the handle is resolved. Hence get/set are pure bit arithmetic without
+     *  any name lookup. Segmentations resolve their handles when the decoder is set.
+     *
+     *  Example:<br>
+     *    BitFieldHandle phi = bc.handle("phi") ;   <br>
+     *    phi.set( field, 270 ) ;                   <br>
+     *    int phiIndex = phi.value( field ) ;       <br>
+     *
+     *    @author M.Frank
+     */
+    class BitFieldHandle  {
+    public:
+      /// Default constructor: unresolved handle
+      BitFieldHandle() = default ;
+      /// Copy constructor
+      BitFieldHandle(const BitFieldHandle&) = default ;
+      /// Initializing constructor from the field element
+      BitFieldHandle(const BitFieldElement& element) ;
+      /// Default destructor
+      ~BitFieldHandle() = default ;
+      /// Assignment operator
+      BitFieldHandle& operator=(const BitFieldHandle&) = default ;
+
+      /// Check if the handle is resolved
+      bool isValid() const { return _mask != 0 ; }
+
+      /// calculate this field's value given an external 64 bit bitmap
+      long64 value(long64 bitfield) const {
+        if( _mask == 0 ) unresolved() ;
+        return decode( bitfield ) ;
+      }
+
+      /// assign the given value to the bit field
+      void set(long64& bitfield, long64 in) const {
+        if( in < _minVal || in > _maxVal ) outOfRange( in ) ;
+        bitfield = encode( bitfield, in ) ;
+      }
+
+      /// field value without validity check. For batch processing: check isValid() once
+      long64 decode(long64 bitfield) const {
+        ulong64 val = ( ulong64(bitfield) & _mask ) >> _offset ;
+        return long64( ( val ^ _signBit ) - _signBit ) ;
+      }
+
+      /// bit field with the value assigned without range check. For batch processing: check the range once
+      long64 encode(long64 bitfield, long64 in) const {
+        return long64( ( ulong64(bitfield) & ~_mask ) | ( ( ulong64(in) << _offset ) & _mask ) ) ;
+      }
+
+      /** Minimal value  */
+      long64 minValue() const { return _minVal ; }
+
+      /** Maximal value  */
+      long64 maxValue() const { return _maxVal ; }
+
+      /** The field's offset */
+      unsigned offset() const { return _offset ; }
+
+      /** The field's mask */
+      ulong64 mask() const { return _mask ; }
+
+    protected:
+      /// Error handling: access to an unresolved handle
+      [[noreturn]] void unresolved() const ;
+      /// Error handling: value out of range (or handle unresolved)
+      [[noreturn]] void outOfRange(long64 in) const ;
+
+      ulong64  _mask     {};
+      ulong64  _signBit  {};
+      long64   _minVal   { 1 };
+      long64   _maxVal   { 0 };
+      unsigned _offset   {};
+      unsigned _width    {};
+    };
+
     /// Helper class for decoding and encoding a bit field of 64bits for convenient declaration
     /** and manipulation of sub fields of various widths.<br>
      *  This is a thread safe re-implementation of the functionality in the deprected BitField64.
@@ -207,6 +284,18 @@ namespace dd4hep {
        */
       size_t index( const std::string& name) const ;
 
+      /** Check if a field named 'name' exists
+       */
+      bool hasField( const std::string& name) const {
+        return _map.find( name ) != _map.end() ;
+      }
+
+      /** Resolved access handle for field named 'name'
+       */
+      BitFieldHandle handle( const std::string& name) const {
+        return BitFieldHandle( _fields.at( index( name ) ) ) ;
+      }
+
 
       /** Const Access to field through name .
        */
@@ -38,6 +38,11 @@ namespace dd4hep {
       virtual Vector3D position(const CellID& cellID) const;
       /// determine the cell ID based on the position
       virtual CellID cellID(const Vector3D& localPosition, const Vector3D& globalPosition, const VolumeID& volumeID) const;
+      /// determine the local positions of n cell IDs in chunks
+      virtual void positions(const CellID* cellIDs, Vector3D* localPositions, std::size_t n) const;
+      /// determine the cell IDs of n positions in chunks
+      virtual void cellIDs(const Vector3D* localPositions, const Vector3D* globalPositions,
+                           const VolumeID* volumeIDs, CellID* cellIDs, std::size_t n) const;
       /// access the grid size in Z
       double gridSizeZ() const {
         return _gridSizeZ;
@@ -61,6 +66,7 @@ namespace dd4hep {
       /// set the field name used for Z
       void setFieldNameZ(const std::string& fieldName) {
         _zId = fieldName;
+        resolveFieldHandles();
       }
       /** \brief Returns a vector<double> of the cellDimensions of the given cell ID
           in natural order of dimensions, e.g., dx/dy/dz, or dr/r*dPhi
@@ -81,6 +87,8 @@ namespace dd4hep {
       double _offsetZ;
       /// the field name used for Z
       std::string _zId;
+      /// the resolved field handle of _zId
+      BitFieldHandle _zField;   //! No ROOT persistency
     };
 
   } /* namespace DDSegmentation */
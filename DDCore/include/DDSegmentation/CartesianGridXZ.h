@@ -38,6 +38,11 @@ namespace dd4hep {
       virtual Vector3D position(const CellID& cellID) const;
       /// determine the cell ID based on the position
       virtual CellID cellID(const Vector3D& localPosition, const Vector3D& globalPosition, const VolumeID& volumeID) const;
+      /// determine the local positions of n cell IDs in chunks
+      virtual void positions(const CellID* cellIDs, Vector3D* localPositions, std::size_t n) const;
+      /// determine the cell IDs of n positions in chunks
+      virtual void cellIDs(const Vector3D* localPositions, const Vector3D* globalPositions,
+                           const VolumeID* volumeIDs, CellID* cellIDs, std::size_t n) const;
       /// access the grid size in X
       double gridSizeX() const {
         return _gridSizeX;
@@ -81,10 +86,12 @@ namespace dd4hep {
       /// set the field name used for X
       void setFieldNameX(const std::string& fieldName) {
         _xId = fieldName;
+        resolveFieldHandles();
       }
       /// set the field name used for Y
       void setFieldNameZ(const std::string& fieldName) {
         _zId = fieldName;
+        resolveFieldHandles();
       }
       /** \brief Returns a vector<double> of the cellDimensions of the given cell ID
           in natural order of dimensions, e.g., dx/dy/dz, or dr/r*dPhi
@@ -108,8 +115,12 @@ namespace dd4hep {
       double _offsetZ;
       /// the field name used for X
       std::string _xId;
+      /// the resolved field handle of _xId
+      BitFieldHandle _xField;   //! No ROOT persistency
       /// the field name used for Z
       std::string _zId;
+      /// the resolved field handle of _zId
+      BitFieldHandle _zField;   //! No ROOT persistency
     };
 
   } /* namespace DDSegmentation */
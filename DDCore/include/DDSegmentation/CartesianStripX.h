@@ -51,7 +51,7 @@ class CartesianStripX : public DDSegmentation::CartesianStrip {
     /// set the coordinate offset in X
     void setOffsetX(double offset) { _offsetX = offset; }
     /// set the field name used for X
-    void setFieldNameX(const std::string& fieldName) { _xId = fieldName; }
+    void setFieldNameX(const std::string& fieldName) { _xId = fieldName; resolveFieldHandles(); }
     /** \brief Returns a vector<double> of the cellDimensions of the given cell ID
         in natural order of dimensions, e.g., dx/dy/dz, or dr/r*dPhi
 
@@ -69,6 +69,8 @@ class CartesianStripX : public DDSegmentation::CartesianStrip {
     double _offsetX;
     /// the field name used for X
     std::string _xId;
+    /// the resolved field handle of _xId
+    BitFieldHandle _xField;   //! No ROOT persistency
 };
 }  // namespace DDSegmentation
 } /* namespace dd4hep */
@@ -51,6 +51,11 @@ namespace dd4hep {
        *   return Cell ID.
        */
       virtual CellID cellID(const Vector3D& aLocalPosition, const Vector3D& aGlobalPosition, const VolumeID& aVolumeID) const;
+      /// determine the local positions of n cell IDs in chunks
+      virtual void positions(const CellID* cellIDs, Vector3D* localPositions, std::size_t n) const;
+      /// determine the cell IDs of n positions in chunks
+      virtual void cellIDs(const Vector3D* localPositions, const Vector3D* globalPositions,
+                           const VolumeID* volumeIDs, CellID* cellIDs, std::size_t n) const;
       /**  Determine the pseudorapidity based on the cell ID.
        *   @param[in] aCellId ID of a cell.
        *   return Pseudorapidity.
@@ -132,12 +137,14 @@ namespace dd4hep {
        */
       inline void setFieldNameEta(const std::string& fieldName) {
         m_etaID = fieldName;
+        resolveFieldHandles();
       }
       /**  Set the field name used for azimuthal angle.
        *   @param[in] aFieldName Field name for phi.
        */
       inline void setFieldNamePhi(const std::string& fieldName) {
         m_phiID = fieldName;
+        resolveFieldHandles();
       }
 
     protected:
@@ -152,8 +159,12 @@ namespace dd4hep {
       double m_offsetPhi;
       /// the field name used for eta
       std::string m_etaID;
+      /// the resolved field handle of m_etaID
+      BitFieldHandle m_etaField;   //! No ROOT persistency
       /// the field name used for phi
       std::string m_phiID;
+      /// the resolved field handle of m_phiID
+      BitFieldHandle m_phiField;   //! No ROOT persistency
     };
   }
 }
@@ -51,6 +51,11 @@ namespace dd4hep {
        *   return Cell ID.
        */
       virtual CellID cellID(const Vector3D& aLocalPosition, const Vector3D& aGlobalPosition, const VolumeID& aVolumeID) const;
+      /// determine the local positions of n cell IDs in chunks
+      virtual void positions(const CellID* cellIDs, Vector3D* localPositions, std::size_t n) const;
+      /// determine the cell IDs of n positions in chunks
+      virtual void cellIDs(const Vector3D* localPositions, const Vector3D* globalPositions,
+                           const VolumeID* volumeIDs, CellID* cellIDs, std::size_t n) const;
       /**  Determine the radius based on the cell ID.
        *   @param[in] aCellId ID of a cell.
        *   return Radius.
@@ -91,6 +96,7 @@ namespace dd4hep {
        */
       inline void setFieldNameR(const std::string& fieldName) {
         m_rID = fieldName;
+        resolveFieldHandles();
       }
 
     private:
@@ -101,6 +107,8 @@ namespace dd4hep {
       double m_offsetR;
       /// the field name used for r
       std::string m_rID;
+      /// the resolved field handle of m_rID
+      BitFieldHandle m_rField;   //! No ROOT persistency
 
     };
   }
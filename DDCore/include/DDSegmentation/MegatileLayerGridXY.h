@@ -102,10 +102,12 @@ namespace dd4hep {
       /// set the field name used for X
       void setFieldNameX(const std::string& fieldName) {
         _xId = fieldName;
+        resolveFieldHandles();
       }
       /// set the field name used for Y
       void setFieldNameY(const std::string& fieldName) {
         _yId = fieldName;
+        resolveFieldHandles();
       }
 
       virtual std::vector<double> cellDimensions(const CellID& cellID) const;
@@ -155,12 +157,20 @@ namespace dd4hep {
       
       /// the field name used for X
       std::string _xId;
+      /// the resolved field handle of _xId
+      BitFieldHandle _xField;   //! No ROOT persistency
       /// the field name used for Y
       std::string _yId;
+      /// the resolved field handle of _yId
+      BitFieldHandle _yField;   //! No ROOT persistency
       /// encoding field used for the layer
       std::string _identifierLayer;
+      /// the resolved field handle of _identifierLayer
+      BitFieldHandle _layerField;   //! No ROOT persistency
       /// encoding field used for the wafer
       std::string _identifierWafer;
+      /// the resolved field handle of _identifierWafer
+      BitFieldHandle _waferField;   //! No ROOT persistency
 
       std::string _layerConfig;
 
@@ -39,6 +39,11 @@ namespace dd4hep {
       virtual Vector3D position(const CellID& cellID) const;
       /// determine the cell ID based on the position
       virtual CellID cellID(const Vector3D& localPosition, const Vector3D& globalPosition, const VolumeID& volumeID) const;
+      /// determine the local positions of n cell IDs in chunks
+      virtual void positions(const CellID* cellIDs, Vector3D* localPositions, std::size_t n) const;
+      /// determine the cell IDs of n positions in chunks
+      virtual void cellIDs(const Vector3D* localPositions, const Vector3D* globalPositions,
+                           const VolumeID* volumeIDs, CellID* cellIDs, std::size_t n) const;
       /// access the grid size in R
       double gridSizeR() const {
         return _gridSizeR;
@@ -82,10 +87,12 @@ namespace dd4hep {
       /// set the field name used for X
       void setFieldNameR(const std::string& fieldName) {
         _rId = fieldName;
+        resolveFieldHandles();
       }
       /// set the field name used for Y
       void setFieldNamePhi(const std::string& fieldName) {
         _phiId = fieldName;
+        resolveFieldHandles();
       }
       /** \brief Returns a vector<double> of the cellDimensions of the given cell ID
           in natural order of dimensions: dr, r*dPhi
@@ -109,8 +116,12 @@ namespace dd4hep {
       double _offsetPhi;
       /// the field name used for R
       std::string _rId;
+      /// the resolved field handle of _rId
+      BitFieldHandle _rField;   //! No ROOT persistency
       /// the field name used for Phi
       std::string _phiId;
+      /// the resolved field handle of _phiId
+      BitFieldHandle _phiField;   //! No ROOT persistency
     };
 
   } /* namespace DDSegmentation */
@@ -124,10 +124,12 @@ namespace dd4hep {
       /// set the field name used for X
       void setFieldNameR(const std::string& fieldName) {
         _rId = fieldName;
+        resolveFieldHandles();
       }
       /// set the field name used for Y
       void setFieldNamePhi(const std::string& fieldName) {
         _phiId = fieldName;
+        resolveFieldHandles();
       }
       /** \brief Returns a vector<double> of the cellDimensions of the given cell ID
           in natural order of dimensions: dr, r*dPhi
@@ -151,8 +153,12 @@ namespace dd4hep {
       double _offsetPhi;
       /// the field name used for R
       std::string _rId;
+      /// the resolved field handle of _rId
+      BitFieldHandle _rField;   //! No ROOT persistency
       /// the field name used for Phi
       std::string _phiId;
+      /// the resolved field handle of _phiId
+      BitFieldHandle _phiField;   //! No ROOT persistency
     };
 
   } /* namespace DDSegmentation */
@@ -85,10 +85,12 @@ namespace dd4hep {
       /// set the field name used for theta
       void setFieldNameTheta(const std::string& fieldName) {
         _thetaID = fieldName;
+        resolveFieldHandles();
       }
       /// set the field name used for phi
       void setFieldNamePhi(const std::string& fieldName) {
         _phiID = fieldName;
+        resolveFieldHandles();
       }
 
     protected:
@@ -102,8 +104,12 @@ namespace dd4hep {
       double _offsetPhi;
       /// the field name used for theta
       std::string _thetaID;
+      /// the resolved field handle of _thetaID
+      BitFieldHandle _thetaField;   //! No ROOT persistency
       /// the field name used for phi
       std::string _phiID;
+      /// the resolved field handle of _phiID
+      BitFieldHandle _phiField;   //! No ROOT persistency
 
     };
 
@@ -88,6 +88,20 @@ namespace dd4hep {
       /// Determine the cell ID based on the position
       virtual CellID cellID(const Vector3D& localPosition, const Vector3D& globalPosition,
                             const VolumeID& volumeID) const = 0;
+      /// Number of entries processed per chunk by the batch calls using stack buffers
+      enum { BATCH_CHUNK_SIZE = 256 };
+      /// Determine the local positions of n cell IDs. The default implementation loops over position()
+      /** Segmentations providing an optimized batch implementation must be
+       *  overridden in sub-classes changing position() as well.
+       */
+      virtual void positions(const CellID* cellIDs, Vector3D* localPositions, std::size_t n) const;
+      /// Determine the cell IDs of n positions. The default implementation loops over cellID()
+      /** All input arrays and the output array must hold n entries.
+       *  Segmentations providing an optimized batch implementation must be
+       *  overridden in sub-classes changing cellID() as well.
+       */
+      virtual void cellIDs(const Vector3D* localPositions, const Vector3D* globalPositions,
+                           const VolumeID* volumeIDs, CellID* cellIDs, std::size_t n) const;
       /// Determine the volume ID from the full cell ID by removing all local fields
       virtual VolumeID volumeID(const CellID& cellID) const;
       /// Calculates the neighbours of the given cell ID and adds them to the list of neighbours
@@ -131,6 +145,8 @@ namespace dd4hep {
           \return vector<double> in natural order of dimensions, e.g., dx/dy/dz, or dr/r*dPhi
       */
       virtual std::vector<double> cellDimensions(const CellID& cellID) const;
+      /// Resolve all registered field handles against the current decoder. Also invoked after ROOT streaming
+      void resolveFieldHandles();
 
     protected:
       /// Default constructor used by derived classes passing the encoding string
@@ -147,12 +163,23 @@ namespace dd4hep {
       /// Add a cell identifier to this segmentation. Used by derived classes to define their required identifiers
       void registerIdentifier(const std::string& nam, const std::string& desc, std::string& ident,
                               const std::string& defaultVal);
+      /// Bind a resolved field handle to the identifier string. Re-resolved whenever the decoder or the parameters change
+      void registerFieldHandle(const std::string& ident, BitFieldHandle& handle);
 
       /// Helper method to convert a bin number to a 1D position
       static double binToPosition(CellID bin, double cellSize, double offset = 0.);
       /// Helper method to convert a 1D position to a cell ID
       static int positionToBin(double position, double cellSize, double offset = 0.);
 
+      /// Batch helper: convert n 1D positions to bins
+      static void positionsToBins(const double* positions, long64* bins, std::size_t n,
+                                  double cellSize, double offset = 0.);
+      /// Batch helper: decode the bins of one field of n cell IDs and convert them to 1D positions
+      static void binsToPositions(const BitFieldHandle& field, const CellID* cellIDs, double* positions,
+                                  std::size_t n, double cellSize, double offset = 0.);
+      /// Batch helper: encode n bins into one field of the cell IDs. Returns false if any bin is out of range
+      static bool encodeBins(const BitFieldHandle& field, const long64* bins, CellID* cellIDs, std::size_t n);
+
       /// Helper method to convert a bin number to a 1D position given a vector of binBoundaries
       static double binToPosition(CellID bin, std::vector<double> const& cellBoundaries, double offset = 0.);
       /// Helper method to convert a 1D position to a cell ID given a vector of binBoundaries
@@ -168,6 +195,8 @@ namespace dd4hep {
       std::map<std::string, Parameter> _parameters;   //! No ROOT persistency
       /// The indices used for the encoding
       std::map<std::string, StringParameter> _indexIdentifiers;   //! No ROOT persistency
+      /// The field handles bound to identifier strings
+      std::vector<std::pair<const std::string*, BitFieldHandle*> > _fieldHandles;   //! No ROOT persistency
       /// The cell ID encoder and decoder
       const BitFieldCoder* _decoder = 0;
       /// Keeps track of the decoder ownership
@@ -21,6 +21,7 @@
 #ifndef DDSEGMENTATION_SEGMENTATIONPARAMETER_H
 #define DDSEGMENTATION_SEGMENTATIONPARAMETER_H
 
+#include <functional>
 #include <sstream>
 #include <string>
 #include <typeinfo>
@@ -147,6 +148,10 @@ namespace dd4hep {
         }
         return s.str();
       }
+      /// Install a callback invoked whenever the value is changed
+      void setChangedCallback(std::function<void()> callback) {
+        _changed = std::move(callback);
+      }
     protected:
       /// Default constructor used by derived classes
       SegmentationParameter(const std::string& nam, const std::string& desc, UnitType unitTyp = NoUnit,
@@ -161,6 +166,13 @@ namespace dd4hep {
       UnitType _unitType;
       /// Store if parameter is optional
       bool _isOptional;
+      /// Callback invoked whenever the value is changed
+      std::function<void()> _changed;   //! No ROOT persistency
+
+      /// Notify the owner that the value was changed
+      void changed() {
+        if ( _changed ) _changed();
+      }
     };
 
     /// Concrete class to hold a segmentation parameter of a given type with its description
@@ -189,6 +201,7 @@ namespace dd4hep {
       /// Set the parameter value
       void setTypedValue(const TYPE& val) {
         *_value = val;
+        changed();
       }
 
       /// Access to the parameter default value
@@ -213,6 +226,7 @@ namespace dd4hep {
         std::stringstream s;
         s << val;
         s >> *_value;
+        changed();
       }
 
       /// Access to the parameter default value in string representation
@@ -253,6 +267,7 @@ namespace dd4hep {
       /// Set the parameter value
       void setTypedValue(const std::vector<TYPE>& val) {
         *_value = val;
+        changed();
       }
 
       /// Access to the parameter default value
@@ -290,6 +305,7 @@ namespace dd4hep {
             _value->emplace_back(entry);
           }
         }
+        changed();
       }
 
       /// Access to the parameter default value in string representation
@@ -113,14 +113,17 @@ namespace dd4hep {
       /// set the field name used for X
       void setFieldNameX(const std::string& fieldName) {
         _xId = fieldName;
+        resolveFieldHandles();
       }
       /// set the field name used for Y
       void setFieldNameY(const std::string& fieldName) {
         _yId = fieldName;
+        resolveFieldHandles();
       }
       /// set the field name used for Y
       void setFieldNameLayer(const std::string& fieldName) {
         _identifierLayer= fieldName;
+        resolveFieldHandles();
       }
       /// set the layer boundary dimension for X
       void setBoundaryLayerX(double halfX)
@@ -154,10 +157,16 @@ namespace dd4hep {
       double _offsetY;
       /// the field name used for X
       std::string _xId;
+      /// the resolved field handle of _xId
+      BitFieldHandle _xField;   //! No ROOT persistency
       /// the field name used for Y
       std::string _yId;
+      /// the resolved field handle of _yId
+      BitFieldHandle _yField;   //! No ROOT persistency
       /// encoding field used for the layer
       std::string _identifierLayer; 
+      /// the resolved field handle of _identifierLayer
+      BitFieldHandle _layerField;   //! No ROOT persistency
       /// list of layer x offset
       std::vector<double> _layerOffsetX;
       /// list of layer y offset
@@ -93,14 +93,17 @@ namespace dd4hep {
       /// set the encoding field name used for X
       void setIdentifierX(const std::string& fieldName) {
         _identifierX = fieldName;
+        resolveFieldHandles();
       }
       /// set the encoding field name used for Y
       void setIdentifierY(const std::string& fieldName) {
         _identifierY = fieldName;
+        resolveFieldHandles();
       }
       /// set the encoding field name used for layer
       void setIdentifierLayer(const std::string& fieldName) {
         _identifierLayer = fieldName;
+        resolveFieldHandles();
       }
 
       /// set the dimensions of the given layer
@@ -112,8 +115,11 @@ namespace dd4hep {
       double _gridSizeX; /// default grid size in X
       double _gridSizeY; /// default grid size in Y
       std::string _identifierX; /// encoding field used for X
+      BitFieldHandle _xField; //! resolved field handle of _identifierX. No ROOT persistency
       std::string _identifierY; /// encoding field used for Y
+      BitFieldHandle _yField; //! resolved field handle of _identifierY. No ROOT persistency
       std::string _identifierLayer; /// encoding field used for the layer
+      BitFieldHandle _layerField; //! resolved field handle of _identifierLayer. No ROOT persistency
       std::vector<int> _layerIndices; /// list of valid layer identifiers
       std::vector<double> _layerDimensionsX; /// list of layer x dimensions
       std::vector<double> _layerDimensionsY; /// list of layer y dimensions
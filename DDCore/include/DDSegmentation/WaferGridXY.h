@@ -102,10 +102,12 @@ namespace dd4hep {
       /// set the field name used for X
       void setFieldNameX(const std::string& fieldName) {
         _xId = fieldName;
+        resolveFieldHandles();
       }
       /// set the field name used for Y
       void setFieldNameY(const std::string& fieldName) {
         _yId = fieldName;
+        resolveFieldHandles();
       }
       /** \brief Returns a vector<double> of the cellDimensions of the given cell ID
           in natural order of dimensions, e.g., dx/dy/dz, or dr/r*dPhi
@@ -133,12 +135,20 @@ namespace dd4hep {
       double _waferOffsetY[MAX_GROUPS][MAX_WAFERS];
       /// the field name used for X
       std::string _xId;
+      /// the resolved field handle of _xId
+      BitFieldHandle _xField;   //! No ROOT persistency
       /// the field name used for Y
       std::string _yId;
+      /// the resolved field handle of _yId
+      BitFieldHandle _yField;   //! No ROOT persistency
       /// encoding field used for the Magic Wafer group
       std::string _identifierMGWaferGroup; 
+      /// the resolved field handle of _identifierMGWaferGroup
+      BitFieldHandle _mgWaferGroupField;   //! No ROOT persistency
       /// encoding field used for the wafer
       std::string _identifierWafer; 
+      /// the resolved field handle of _identifierWafer
+      BitFieldHandle _waferField;   //! No ROOT persistency
     };
 
   } /* namespace DDSegmentation */
@@ -23,6 +23,9 @@
 #include "DD4hep/AlignmentsCalculator.h"
 #include "DD4hep/detail/AlignmentsInterna.h"
 
+// C/C++ include files
+#include <unordered_map>
+
 using namespace dd4hep;
 using namespace dd4hep::align;
 typedef AlignmentsCalculator::Result Result;
@@ -57,6 +60,14 @@ namespace dd4hep {
         ~Calculator() = default;
         /// Compute all alignment conditions of the lower levels
         Result compute(Context& context, Entry& entry) const;
+        /// Compute the alignment condition of one entry given the parent transformation
+        Result compute(Context& context, Entry& entry, const TGeoHMatrix& parent_transform) const;
+        /// Re-use the previous result of an entry if neither delta nor parent changed
+        Result update(Context& context, Entry& entry,
+                      AlignmentsCalculator::Snapshot& previous,
+                      AlignmentsCalculator::Snapshot& current) const;
+        /// Access the world transformation of the parent of a detector element
+        void parent_transformation(Context& context, DetElement det, TGeoHMatrix& transform) const;
         /// Resolve child dependencies for a given context
         void resolve(Context& context, DetElement child) const;
       };
@@ -97,7 +108,46 @@ namespace dd4hep {
           except("AlignContext","Failed to add entry: invalid detector handle!");
         }
       };
+
+      /// Check if two deltas describe the same transformation
+      bool same_delta(const Delta& a, const Delta& b)  {
+        return a.flags == b.flags && a.translation == b.translation &&
+          a.rotation == b.rotation && a.pivot == b.pivot;
+      }
+
+      /// Check if two transformation matrices are identical
+      bool same_matrix(const TGeoHMatrix& a, const TGeoHMatrix& b)  {
+        const Double_t *ta = a.GetTranslation(), *tb = b.GetTranslation();
+        const Double_t *ra = a.GetRotationMatrix(), *rb = b.GetRotationMatrix();
+        for( int i=0; i<3; ++i )
+          if ( ta[i] != tb[i] ) return false;
+        for( int i=0; i<9; ++i )
+          if ( ra[i] != rb[i] ) return false;
+        return true;
+      }
     }
+
+    /// Result of the previous incremental computation
+    /**
+     *  For every computed detector element the delta, the parent transformation
+     *  and the resulting transformations are kept.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_ALIGNMENTS
+     */
+    class AlignmentsCalculator::Snapshot  {
+    public:
+      class Node  {
+      public:
+        Delta       delta;
+        TGeoHMatrix parentTrafo;
+        TGeoHMatrix detectorTrafo;
+        TGeoHMatrix worldTrafo;
+        Transform3D trToWorld;
+      };
+      std::unordered_map<const DetElement::Object*, Node> nodes;
+    };
   }       /* End namespace align */
 }         /* End namespace dd4hep     */
 
@@ -105,6 +155,10 @@ namespace dd4hep {
 //static PrintLevel s_PRINT = INFO;
 static PrintLevel s_PRINT = WARNING;
 
+/// Default destructor
+AlignmentsCalculator::~AlignmentsCalculator()   {
+}
+
 /// Callback to output alignments information
 int AlignmentsCalculator::Scanner::operator()(DetElement de, int)  const  {
   if ( de.isValid() )  {
@@ -120,15 +174,38 @@ int AlignmentsCalculator::Scanner::operator()(DetElement de, int)  const  {
   return 0;  
 }
 
+/// Access the world transformation of the parent of a detector element
+void Calculator::parent_transformation(Context& context, DetElement det, TGeoHMatrix& transform)  const  {
+  DetElement parent_det = det.parent();
+  AlignmentCondition parent_cond = context.mapping.get(parent_det, Keys::alignmentKey);
+  if (parent_cond.isValid()) {
+    AlignmentData&     parent_align = parent_cond.data();
+    transform = parent_align.worldTrafo;
+  }
+  else if ( parent_det.isValid() )   {
+    transform = parent_det.nominal().worldTransformation();
+  }
+  else {
+    // The tranformation from the "world" to its parent is non-existing i.e. unity
+  }
+}
+
 /// Compute all alignment conditions of the lower levels
 Result Calculator::compute(Context& context, Entry& e)   const  {
-  Result result;
-  DetElement det = e.det;
-
   if ( e.valid == 1 )  {
+    DetElement det = e.det;
     printout(DEBUG,"ComputeAlignment","================ IGNORE %s (already valid)",det.path().c_str());
-    return result;
+    return Result();
   }
+  TGeoHMatrix parent_transform;
+  parent_transformation(context, e.det, parent_transform);
+  return compute(context, e, parent_transform);
+}
+
+/// Compute the alignment condition of one entry given the parent transformation
+Result Calculator::compute(Context& context, Entry& e, const TGeoHMatrix& parent_transform)   const  {
+  Result result;
+  DetElement det = e.det;
   AlignmentCondition c = context.mapping.get(det, Keys::alignmentKey);
   AlignmentCondition cond = c.isValid() ? c : AlignmentCondition(det.path()+"#alignment");
   AlignmentData&     align = cond.data();
@@ -144,23 +221,11 @@ Result Calculator::compute(Context& context, Entry& e)   const  {
   result.multiply += 2;
 
   DetElement parent_det = det.parent();
-  AlignmentCondition parent_cond = context.mapping.get(parent_det, Keys::alignmentKey);
-  TGeoHMatrix parent_transform;
-  if (parent_cond.isValid()) {
-    AlignmentData&     parent_align = parent_cond.data();
-    parent_transform = parent_align.worldTrafo;
-  }
-  else if ( det.parent().isValid() )   {
-    parent_transform = parent_det.nominal().worldTransformation();
-  }
-  else {
-    // The tranformation from the "world" to its parent is non-existing i.e. unity
-  }
-
   align.detectorTrafo = det.nominal().detectorTransformation() * transform_for_delta;
   align.worldTrafo    = parent_transform * align.detectorTrafo;
   align.trToWorld     = detail::matrix::_transform(&align.worldTrafo);
   ++result.computed;
+  ++result.recomputed;
   result.multiply += 3;
   // Update mapping if the condition is freshly created
   if ( !c.isValid() )  {
@@ -189,6 +254,56 @@ Result Calculator::compute(Context& context, Entry& e)   const  {
   return result;
 }
 
+/// Re-use the previous result of an entry if neither delta nor parent changed
+Result Calculator::update(Context& context, Entry& e,
+                          AlignmentsCalculator::Snapshot& previous,
+                          AlignmentsCalculator::Snapshot& current)  const
+{
+  if ( e.valid == 1 )  {
+    return Result();
+  }
+  const Delta* delta = e.delta ? e.delta : &identity_delta;
+  TGeoHMatrix  parent_transform;
+  parent_transformation(context, e.det, parent_transform);
+
+  auto iprev = previous.nodes.find(e.det);
+  if ( iprev == previous.nodes.end() ||
+       !same_delta(iprev->second.delta, *delta) ||
+       !same_matrix(iprev->second.parentTrafo, parent_transform) )  {
+    Result result = compute(context, e, parent_transform);
+    const AlignmentData& align = e.cond->values();
+    auto& node = current.nodes[e.det];
+    node.delta         = *delta;
+    node.parentTrafo   = parent_transform;
+    node.detectorTrafo = align.detectorTrafo;
+    node.worldTrafo    = align.worldTrafo;
+    node.trToWorld     = align.trToWorld;
+    return result;
+  }
+  // Nothing changed: copy the transformations of the previous call
+  Result result;
+  DetElement det = e.det;
+  const auto& node = iprev->second;
+  AlignmentCondition c = context.mapping.get(det, Keys::alignmentKey);
+  AlignmentCondition cond = c.isValid() ? c : AlignmentCondition(det.path()+"#alignment");
+  AlignmentData&     align = cond.data();
+  e.valid             = 1;
+  e.cond              = cond.ptr();
+  align.delta         = node.delta;
+  align.detectorTrafo = node.detectorTrafo;
+  align.worldTrafo    = node.worldTrafo;
+  align.trToWorld     = node.trToWorld;
+  ++result.computed;
+  if ( !c.isValid() )  {
+    e.created = 1;
+    cond->flags |= Condition::ALIGNMENT_DERIVED;
+    cond->hash = ConditionKey(e.det,Keys::alignmentKey).hash;
+    context.mapping.insert(e.det, Keys::alignmentKey, cond);
+  }
+  current.nodes.emplace(e.det, std::move(iprev->second));
+  return result;
+}
+
 /// Resolve child dependencies for a given context
 void Calculator::resolve(Context& context, DetElement detector) const   {
   auto children = detector.children();
@@ -214,6 +329,42 @@ Result AlignmentsCalculator::compute(const OrderedDeltas& deltas,
   return result;
 }
 
+/// Incremental mode using already properly ordered Deltas
+Result AlignmentsCalculator::compute_incremental(const OrderedDeltas& deltas,
+                                                 ConditionsMap& alignments)
+{
+  Result     result;
+  Calculator obj;
+  Calculator::Context context(alignments);
+  std::unique_ptr<Snapshot> current(new Snapshot());
+  if ( !m_snapshot ) m_snapshot.reset(new Snapshot());
+  for( const auto& i : deltas )
+    context.insert(i.first, i.second);
+  for( const auto& i : deltas )
+    obj.resolve(context,i.first);
+  current->nodes.reserve(context.entries.size());
+  for( auto& i : context.entries )
+    result += obj.update(context, i, *m_snapshot, *current);
+  // Elements no longer present are dropped: they must be recomputed when they re-appear
+  m_snapshot = std::move(current);
+  return result;
+}
+
+/// Incremental mode: only recompute the alignments of changed detector elements
+Result AlignmentsCalculator::compute_incremental(const std::map<DetElement, Delta>& deltas,
+                                                 ConditionsMap& alignments)
+{
+  OrderedDeltas ordered_deltas;
+  for( const auto& i : deltas )
+    ordered_deltas.emplace(i.first, &i.second);
+  return compute_incremental(ordered_deltas, alignments);
+}
+
+/// Drop the result of the previous incremental computation
+void AlignmentsCalculator::reset()   {
+  m_snapshot.reset();
+}
+
 /// Compute all alignment conditions of the internal dependency list
 Result AlignmentsCalculator::compute(const std::map<DetElement, Delta>& deltas,
                                      ConditionsMap& alignments)  const
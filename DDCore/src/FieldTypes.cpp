@@ -12,8 +12,24 @@
 //==========================================================================
 
 #include "DD4hep/FieldTypes.h"
+#include "DD4hep/Printout.h"
+#include "DD4hep/DD4hepUnits.h"
 #include "DD4hep/detail/Handle.inl"
+
+// ROOT include files
+#include <TGeoBBox.h>
+
+// C/C++ include files
+#include <map>
+#include <algorithm>
 #include <cmath>
+#include <mutex>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 using namespace std;
 using namespace dd4hep;
@@ -37,6 +53,7 @@ DD4HEP_INSTANTIATE_HANDLE(ConstantField);
 DD4HEP_INSTANTIATE_HANDLE(SolenoidField);
 DD4HEP_INSTANTIATE_HANDLE(DipoleField);
 DD4HEP_INSTANTIATE_HANDLE(MultipoleField);
+DD4HEP_INSTANTIATE_HANDLE(FieldMap);
 
 /// Compute  the field components at a given location and add to given field
 void ConstantField::fieldComponents(const double* /* pos */, double* field) {
@@ -65,6 +82,16 @@ void SolenoidField::fieldComponents(const double* pos, double* field) {
   }
 }
 
+/// Bounding box of the region where the field is non-zero
+bool SolenoidField::boundingBox(double* lower, double* upper) const  {
+  double radius = outerField != 0e0 ? std::max(innerRadius, outerRadius) : innerRadius;
+  lower[0] = lower[1] = -radius;
+  upper[0] = upper[1] =  radius;
+  lower[2] = minZ;
+  upper[2] = maxZ;
+  return true;
+}
+
 /// Initializing constructor
 DipoleField::DipoleField() : zmax(INFINITY), zmin(-INFINITY), rmax(INFINITY) {
   field_type = CartesianField::MAGNETIC;
@@ -91,6 +118,15 @@ void DipoleField::fieldComponents(const double* pos, double* field) {
   }
 }
 
+/// Bounding box of the region where the field is non-zero
+bool DipoleField::boundingBox(double* lower, double* upper) const  {
+  lower[0] = lower[1] = -rmax;
+  upper[0] = upper[1] =  rmax;
+  lower[2] = zmin;
+  upper[2] = zmax;
+  return true;
+}
+
 namespace   {
   constexpr static unsigned char FIELD_INITIALIZED   = 1<<0;
   constexpr static unsigned char FIELD_IDENTITY      = 1<<1;
@@ -167,3 +203,240 @@ void MultipoleField::fieldComponents(const double* pos, double* field) {
     field[2] += f.Z();
   }
 }
+
+/// Bounding box of the region where the field is non-zero
+bool MultipoleField::boundingBox(double* lower, double* upper) const  {
+  const TGeoBBox* box = dynamic_cast<const TGeoBBox*>(volume.ptr());
+  if ( !box ) return false;   // No boundary volume: the field is unbounded
+  const double* o = box->GetOrigin();
+  const double  d[3] = { box->GetDX(), box->GetDY(), box->GetDZ() };
+  for( int i = 0; i < 8; ++i )  {
+    Transform3D::Point corner(o[0] + ((i&1) ? d[0] : -d[0]),
+                              o[1] + ((i&2) ? d[1] : -d[1]),
+                              o[2] + ((i&4) ? d[2] : -d[2]));
+    Transform3D::Point p = this->transform * corner;
+    const double c[3] = { p.X(), p.Y(), p.Z() };
+    for( int j = 0; j < 3; ++j )  {
+      lower[j] = i == 0 ? c[j] : std::min(lower[j], c[j]);
+      upper[j] = i == 0 ? c[j] : std::max(upper[j], c[j]);
+    }
+  }
+  return true;
+}
+
+/// Memory mapped field map file
+/**
+ *  The mapping is shared by all field maps using the same file.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \ingroup DD4HEP_CORE
+ */
+class FieldMap::Mapping  {
+public:
+  /// Name of the mapped file
+  std::string   name;
+  /// Start of the mapped memory
+  void*         address  { MAP_FAILED };
+  /// Size of the mapped memory
+  std::size_t   length   { 0 };
+
+  /// Initializing constructor: map the file to memory
+  Mapping(const std::string& file_name) : name(file_name)  {
+    int fd = ::open(name.c_str(), O_RDONLY);
+    if ( fd < 0 )  {
+      except("FieldMap","+++ Cannot open field map file %s: %s",
+             name.c_str(), std::strerror(errno));
+    }
+    struct stat st;
+    if ( ::fstat(fd, &st) == 0 && st.st_size > 0 )  {
+      length  = st.st_size;
+      address = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    int err = errno;
+    ::close(fd);
+    if ( address == MAP_FAILED )  {
+      except("FieldMap","+++ Cannot map field map file %s to memory: %s",
+             name.c_str(), std::strerror(err));
+    }
+  }
+  /// Default destructor
+  ~Mapping()  {
+    if ( address != MAP_FAILED ) ::munmap(address, length);
+  }
+  /// Access the file header
+  const Header* header()  const   {
+    return reinterpret_cast<const Header*>(address);
+  }
+  /// Access an already mapped file or map it
+  static std::shared_ptr<const Mapping> open(const std::string& file_name)  {
+    static std::mutex lock;
+    static std::map<std::string, std::weak_ptr<const Mapping> > mappings;
+    std::lock_guard<std::mutex> guard(lock);
+    auto& entry = mappings[file_name];
+    std::shared_ptr<const Mapping> m = entry.lock();
+    if ( !m )  {
+      m = std::make_shared<const Mapping>(file_name);
+      entry = m;
+    }
+    return m;
+  }
+};
+
+/// Initializing constructor
+FieldMap::FieldMap()   {
+  field_type = CartesianField::MAGNETIC;
+}
+
+/// Default destructor
+FieldMap::~FieldMap()   {
+}
+
+/// Map the binary field map file to memory
+void FieldMap::load(const std::string& file_name)   {
+  std::shared_ptr<const Mapping> m = Mapping::open(file_name);
+  const Header* hdr = m->header();
+  if ( m->length < sizeof(Header) || 0 != std::strncmp(hdr->magic, "DD4HFMAP", sizeof(hdr->magic)) )  {
+    except("FieldMap","+++ The file %s is no valid field map.", file_name.c_str());
+  }
+  if ( hdr->version != 1 || hdr->coordinates > CYLINDRICAL )  {
+    except("FieldMap","+++ The field map %s has an unsupported version (%u) or coordinate system (%u).",
+           file_name.c_str(), hdr->version, hdr->coordinates);
+  }
+  std::size_t num_points = 1;
+  for( int i = 0; i < 3; ++i )  {
+    if ( hdr->points[i] < 1 || (hdr->points[i] > 1 && !(hdr->upper[i] > hdr->lower[i])) )  {
+      except("FieldMap","+++ The field map %s has an invalid grid: %u points in [%g, %g]",
+             file_name.c_str(), hdr->points[i], hdr->lower[i], hdr->upper[i]);
+    }
+    num_points *= hdr->points[i];
+  }
+  if ( m->length < sizeof(Header) + 3*num_points*sizeof(float) )  {
+    except("FieldMap","+++ The field map %s is truncated: %ld bytes for %ld grid points.",
+           file_name.c_str(), long(m->length), long(num_points));
+  }
+  coordinates = int(hdr->coordinates);
+  for( int i = 0; i < 3; ++i )  {
+    // Phi stays in radian, all other coordinates are lengths
+    double unit = (coordinates == CYLINDRICAL && i == 1) ? dd4hep::rad : dd4hep::mm;
+    points[i]   = hdr->points[i];
+    lower[i]    = hdr->lower[i] * unit;
+    upper[i]    = hdr->upper[i] * unit;
+    inv_step[i] = points[i] > 1 ? double(points[i]-1) / (upper[i] - lower[i]) : 0e0;
+  }
+  // The last phi cell closes the circle if it has the size of the other cells
+  periodic  = false;
+  if ( coordinates == CYLINDRICAL && points[1] > 1 )  {
+    double step = 1e0 / inv_step[1];
+    periodic = std::abs(upper[1] - lower[1] + step - 2e0*M_PI) < 1e-3 * step;
+  }
+  stride[0] = 3;
+  stride[1] = 3 * points[0];
+  stride[2] = 3 * points[0] * points[1];
+  values    = reinterpret_cast<const float*>(hdr + 1);
+  mapping   = std::move(m);
+  file      = file_name;
+  printout(INFO,"FieldMap","+++ Mapped %s field map %s: %ld x %ld x %ld grid points.",
+           coordinates == CYLINDRICAL ? "cylindrical" : "Cartesian",
+           file_name.c_str(), points[0], points[1], points[2]);
+}
+
+/// Bounding box of the region where the field is non-zero
+bool FieldMap::boundingBox(double* lo, double* up) const  {
+  if ( !values ) return false;
+  // Along a coordinate with a single grid point the field is constant: unbounded
+  for( int i = 0; i < 3; ++i )  {
+    if ( points[i] < 2 && !(coordinates == CYLINDRICAL && i == 1) ) return false;
+  }
+  if ( coordinates == CYLINDRICAL )  {
+    lo[0] = lo[1] = -upper[0];
+    up[0] = up[1] =  upper[0];
+    lo[2] = lower[2];
+    up[2] = upper[2];
+    return true;
+  }
+  for( int i = 0; i < 3; ++i )  {
+    lo[i] = lower[i];
+    up[i] = upper[i];
+  }
+  return true;
+}
+
+/// Compute  the field components at a given location and add to given field
+void FieldMap::fieldComponents(const double* pos, double* field) {
+  if ( !values ) return;
+  double u[3], phi = 0e0;
+  if ( coordinates == CYLINDRICAL )  {
+    phi  = std::atan2(pos[1], pos[0]);
+    u[0] = std::sqrt(pos[0]*pos[0] + pos[1]*pos[1]);
+    u[1] = phi;
+    if ( points[1] > 1 )  {
+      if      ( u[1] < lower[1] ) u[1] += 2e0*M_PI;
+      else if ( u[1] > (periodic ? lower[1] + 2e0*M_PI : upper[1]) ) u[1] -= 2e0*M_PI;
+    }
+    u[2] = pos[2];
+  }
+  else  {
+    u[0] = pos[0];
+    u[1] = pos[1];
+    u[2] = pos[2];
+  }
+  // Locate the grid cell and the fractional position within the cell
+  long   offset = 0, delta[3];
+  double t[3];
+  for( int i = 0; i < 3; ++i )  {
+    if ( i == 1 && periodic )  {
+      // Periodic phi: the last cell interpolates between the last and the first point
+      double x   = (u[i] - lower[i]) * inv_step[i];
+      long   idx = std::max(std::min(long(x), points[i]-1), 0L);
+      t[i]       = x - double(idx);
+      delta[i]   = idx == points[i]-1 ? -idx * stride[i] : stride[i];
+      offset    += idx * stride[i];
+    }
+    else if ( points[i] > 1 )  {
+      if ( u[i] < lower[i] || u[i] > upper[i] ) return;
+      double x   = (u[i] - lower[i]) * inv_step[i];
+      long   idx = std::min(long(x), points[i]-2);
+      t[i]       = x - double(idx);
+      delta[i]   = stride[i];
+      offset    += idx * stride[i];
+    }
+    else  {
+      // Single grid point: the field is constant along this coordinate
+      t[i]     = 0e0;
+      delta[i] = 0;
+    }
+  }
+  // Trilinear interpolation: weights and value offsets of the 8 cell corners
+  const double w[8] = {
+    (1e0-t[0])*(1e0-t[1])*(1e0-t[2]), t[0]*(1e0-t[1])*(1e0-t[2]),
+    (1e0-t[0])*t[1]*(1e0-t[2]),       t[0]*t[1]*(1e0-t[2]),
+    (1e0-t[0])*(1e0-t[1])*t[2],       t[0]*(1e0-t[1])*t[2],
+    (1e0-t[0])*t[1]*t[2],             t[0]*t[1]*t[2]
+  };
+  const long o[8] = {
+    0,                          delta[0],
+    delta[1],                   delta[0]+delta[1],
+    delta[2],                   delta[0]+delta[2],
+    delta[1]+delta[2],          delta[0]+delta[1]+delta[2]
+  };
+  const float* v = values + offset;
+  double b[3] = { 0e0, 0e0, 0e0 };
+  for( int c = 0; c < 8; ++c )  {
+    const float* p = v + o[c];
+    b[0] += w[c] * p[0];
+    b[1] += w[c] * p[1];
+    b[2] += w[c] * p[2];
+  }
+  if ( coordinates == CYLINDRICAL )  {
+    // Rotate (B_r, B_phi) to (B_x, B_y)
+    double cp = std::cos(phi), sp = std::sin(phi);
+    double bx = b[0]*cp - b[1]*sp;
+    double by = b[0]*sp + b[1]*cp;
+    b[0] = bx;
+    b[1] = by;
+  }
+  field[0] += b[0] * dd4hep::tesla;
+  field[1] += b[1] * dd4hep::tesla;
+  field[2] += b[2] * dd4hep::tesla;
+}
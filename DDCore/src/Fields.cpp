@@ -16,6 +16,12 @@
 #include "DD4hep/InstanceCount.h"
 #include "DD4hep/detail/Handle.inl"
 
+// C/C++ include files
+#include <cmath>
+#include <atomic>
+#include <memory>
+#include <algorithm>
+
 using namespace std;
 using namespace dd4hep;
 
@@ -25,10 +31,211 @@ DD4HEP_INSTANTIATE_HANDLE(CartesianFieldObject);
 typedef OverlayedField::Object OverlayedFieldObject;
 DD4HEP_INSTANTIATE_HANDLE(OverlayedFieldObject);
 
+/// Spatial index of the field components of an overlayed field
+/**
+ *  The bounding boxes of the bounded field components define a coarse
+ *  3D grid. Each grid cell holds the list of components with a bounding
+ *  box overlapping the cell. Unbounded components are part of every cell
+ *  and of the region outside the grid.
+ *
+ *  Consecutive lookups are mostly close to each other. Each thread hence
+ *  remembers the last visited cell and checks it first. The electric and
+ *  the magnetic index have separate cache slots, since combined field
+ *  lookups use both alternately.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \ingroup DD4HEP_CORE
+ */
+class OverlayedField::Object::Index  {
+public:
+  typedef CartesianField::Object Component;
+
+  /// Maximal number of grid cells along each axis
+  static constexpr long MAX_CELLS = 32;
+  /// Thread local cache slots: the electric and the magnetic index are used alternately
+  enum Slot  {  ELECTRIC_SLOT = 0, MAGNETIC_SLOT = 1, NUM_SLOTS = 2  };
+
+  /// Unique identifier to validate the thread local cache
+  unsigned long       id          { 0 };
+  /// Slot of the thread local cache used by this index
+  int                 slot        { ELECTRIC_SLOT };
+  /// Number of grid cells along each axis
+  long                cells[3]    { 1, 1, 1 };
+  /// Lower corner of the grid
+  double              lower[3]    { 0e0, 0e0, 0e0 };
+  /// Upper corner of the grid
+  double              upper[3]    { 0e0, 0e0, 0e0 };
+  /// Cell size along each axis
+  double              step[3]     { 0e0, 0e0, 0e0 };
+  /// Inverse cell size along each axis
+  double              inv_step[3] { 0e0, 0e0, 0e0 };
+  /// Start of the component list of each cell in 'members'. The last entry is the end
+  vector<unsigned int> offsets;
+  /// Component lists of all cells. The list of the outside region comes last
+  vector<Component*>  members;
+  /// Start of the component list of the region outside the grid
+  size_t              outside     { 0 };
+
+  /// Thread local cache of the last visited cell
+  struct Cache  {
+    unsigned long     id          { 0 };
+    double            lower[3]    { 0e0, 0e0, 0e0 };
+    double            upper[3]    { 0e0, 0e0, 0e0 };
+    Component* const* begin       { nullptr };
+    Component* const* end         { nullptr };
+  };
+
+  /// Build the index. Returns null if the components have no bounded region
+  static Index* build(const vector<CartesianField>& components, Slot slot);
+
+  /// Add the field of all components contributing at the given position
+  void evaluate(const double* pos, double* field)  const  {
+    static thread_local Cache caches[NUM_SLOTS];
+    Cache& cache = caches[slot];
+    if ( cache.id != id ||
+         pos[0] <  cache.lower[0] || pos[0] >= cache.upper[0] ||
+         pos[1] <  cache.lower[1] || pos[1] >= cache.upper[1] ||
+         pos[2] <  cache.lower[2] || pos[2] >= cache.upper[2] )  {
+      locate(pos, cache);
+    }
+    for( Component* const* c = cache.begin; c != cache.end; ++c )
+      (*c)->fieldComponents(pos, field);
+  }
+
+  /// Find the cell of the given position and fill the cache
+  void locate(const double* pos, Cache& cache)  const;
+};
+constexpr long OverlayedField::Object::Index::MAX_CELLS;
+
 namespace {
+  /// Counter to assign unique identifiers to the spatial indices
+  std::atomic<unsigned long> s_index_counter { 0 };
+
+  /// Check if the bounding box values are usable to build a grid
+  bool finite_box(const double* lower, const double* upper)  {
+    for( int i = 0; i < 3; ++i )  {
+      if ( !(std::abs(lower[i]) < 1e20 && std::abs(upper[i]) < 1e20 && lower[i] <= upper[i]) )
+        return false;
+    }
+    return true;
+  }
+
   void calculate_combined_field(vector<CartesianField>& v, const Position& pos, double* field) {
     for (const auto& i : v ) i.value(pos, field);
   }
+
+  void calculate_combined_field(vector<CartesianField>& v,
+                                const OverlayedField::Object::Index* index,
+                                const Position& pos, double* field) {
+    if ( index )  {
+      double position[3] = { pos.X(), pos.Y(), pos.Z() };
+      index->evaluate(position, field);
+      return;
+    }
+    calculate_combined_field(v, pos, field);
+  }
+}
+
+/// Build the index. Returns null if the components have no bounded region
+OverlayedField::Object::Index*
+OverlayedField::Object::Index::build(const vector<CartesianField>& components, Slot slot)   {
+  struct Entry  {  Component* object;  bool bounded;  double lower[3], upper[3];  };
+  vector<Entry> entries;
+  double lower[3] = { 0e0, 0e0, 0e0 }, upper[3] = { 0e0, 0e0, 0e0 };
+  size_t num_bounded = 0;
+  for( const auto& c : components )  {
+    Entry e;
+    e.object  = c.data<Component>();
+    e.bounded = e.object->boundingBox(e.lower, e.upper) && finite_box(e.lower, e.upper);
+    if ( e.bounded )  {
+      for( int i = 0; i < 3; ++i )  {
+        lower[i] = num_bounded == 0 ? e.lower[i] : std::min(lower[i], e.lower[i]);
+        upper[i] = num_bounded == 0 ? e.upper[i] : std::max(upper[i], e.upper[i]);
+      }
+      ++num_bounded;
+    }
+    entries.emplace_back(e);
+  }
+  if ( components.size() < 2 || num_bounded == 0 )  {
+    return nullptr;
+  }
+  unique_ptr<Index> idx(new Index());
+  idx->id   = ++s_index_counter;
+  idx->slot = slot;
+  long num_cells = 1;
+  for( int i = 0; i < 3; ++i )  {
+    double extent     = upper[i] - lower[i];
+    idx->cells[i]     = extent > 0e0 ? MAX_CELLS : 1;
+    idx->lower[i]     = lower[i];
+    idx->upper[i]     = upper[i];
+    idx->step[i]      = extent > 0e0 ? extent / double(idx->cells[i]) : 0e0;
+    idx->inv_step[i]  = extent > 0e0 ? 1e0 / idx->step[i] : 0e0;
+    num_cells        *= idx->cells[i];
+  }
+  // Cell index of a coordinate. The boxes are widened by a small fraction of the
+  // cell size to be insensitive to rounding at the cell boundaries.
+  auto cell_index = [&idx](int axis, double x)  {
+    long c = long(std::floor((x - idx->lower[axis]) * idx->inv_step[axis]));
+    return std::max(0L, std::min(c, idx->cells[axis]-1));
+  };
+  for( auto& e : entries )  {
+    for( int i = 0; e.bounded && i < 3; ++i )  {
+      e.lower[i] -= 1e-6 * idx->step[i];
+      e.upper[i] += 1e-6 * idx->step[i];
+    }
+  }
+  idx->offsets.reserve(num_cells+2);
+  for( long iz = 0; iz < idx->cells[2]; ++iz )  {
+    for( long iy = 0; iy < idx->cells[1]; ++iy )  {
+      for( long ix = 0; ix < idx->cells[0]; ++ix )  {
+        idx->offsets.emplace_back(idx->members.size());
+        for( const auto& e : entries )  {
+          if ( !e.bounded ||
+               (cell_index(0, e.lower[0]) <= ix && ix <= cell_index(0, e.upper[0]) &&
+                cell_index(1, e.lower[1]) <= iy && iy <= cell_index(1, e.upper[1]) &&
+                cell_index(2, e.lower[2]) <= iz && iz <= cell_index(2, e.upper[2])) )  {
+            idx->members.emplace_back(e.object);
+          }
+        }
+      }
+    }
+  }
+  idx->outside = idx->members.size();
+  idx->offsets.emplace_back(idx->outside);
+  for( const auto& e : entries )  {
+    if ( !e.bounded ) idx->members.emplace_back(e.object);
+  }
+  idx->offsets.emplace_back(idx->members.size());
+  return idx.release();
+}
+
+/// Find the cell of the given position and fill the cache
+void OverlayedField::Object::Index::locate(const double* pos, Cache& cache)  const   {
+  long cell = 0, cell_index[3] = { 0, 0, 0 };
+  bool inside = true;
+  for( int i = 0; i < 3; ++i )  {
+    if ( !(pos[i] >= lower[i] && pos[i] <= upper[i]) )  {
+      inside = false;
+      break;
+    }
+    cell_index[i] = std::min(long((pos[i] - lower[i]) * inv_step[i]), cells[i]-1);
+  }
+  cache.id = 0;
+  if ( inside )  {
+    cell = cell_index[0] + cells[0] * (cell_index[1] + cells[1] * cell_index[2]);
+    for( int i = 0; i < 3; ++i )  {
+      // Positions on the upper grid edge fail the cache check and are located again
+      cache.lower[i] = lower[i] + double(cell_index[i]) * step[i];
+      cache.upper[i] = cell_index[i] == cells[i]-1 ? upper[i] : cache.lower[i] + step[i];
+    }
+    cache.id = id;
+  }
+  else  {
+    cell = long(offsets.size()) - 2;
+  }
+  cache.begin = members.data() + offsets[cell];
+  cache.end   = members.data() + offsets[cell+1];
 }
 
 /// Default constructor
@@ -43,6 +250,11 @@ CartesianField::Object::~Object() {
   InstanceCount::decrement(this);
 }
 
+/// Declare the region where the field is non-zero. Default: unbounded
+bool CartesianField::Object::boundingBox(double* /* lower */, double* /* upper */) const  {
+  return false;
+}
+
 /// Access the field type (string)
 const char* CartesianField::type() const {
   return m_element->GetTitle();
@@ -86,6 +298,8 @@ OverlayedField::Object::Object() : TypedObject(), electric(), magnetic()
 
 /// Default destructor
 OverlayedField::Object::~Object() {
+  delete electric_index;
+  delete magnetic_index;
   InstanceCount::decrement(this);
 }
 
@@ -120,12 +334,16 @@ void OverlayedField::add(CartesianField field) {
         v.emplace_back(field);
         o->field_type |= field.ELECTRIC;
         o->electric = (v.size() == 1) ? field : CartesianField();
+        delete o->electric_index;
+        o->electric_index = Object::Index::build(v, Object::Index::ELECTRIC_SLOT);
       }
       if (isMag) {
         vector < CartesianField > &v = o->magnetic_components;
         v.emplace_back(field);
         o->field_type |= field.MAGNETIC;
         o->magnetic = (v.size() == 1) ? field : CartesianField();
+        delete o->magnetic_index;
+        o->magnetic_index = Object::Index::build(v, Object::Index::MAGNETIC_SLOT);
       }
       if ( isMag || isEle )  {
         return;
@@ -146,7 +364,7 @@ void OverlayedField::magneticField(const Position& pos, double* field) const   {
     if ( f.isValid() )
       f.value(pos, field);
     else
-      calculate_combined_field(obj->magnetic_components, pos, field);
+      calculate_combined_field(obj->magnetic_components, obj->magnetic_index, pos, field);
     return;
   }
   except("OverlayedField","add: Attempt to add an invalid field.");
@@ -154,20 +372,22 @@ void OverlayedField::magneticField(const Position& pos, double* field) const   {
 
 /// Returns the 3 electric field components (x, y, z).
 void OverlayedField::combinedElectric(const Position& pos, double* field) const {
+  Object* o = data<Object>();
   field[0] = field[1] = field[2] = 0.;
-  calculate_combined_field(data<Object>()->electric_components, pos, field);
+  calculate_combined_field(o->electric_components, o->electric_index, pos, field);
 }
 
 /// Returns the 3  magnetic field components (x, y, z).
 void OverlayedField::combinedMagnetic(const Position& pos, double* field) const {
+  Object* o = data<Object>();
   field[0] = field[1] = field[2] = 0.;
-  calculate_combined_field(data<Object>()->magnetic_components, pos, field);
+  calculate_combined_field(o->magnetic_components, o->magnetic_index, pos, field);
 }
 
 /// Returns the 3 electric (val[0]-val[2]) and magnetic field components (val[3]-val[5]).
 void OverlayedField::electromagneticField(const Position& pos, double* field) const {
   Object* o = data<Object>();
   field[0] = field[1] = field[2] = 0.;
-  calculate_combined_field(o->electric_components, pos, field);
-  calculate_combined_field(o->magnetic_components, pos, field + 3);
+  calculate_combined_field(o->electric_components, o->electric_index, pos, field);
+  calculate_combined_field(o->magnetic_components, o->magnetic_index, pos, field + 3);
 }
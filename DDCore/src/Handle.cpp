@@ -21,7 +21,11 @@
 #include <iomanip>
 #include <climits>
 #include <cstring>
+#include <cstdlib>
 #include <cstdio>
+#include <cctype>
+#include <list>
+#include <unordered_map>
 
 #if !defined(WIN32) && !defined(__ICC)
 #include "cxxabi.h"
@@ -43,6 +47,8 @@ namespace   {
 
   /// Set true for backwards compatibility
   static bool s_allow_variable_redefine = true;
+  /// Enable the literal fast path and the cache of evaluated expressions
+  static bool s_fast_evaluation = true;
 
   ///
   void check_evaluation(const string& value, std::pair<int,double> res, stringstream& err)   {
@@ -50,6 +56,155 @@ namespace   {
       throw runtime_error("dd4hep: "+err.str()+" : value="+value+" [Evaluation error]");
     }
   }
+
+  /// Least-recently-used cache of evaluated expressions
+  /** The evaluator interprets the expression string at every call.
+   *  Evaluated values are cached per thread and validated against the
+   *  generation of the evaluator dictionary: any change of a constant,
+   *  variable or function invalidates all cached values.
+   */
+  class ExpressionCache  {
+    enum { MAX_ENTRIES = 4096 };
+    struct node_t;
+    typedef std::list<node_t>                           lru_t;
+    typedef std::unordered_map<string, lru_t::iterator> map_t;
+    /// LRU list node: the value and its map entry to drop it without a second lookup
+    struct node_t  {
+      map_t::iterator entry;
+      double          value;
+    };
+    map_t         m_entries;
+    lru_t         m_lru;
+    unsigned long m_generation { ~0UL };
+
+    void validate(unsigned long generation)  {
+      if ( generation != m_generation )  {
+        m_entries.clear();
+        m_lru.clear();
+        m_generation = generation;
+      }
+    }
+  public:
+    /// Default constructor. The map never rehashes: the iterators in the LRU list stay valid
+    ExpressionCache()  {
+      m_entries.reserve(MAX_ENTRIES);
+    }
+    /// Access a cached value. Returns false if not present or stale
+    bool lookup(const string& expression, unsigned long generation, double& value)  {
+      validate(generation);
+      auto i = m_entries.find(expression);
+      if ( i == m_entries.end() ) return false;
+      m_lru.splice(m_lru.begin(), m_lru, i->second);
+      value = i->second->value;
+      return true;
+    }
+    /// Add a value. The least recently used entry is dropped if the cache is full
+    void insert(const string& expression, unsigned long generation, double value)  {
+      validate(generation);
+      if ( m_entries.size() >= MAX_ENTRIES )  {
+        m_entries.erase(m_lru.back().entry);
+        m_lru.pop_back();
+      }
+      auto ret = m_entries.emplace(expression, m_lru.end());
+      if ( ret.second )  {
+        m_lru.push_front(node_t{ret.first, value});
+        ret.first->second = m_lru.begin();
+      }
+      ret.first->second->value = value;
+    }
+  };
+
+  /// Scan a plain decimal literal like "-1.5e3". Returns the end pointer or null if not a literal
+  /** Only the syntax, which is interpreted by the evaluator with the
+   *  same strtod call, is accepted. Everything else is left to the evaluator.
+   */
+  const char* scan_literal(const char* p)   {
+    if ( *p == '+' || *p == '-' ) ++p;
+    const char* digits = p;
+    while ( ::isdigit(*p) ) ++p;
+    bool have_digits = p != digits;
+    if ( *p == '.' )  {
+      const char* fraction = ++p;
+      while ( ::isdigit(*p) ) ++p;
+      have_digits |= p != fraction;
+    }
+    if ( !have_digits )  {
+      return nullptr;
+    }
+    if ( *p == 'e' || *p == 'E' )  {
+      const char* q = p + 1;
+      if ( *q == '+' || *q == '-' ) ++q;
+      if ( !::isdigit(*q) ) return nullptr;
+      while ( ::isdigit(*q) ) ++q;
+      p = q;
+    }
+    return p;
+  }
+
+  /// Convert a scanned literal. Returns false if strtod disagrees with the scan
+  bool convert_literal(const char* begin, const char* end, double& value)   {
+    char* last = nullptr;
+    value = ::strtod(begin, &last);
+    return last == end;
+  }
+
+  /// Fast evaluation of numeric expressions. Returns false on evaluation errors
+  /** - Plain literals like "1.5" or " -2e3 " are converted directly.
+   *  - Other expressions are looked up in the per-thread cache.
+   *  - Literals scaled by a single unit or variable like "10*cm" or "1/mm"
+   *    are computed from the (cached) value of the unit.
+   *  - Everything else is interpreted by the evaluator and cached.
+   */
+  bool evaluate_fast(const string& expression, double& value)   {
+    static thread_local ExpressionCache cache;
+    const char* begin = expression.c_str();
+    while ( ::isspace(*begin) ) ++begin;
+    const char* end = scan_literal(begin);
+    const char* p = end;
+    if ( p )  {
+      while ( ::isspace(*p) ) ++p;
+      if ( *p == 0 && convert_literal(begin, end, value) )  {
+        return true;
+      }
+    }
+    unsigned long generation = eval.generation();
+    if ( cache.lookup(expression, generation, value) )  {
+      return true;
+    }
+    if ( p && (*p == '*' || *p == '/') )  {
+      char op = *p++;
+      while ( ::isspace(*p) ) ++p;
+      const char* name = p;
+      if ( ::isalpha(*p) || *p == '_' )  {
+        while ( ::isalnum(*p) || *p == '_' || *p == ':' ) ++p;
+        const char* name_end = p;
+        while ( ::isspace(*p) ) ++p;
+        double number = 0e0, unit = 0e0;
+        if ( *p == 0 && convert_literal(begin, end, number) )  {
+          string unit_name(name, name_end);
+          bool found = cache.lookup(unit_name, generation, unit);
+          if ( !found )  {
+            auto result = eval.evaluate(unit_name);
+            if ( (found = (result.first == tools::Evaluator::OK)) )  {
+              cache.insert(unit_name, generation, unit = result.second);
+            }
+          }
+          if ( found )  {
+            value = (op == '*') ? number * unit : number / unit;
+            cache.insert(expression, generation, value);
+            return true;
+          }
+        }
+      }
+    }
+    auto result = eval.evaluate(expression);
+    if ( result.first != tools::Evaluator::OK )  {
+      return false;
+    }
+    cache.insert(expression, generation, result.second);
+    value = result.second;
+    return true;
+  }
 }
 
 namespace dd4hep  {
@@ -61,7 +216,21 @@ namespace dd4hep  {
     return tmp;
   }
 
+  /// Steer the literal fast path and the expression cache of the numeric conversions. returns old value
+  bool set_fast_evaluation(bool value)    {
+    bool tmp = s_fast_evaluation;
+    s_fast_evaluation = value;
+    return tmp;
+  }
+
   std::pair<int, double> _toFloatingPoint(const string& value)   {
+    if ( s_fast_evaluation )   {
+      double result = 0e0;
+      if ( evaluate_fast(value, result) )  {
+        return std::make_pair(int(tools::Evaluator::OK), result);
+      }
+    }
+    // Slow path and all evaluation errors: evaluate again to get the diagnostics
     stringstream err;
     auto result = eval.evaluate(value, err);
     check_evaluation(value, result, err);
@@ -69,6 +238,10 @@ namespace dd4hep  {
   }
 
   std::pair<int, double> _toInteger(const string& value)    {
+    if ( value.find("(int)") == string::npos && value.find("(long)") == string::npos )  {
+      // No casts to strip: leading blanks are ignored by the evaluator anyhow
+      return _toFloatingPoint(value);
+    }
     string s(value);
     size_t idx = s.find("(int)");
     if (idx != string::npos)
@@ -90,6 +90,24 @@ typedef dd4hep::DDSegmentation::CellID CellID;
 #pragma link C++ class dd4hep::DDSegmentation::TiledLayerSegmentation+;
 #pragma link C++ class dd4hep::DDSegmentation::WaferGridXY+;
 
+/// The bit field handles are transient: re-resolve them once the identifiers are read back
+#pragma read sourceClass="dd4hep::DDSegmentation::CartesianGridXY" targetClass="dd4hep::DDSegmentation::CartesianGridXY" version="[1-]" source="" target="" code="{ newObj->resolveFieldHandles(); }"
+#pragma read sourceClass="dd4hep::DDSegmentation::CartesianGridXYZ" targetClass="dd4hep::DDSegmentation::CartesianGridXYZ" version="[1-]" source="" target="" code="{ newObj->resolveFieldHandles(); }"
+#pragma read sourceClass="dd4hep::DDSegmentation::CartesianGridXZ" targetClass="dd4hep::DDSegmentation::CartesianGridXZ" version="[1-]" source="" target="" code="{ newObj->resolveFieldHandles(); }"
+#pragma read sourceClass="dd4hep::DDSegmentation::CartesianGridYZ" targetClass="dd4hep::DDSegmentation::CartesianGridYZ" version="[1-]" source="" target="" code="{ newObj->resolveFieldHandles(); }"
+#pragma read sourceClass="dd4hep::DDSegmentation::CartesianStripX" targetClass="dd4hep::DDSegmentation::CartesianStripX" version="[1-]" source="" target="" code="{ newObj->resolveFieldHandles(); }"
+#pragma read sourceClass="dd4hep::DDSegmentation::CartesianStripY" targetClass="dd4hep::DDSegmentation::CartesianStripY" version="[1-]" source="" target="" code="{ newObj->resolveFieldHandles(); }"
+#pragma read sourceClass="dd4hep::DDSegmentation::CartesianStripZ" targetClass="dd4hep::DDSegmentation::CartesianStripZ" version="[1-]" source="" target="" code="{ newObj->resolveFieldHandles(); }"
+#pragma read sourceClass="dd4hep::DDSegmentation::GridPhiEta" targetClass="dd4hep::DDSegmentation::GridPhiEta" version="[1-]" source="" target="" code="{ newObj->resolveFieldHandles(); }"
+#pragma read sourceClass="dd4hep::DDSegmentation::GridRPhiEta" targetClass="dd4hep::DDSegmentation::GridRPhiEta" version="[1-]" source="" target="" code="{ newObj->resolveFieldHandles(); }"
+#pragma read sourceClass="dd4hep::DDSegmentation::MegatileLayerGridXY" targetClass="dd4hep::DDSegmentation::MegatileLayerGridXY" version="[1-]" source="" target="" code="{ newObj->resolveFieldHandles(); }"
+#pragma read sourceClass="dd4hep::DDSegmentation::PolarGridRPhi2" targetClass="dd4hep::DDSegmentation::PolarGridRPhi2" version="[1-]" source="" target="" code="{ newObj->resolveFieldHandles(); }"
+#pragma read sourceClass="dd4hep::DDSegmentation::PolarGridRPhi" targetClass="dd4hep::DDSegmentation::PolarGridRPhi" version="[1-]" source="" target="" code="{ newObj->resolveFieldHandles(); }"
+#pragma read sourceClass="dd4hep::DDSegmentation::ProjectiveCylinder" targetClass="dd4hep::DDSegmentation::ProjectiveCylinder" version="[1-]" source="" target="" code="{ newObj->resolveFieldHandles(); }"
+#pragma read sourceClass="dd4hep::DDSegmentation::TiledLayerGridXY" targetClass="dd4hep::DDSegmentation::TiledLayerGridXY" version="[1-]" source="" target="" code="{ newObj->resolveFieldHandles(); }"
+#pragma read sourceClass="dd4hep::DDSegmentation::TiledLayerSegmentation" targetClass="dd4hep::DDSegmentation::TiledLayerSegmentation" version="[1-]" source="" target="" code="{ newObj->resolveFieldHandles(); }"
+#pragma read sourceClass="dd4hep::DDSegmentation::WaferGridXY" targetClass="dd4hep::DDSegmentation::WaferGridXY" version="[1-]" source="" target="" code="{ newObj->resolveFieldHandles(); }"
+
 #pragma link C++ class dd4hep::DDSegmentation::BitFieldElement+;
 #pragma link C++ class dd4hep::DDSegmentation::BitFieldCoder+;
 
@@ -20,6 +20,7 @@
 #include "DD4hep/detail/SegmentationsInterna.h"
 
 // C/C++ include files
+#include <algorithm>
 #include <iostream>
 #include <stdexcept>
 
@@ -77,6 +78,36 @@ long64 Segmentation::cellID(const Position& localPosition, const Position& globa
   return access()->segmentation->cellID(localPosition, globalPosition, volID);
 }
 
+/// determine the local positions of n cell IDs
+void Segmentation::positions(const CellID* cells, Position* local, std::size_t n) const  {
+  typedef DDSegmentation::Vector3D Vector3D;
+  const auto* seg = access()->segmentation;
+  Vector3D buff[DDSegmentation::Segmentation::BATCH_CHUNK_SIZE];
+  for( std::size_t first = 0; first < n; first += DDSegmentation::Segmentation::BATCH_CHUNK_SIZE )  {
+    std::size_t num = std::min<std::size_t>(n - first, DDSegmentation::Segmentation::BATCH_CHUNK_SIZE);
+    seg->positions(cells + first, buff, num);
+    for( std::size_t i = 0; i < num; ++i )
+      local[first + i] = Position(buff[i]);
+  }
+}
+
+/// determine the cell IDs of n local positions. All arrays must hold n entries
+void Segmentation::cellIDs(const Position* local, const Position* global,
+                           const VolumeID* volIDs, CellID* cells, std::size_t n) const  {
+  typedef DDSegmentation::Vector3D Vector3D;
+  const auto* seg = access()->segmentation;
+  Vector3D loc[DDSegmentation::Segmentation::BATCH_CHUNK_SIZE];
+  Vector3D glob[DDSegmentation::Segmentation::BATCH_CHUNK_SIZE];
+  for( std::size_t first = 0; first < n; first += DDSegmentation::Segmentation::BATCH_CHUNK_SIZE )  {
+    std::size_t num = std::min<std::size_t>(n - first, DDSegmentation::Segmentation::BATCH_CHUNK_SIZE);
+    for( std::size_t i = 0; i < num; ++i )  {
+      loc[i]  = local[first + i];
+      glob[i] = global[first + i];
+    }
+    seg->cellIDs(loc, glob, volIDs + first, cells + first, num);
+  }
+}
+
 /// Determine the volume ID from the full cell ID by removing all local fields
 VolumeID Segmentation::volumeID(const CellID& cell) const   {
   return access()->segmentation->volumeID(cell);
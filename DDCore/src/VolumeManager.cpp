@@ -23,6 +23,7 @@
 // C/C++ includes
 #include <set>
 #include <cmath>
+#include <algorithm>
 #include <sstream>
 #include <iomanip>
 
@@ -255,6 +256,7 @@ namespace dd4hep {
             context->mask       = code.second;
             context->element    = e;
             context->flag       = nodes.empty() ? 0 : 1;
+            context->segmentation = ro.segmentation();
             if ( context->flag )  {
               detail::VolumeManagerContextExtension* ext = (detail::VolumeManagerContextExtension*)context;
               ext->placement  = PlacedVolume(n);
@@ -262,6 +264,7 @@ namespace dd4hep {
                 TGeoMatrix* m = nodes[i-1]->GetMatrix();
                 ext->toElement.MultiplyLeft(m);
               }
+              ext->updateWorldTransformation();
             }
             if ( !section.adoptPlacement(context) || m_debug )  {
               print_node(sd, parent, e, n, code, nodes);
@@ -343,6 +346,15 @@ Position VolumeManagerContext::localToElement(const Position& local)  const   {
 
 /// Transform local coordinates to the world coordinates
 Position VolumeManagerContext::localToWorld(const double local[3])  const   {
+  if ( 0 == flag )
+    return element.nominal().localToWorld(local);
+  const detail::VolumeManagerContextExtension* ext = (const detail::VolumeManagerContextExtension*)this;
+  if ( ext->haveWorld )  {
+    const double* m = ext->toWorld;
+    return { m[0]*local[0] + m[1]*local[1] + m[2]*local[2] + m[9],
+             m[3]*local[0] + m[4]*local[1] + m[5]*local[2] + m[10],
+             m[6]*local[0] + m[7]*local[1] + m[8]*local[2] + m[11] };
+  }
   double elt[3];
   toElement().LocalToMaster(local, elt);
   return element.nominal().localToWorld(elt);
@@ -467,6 +479,7 @@ VolumeManager VolumeManager::addSubdetector(DetElement det, Readout ro) {
       mo.sysID   = id.second;
       mo.detMask = mo.sysID;
       o.managers[mo.sysID] = mgr;
+      o.addDispatch(field, mo.sysID, &mo);
       det.callAtUpdate(DetElement::PLACEMENT_CHANGED|DetElement::PLACEMENT_DETECTOR,
                        &mo,&Object::update);
     }
@@ -527,6 +540,7 @@ bool VolumeManager::adoptPlacement(VolumeID sys_id, VolumeManagerContext* contex
 
   if ( i == o.volumes.end()) {
     o.volumes[vid] = context;
+    o.volumeIndex[vid] = context;
     o.detMask |= mask;
     err << "Inserted new volume:" << setw(6) << left << o.volumes.size()
         << " Ptr:"  << (void*) pv.ptr()
@@ -619,6 +633,11 @@ VolumeManagerContext* VolumeManager::lookupContext(VolumeID volume_id) const {
       return c;
     /// Second: look in the subdetector volume cache if the entry is found.
     if (!one_tree) {
+      /// Dispatch to the responsible subdetector according to the system field
+      const Object* mgr = o.dispatchManager(id);
+      if ( mgr && (c = mgr->search(id)) != 0 )
+        return c;
+      /// Fallback: system fields not covered by the dispatch table
       for (const auto& j : o.subdetectors )  {
         if ((c = j.second._data().search(id)) != 0)
           return c;
@@ -718,7 +737,9 @@ std::ostream& dd4hep::operator<<(std::ostream& os, const VolumeManager& mgr) {
 VolumeManagerObject::~VolumeManagerObject() {
   /// Cleanup volume tree
   destroyObjects(volumes);
+  volumeIndex.clear();
   /// Cleanup dependent managers
+  dispatch.clear();
   destroyHandles(managers);
   managers.clear();
   subdetectors.clear();
@@ -731,13 +752,64 @@ void VolumeManagerObject::update(unsigned long tags, DetElement& det, void* para
   if ( DetElement::PLACEMENT_CHANGED == (tags&DetElement::PLACEMENT_CHANGED) )
     printout(DEBUG,"VolumeManager","+++ Alignment update %s param:%p",det.path().c_str(),param);
   
-  for(const auto& i : volumes )
+  for(const auto& i : volumes )  {
     printout(DEBUG,"VolumeManager","+++ Alignment update %s",i.second->elementPlacement().name());
+    if ( i.second->flag && DetElement::PLACEMENT_CHANGED == (tags&DetElement::PLACEMENT_CHANGED) )
+      ((VolumeManagerContextExtension*)i.second)->updateWorldTransformation();
+  }
+}
+
+/// Update the cached transformation to the world from the nominal placement of the element
+void VolumeManagerContextExtension::updateWorldTransformation()   {
+  TGeoHMatrix world(element.nominal().worldTransformation());
+  world.Multiply(&toElement);
+  const double* rot = world.GetRotationMatrix();
+  const double* tr  = world.GetTranslation();
+  std::copy(rot, rot+9, toWorld);
+  std::copy(tr,  tr+3,  toWorld+9);
+  haveWorld = true;
 }
 
 /// Search the locally cached volumes for a matching ID
 VolumeManagerContext* VolumeManagerObject::search(const VolumeID& vol_id) const {
+  /// The hash index is transient: use the map if it is not (yet) in sync
+  if ( volumeIndex.size() == volumes.size() )   {
+    auto i = volumeIndex.find(vol_id&detMask);
+    return (i == volumeIndex.end()) ? 0 : (*i).second;
+  }
   auto i = volumes.find(vol_id&detMask);
   return (i == volumes.end()) ? 0 : (*i).second;
 }
 
+/// Register a subdetector manager in the system dispatch table
+void VolumeManagerObject::addDispatch(const BitFieldElement* field, VolumeID sys_id, VolumeManagerObject* mgr)  {
+  if ( field->width() > MAX_DISPATCH_WIDTH )   {
+    printout(DEBUG,"VolumeManager","+++ System field of %s too wide for dispatch table: %u bits",
+             mgr->detector.name(), field->width());
+    return;
+  }
+  VolumeID mask = field->mask();
+  auto i = std::find_if(dispatch.begin(), dispatch.end(),
+                        [mask](const SystemDispatch& d) { return d.mask == mask; });
+  if ( i == dispatch.end() )   {
+    SystemDispatch d;
+    d.mask   = mask;
+    d.offset = field->offset();
+    i = dispatch.insert(dispatch.end(), std::move(d));
+  }
+  std::size_t slot = std::size_t(sys_id & (mask >> field->offset()));
+  if ( slot >= i->managers.size() )
+    i->managers.resize(slot+1, nullptr);
+  i->managers[slot] = mgr;
+}
+
+/// Access the subdetector manager responsible for a volume identifier. Null if unknown
+VolumeManagerObject* VolumeManagerObject::dispatchManager(VolumeID vol_id) const  {
+  for( const auto& d : dispatch )   {
+    std::size_t slot = std::size_t((vol_id & d.mask) >> d.offset);
+    if ( slot < d.managers.size() && d.managers[slot] )
+      return d.managers[slot];
+  }
+  return nullptr;
+}
+
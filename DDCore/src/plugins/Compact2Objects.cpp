@@ -48,6 +48,7 @@
 #include <TGDMLMatrix.h>
 #endif
 #include <TMath.h>
+#include <TUri.h>
 
 // C/C++ include files
 #include <climits>
@@ -265,6 +266,27 @@ static Ref_t create_MultipoleField(Detector& description, xml_h e) {
 }
 DECLARE_XMLELEMENT(MultipoleMagnet,create_MultipoleField)
 
+static Ref_t create_FieldMap(Detector& /* description */, xml_h e) {
+  xml_comp_t c(e);
+  CartesianField obj;
+  unique_ptr<FieldMap> ptr(new FieldMap());
+  if ( !c.hasAttr(_U(file)) )  {
+    throw_print("Compact2Objects[ERROR]: The field map "+c.nameStr()+
+                " requires the xml attribute file.");
+  }
+  // Relative file names are resolved with respect to the compact document
+  string fname = c.attr<string>(_U(file));
+  if ( !fname.empty() && fname[0] != '/' )  {
+    TUri uri(xml::DocumentHandler::system_path(e, fname).c_str());
+    fname = uri.GetRelativePart().Data();
+  }
+  ptr->load(fname);
+  ptr->field_type = CartesianField::MAGNETIC;
+  obj.assign(ptr.release(), c.nameStr(), c.typeStr());
+  return obj;
+}
+DECLARE_XMLELEMENT(FieldMap,create_FieldMap)
+
 static long load_Compact(Detector& description, xml_h element) {
   Converter<Compact>converter(description);
   converter(element);
@@ -122,3 +122,12 @@ static Handle<NamedObject> convert_multipole(Detector&, xml_h field, Handle<Name
   return object;
 }
 DECLARE_XML_PROCESSOR(MultipoleMagnet_Convert2Detector,convert_multipole)
+
+static Handle<NamedObject> convert_fieldmap(Detector&, xml_h field, Handle<NamedObject> object) {
+  FieldMap* fld = object.data<FieldMap>();
+  field.setAttr(_U(name), object->GetName());
+  field.setAttr(_U(type), object->GetTitle());
+  field.setAttr(_U(file), fld->file);
+  return object;
+}
+DECLARE_XML_PROCESSOR(FieldMap_Convert2Detector,convert_fieldmap)
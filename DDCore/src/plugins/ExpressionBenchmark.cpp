@@ -0,0 +1,144 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include "DD4hep/Detector.h"
+#include "DD4hep/Printout.h"
+#include "DD4hep/Factories.h"
+#include "DD4hep/DetFactoryHelper.h"
+#include "XML/DocumentHandler.h"
+
+// C/C++ include files
+#include <chrono>
+#include <vector>
+#include <cstring>
+#include <iostream>
+
+using namespace dd4hep;
+
+namespace  {
+
+  /// Collect all attribute values of an XML tree. Referenced XML files are followed
+  void collect_values(xml_h element, std::vector<std::string>& values, std::size_t& num_docs)   {
+    for( xml_attr_t a : element.attributes() )  {
+      std::string tag = xml::_toString(element.attr_name(a));
+      std::string val = element.attr<std::string>(a);
+      if ( tag == "ref" && val.size() > 4 && val.substr(val.size()-4) == ".xml" )  {
+        try  {
+          xml::DocumentHolder doc(xml::DocumentHandler().load(element, element.attr_value(a)));
+          collect_values(doc.root(), values, ++num_docs);
+        }
+        catch(const std::exception& e)  {
+          printout(WARNING,"ExpressionBenchmark","+++ Cannot follow reference %s: %s",
+                   val.c_str(), e.what());
+        }
+        continue;
+      }
+      values.emplace_back(val);
+    }
+    for( xml_coll_t c(element, _U(star)); c; ++c )
+      collect_values(c, values, num_docs);
+  }
+
+  /// Convert all values. Returns the elapsed time in nanoseconds
+  double convert_values(const std::vector<std::string>& values, std::vector<double>& results, std::size_t repeat)  {
+    auto start = std::chrono::high_resolution_clock::now();
+    for( std::size_t r = 0; r < repeat; ++r )  {
+      for( std::size_t i = 0; i < values.size(); ++i )
+        results[i] = _toDouble(values[i]);
+    }
+    auto stop = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count();
+  }
+}
+
+/// Micro-benchmark of the numeric attribute conversion used when loading XML geometries
+/**
+ *  Factory: DD4hep_ExpressionBenchmark
+ *
+ *  All attribute values of the given XML documents (and the documents
+ *  referenced therein) are collected. The values which are accepted by
+ *  the expression evaluator are converted to double precision numbers
+ *  with and without the literal fast path and the expression cache.
+ *  Both must agree.
+ *
+ *  The constants of the loaded detector description are visible to the
+ *  evaluator: invoke the plugin after loading the geometry.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ */
+static long expression_benchmark(Detector& /* description */, int argc, char** argv) {
+  std::vector<std::string> inputs;
+  std::size_t repeat = 10;
+  for(int i = 0; i < argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-input",argv[i],4) && i+1 < argc )
+      inputs.emplace_back(argv[++i]);
+    else if ( 0 == ::strncmp("-repeat",argv[i],4) && i+1 < argc )
+      repeat = std::stoul(argv[++i]);
+    else  {
+      std::cout <<
+        "Usage: -plugin DD4hep_ExpressionBenchmark -arg [-arg]                  \n"
+        "     -input     <uri>    XML document to scan for attribute values.    \n"
+        "                         Multiple inputs are allowed.                  \n"
+        "     -repeat    <number> Number of conversions per attribute value.    \n"
+        "\tArguments given: " << arguments(argc,argv) << std::endl << std::flush;
+      ::exit(EINVAL);
+    }
+  }
+  std::size_t num_docs = 0, num_attrs = 0;
+  std::vector<std::string> attrs, values;
+  for( const auto& input : inputs )  {
+    xml::DocumentHolder doc(xml::DocumentHandler().load(input));
+    collect_values(doc.root(), attrs, ++num_docs);
+  }
+  // Keep only the values the evaluator accepts
+  bool fast = set_fast_evaluation(false);
+  num_attrs = attrs.size();
+  for( auto& v : attrs )  {
+    try  {
+      _toDouble(v);
+      values.emplace_back(std::move(v));
+    }
+    catch(const std::exception&)  {
+    }
+  }
+  std::vector<double> slow_results(values.size()), fast_results(values.size());
+  double slow_ns = convert_values(values, slow_results, repeat);
+  set_fast_evaluation(true);
+  double fast_ns = convert_values(values, fast_results, repeat);
+  set_fast_evaluation(fast);
+
+  std::size_t mismatch = 0;
+  for( std::size_t i = 0; i < values.size(); ++i )  {
+    if ( slow_results[i] != fast_results[i] )  {
+      printout(ERROR,"ExpressionBenchmark","+++ Mismatch: '%s' evaluator: %.17g fast: %.17g",
+               values[i].c_str(), slow_results[i], fast_results[i]);
+      ++mismatch;
+    }
+  }
+  double num = double(std::max(values.size()*repeat, std::size_t(1)));
+  printout(ALWAYS,"ExpressionBenchmark","+++ %ld documents with %ld attributes. %ld numeric values. %ld repetitions.",
+           num_docs, num_attrs, values.size(), repeat);
+  printout(ALWAYS,"ExpressionBenchmark","+++ Evaluator conversion:          %9.1f ns/call  %9.3f ms/load",
+           slow_ns/num, 1e-6*slow_ns/double(repeat));
+  printout(ALWAYS,"ExpressionBenchmark","+++ Fast path + expression cache:  %9.1f ns/call  %9.3f ms/load",
+           fast_ns/num, 1e-6*fast_ns/double(repeat));
+  if ( mismatch == 0 && !values.empty() )  {
+    printout(ALWAYS,"ExpressionBenchmark","+++ Expression benchmark PASSED");
+    return 1;
+  }
+  printout(ERROR,"ExpressionBenchmark","+++ Expression benchmark FAILED: %ld mismatches", mismatch);
+  return 0;
+}
+DECLARE_APPLY(DD4hep_ExpressionBenchmark,expression_benchmark)
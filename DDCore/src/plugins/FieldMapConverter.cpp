@@ -0,0 +1,229 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include "DD4hep/Detector.h"
+#include "DD4hep/Printout.h"
+#include "DD4hep/Factories.h"
+#include "DD4hep/FieldTypes.h"
+#include "DD4hep/DD4hepUnits.h"
+
+// C/C++ include files
+#include <cmath>
+#include <array>
+#include <vector>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+
+using namespace dd4hep;
+
+namespace  {
+
+  /// Grid axis built from the distinct coordinate values of the text field map
+  struct Axis  {
+    std::vector<double> values;
+    /// Sort the coordinate values and remove duplicates within the tolerance
+    void build(std::vector<double> v, double tolerance)  {
+      std::sort(v.begin(), v.end());
+      values.clear();
+      for( double x : v )
+        if ( values.empty() || x - values.back() > tolerance ) values.emplace_back(x);
+    }
+    /// Check that the grid points are equidistant
+    bool regular(double tolerance)  const  {
+      if ( values.size() < 3 ) return true;
+      double step = (values.back() - values.front()) / double(values.size()-1);
+      for( std::size_t i = 0; i < values.size(); ++i )
+        if ( std::abs(values[i] - (values.front() + double(i)*step)) > tolerance ) return false;
+      return true;
+    }
+    /// Grid index of a coordinate value
+    long index(double x)  const  {
+      if ( values.size() < 2 ) return 0;
+      double step = (values.back() - values.front()) / double(values.size()-1);
+      return std::lround((x - values.front()) / step);
+    }
+  };
+}
+
+/// Convert text field maps to the binary format of the dd4hep::FieldMap field type
+/**
+ *  Factory: DD4hep_FieldMapConverter
+ *
+ *  The text field map contains one line per grid point with 6 columns:
+ *  - Cartesian grids:    x  y    z   Bx  By    Bz
+ *  - Cylindrical grids:  r  phi  z   Br  Bphi  Bz
+ *  Lines starting with '#' are ignored. The grid must be regular and
+ *  complete, the lines may come in any order.
+ *  After writing the binary file is mapped and the field values at all
+ *  grid points are compared to the text input.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ */
+static long fieldmap_converter(Detector& /* description */, int argc, char** argv) {
+  std::string input, output;
+  std::string lunit = "mm", aunit = "rad", funit = "tesla";
+  bool cylindrical = false, arg_error = false;
+  for(int i = 0; i < argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-input",argv[i],4) && i+1 < argc )
+      input = argv[++i];
+    else if ( 0 == ::strncmp("-output",argv[i],4) && i+1 < argc )
+      output = argv[++i];
+    else if ( 0 == ::strncmp("-cylindrical",argv[i],4) )
+      cylindrical = true;
+    else if ( 0 == ::strncmp("-lunit",argv[i],4) && i+1 < argc )
+      lunit = argv[++i];
+    else if ( 0 == ::strncmp("-aunit",argv[i],4) && i+1 < argc )
+      aunit = argv[++i];
+    else if ( 0 == ::strncmp("-funit",argv[i],4) && i+1 < argc )
+      funit = argv[++i];
+    else
+      arg_error = true;
+  }
+  if ( arg_error || input.empty() || output.empty() )  {
+    std::cout <<
+      "Usage: -plugin DD4hep_FieldMapConverter -arg [-arg]                    \n"
+      "     -input       <file>   Text field map with 6 columns per line.     \n"
+      "     -output      <file>   Binary field map file.                      \n"
+      "     -cylindrical          Columns are r phi z Br Bphi Bz.             \n"
+      "                           Default: x y z Bx By Bz.                    \n"
+      "     -lunit       <unit>   Unit of the lengths.  Default: mm           \n"
+      "     -aunit       <unit>   Unit of the angles.   Default: rad          \n"
+      "     -funit       <unit>   Unit of the field.    Default: tesla        \n"
+      "\tArguments given: " << arguments(argc,argv) << std::endl << std::flush;
+    ::exit(EINVAL);
+  }
+  // Conversion factors to the units of the binary file: mm, rad and tesla
+  const double len_fac = _toDouble(lunit) / dd4hep::mm;
+  const double ang_fac = _toDouble(aunit) / dd4hep::rad;
+  const double fld_fac = _toDouble(funit) / dd4hep::tesla;
+  const double fac[3]  = { len_fac, cylindrical ? ang_fac : len_fac, len_fac };
+
+  std::ifstream in(input);
+  if ( !in.good() )  {
+    except("FieldMapConverter","+++ Cannot open text field map %s", input.c_str());
+  }
+  std::vector<std::array<double,6> > rows;
+  std::string line;
+  for( long num_line = 1; std::getline(in, line); ++num_line )  {
+    std::size_t idx = line.find_first_not_of(" \t");
+    if ( idx == std::string::npos || line[idx] == '#' ) continue;
+    std::array<double,6> r;
+    std::istringstream str(line);
+    if ( !(str >> r[0] >> r[1] >> r[2] >> r[3] >> r[4] >> r[5]) )  {
+      except("FieldMapConverter","+++ %s:%ld: Invalid field map entry: %s",
+             input.c_str(), num_line, line.c_str());
+    }
+    for( int i = 0; i < 3; ++i )  {
+      r[i]   *= fac[i];
+      r[i+3] *= fld_fac;
+    }
+    rows.emplace_back(r);
+  }
+
+  // Reconstruct the grid from the distinct coordinate values
+  FieldMap::Header hdr;
+  std::memset(&hdr, 0, sizeof(hdr));
+  std::memcpy(hdr.magic, "DD4HFMAP", sizeof(hdr.magic));
+  hdr.version     = 1;
+  hdr.coordinates = cylindrical ? FieldMap::CYLINDRICAL : FieldMap::CARTESIAN;
+  Axis axis[3];
+  std::size_t num_points = 1;
+  for( int i = 0; i < 3; ++i )  {
+    std::vector<double> v;
+    v.reserve(rows.size());
+    for( const auto& r : rows ) v.emplace_back(r[i]);
+    double range = v.empty() ? 0e0 : *std::max_element(v.begin(),v.end()) - *std::min_element(v.begin(),v.end());
+    double tolerance = 1e-6 * std::max(range, 1e0);
+    axis[i].build(std::move(v), tolerance);
+    if ( axis[i].values.empty() || !axis[i].regular(tolerance) )  {
+      except("FieldMapConverter","+++ %s: The grid along coordinate %d is not regular.", input.c_str(), i);
+    }
+    hdr.points[i] = axis[i].values.size();
+    hdr.lower[i]  = axis[i].values.front();
+    hdr.upper[i]  = axis[i].values.back();
+    num_points   *= hdr.points[i];
+  }
+  if ( num_points != rows.size() )  {
+    except("FieldMapConverter","+++ %s: Incomplete grid: %ld entries for %u x %u x %u grid points.",
+           input.c_str(), long(rows.size()), hdr.points[0], hdr.points[1], hdr.points[2]);
+  }
+  std::vector<float> values(3*num_points, 0e0);
+  std::vector<char>  filled(num_points, 0);
+  for( const auto& r : rows )  {
+    std::size_t idx = axis[0].index(r[0]) +
+      hdr.points[0] * (axis[1].index(r[1]) + hdr.points[1] * axis[2].index(r[2]));
+    if ( filled[idx] )  {
+      except("FieldMapConverter","+++ %s: Duplicate grid point (%g, %g, %g).",
+             input.c_str(), r[0], r[1], r[2]);
+    }
+    filled[idx] = 1;
+    values[3*idx]   = float(r[3]);
+    values[3*idx+1] = float(r[4]);
+    values[3*idx+2] = float(r[5]);
+  }
+  {
+    std::ofstream out(output, std::ios::binary|std::ios::trunc);
+    out.write((const char*)&hdr, sizeof(hdr));
+    out.write((const char*)values.data(), values.size()*sizeof(float));
+    if ( !out.good() )  {
+      except("FieldMapConverter","+++ Failed to write binary field map %s", output.c_str());
+    }
+  }
+  printout(INFO,"FieldMapConverter","+++ Converted %s to %s: %s grid with %u x %u x %u points.",
+           input.c_str(), output.c_str(), cylindrical ? "cylindrical" : "Cartesian",
+           hdr.points[0], hdr.points[1], hdr.points[2]);
+
+  // Read back the binary file and check the field at all grid points
+  FieldMap fmap;
+  fmap.load(output);
+  std::size_t num_errors = 0;
+  for( const auto& r : rows )  {
+    double pos[3], b[3] = { 0e0, 0e0, 0e0 }, expected[3] = { r[3], r[4], r[5] };
+    if ( cylindrical )  {
+      double cp = std::cos(r[1]), sp = std::sin(r[1]);
+      pos[0] = r[0] * cp * dd4hep::mm;
+      pos[1] = r[0] * sp * dd4hep::mm;
+      expected[0] = r[3] * cp - r[4] * sp;
+      expected[1] = r[3] * sp + r[4] * cp;
+    }
+    else  {
+      pos[0] = r[0] * dd4hep::mm;
+      pos[1] = r[1] * dd4hep::mm;
+    }
+    pos[2] = r[2] * dd4hep::mm;
+    fmap.fieldComponents(pos, b);
+    // On the axis of cylindrical grids only B_z is well defined
+    for( int i = (cylindrical && r[0] == 0e0) ? 2 : 0; i < 3; ++i )  {
+      double diff = b[i] / dd4hep::tesla - expected[i];
+      if ( std::abs(diff) > 1e-5 * std::max(std::abs(expected[i]), 1e0) )  {
+        printout(ERROR,"FieldMapConverter","+++ Field mismatch at (%g, %g, %g): B[%d] = %g expected %g",
+                 r[0], r[1], r[2], i, b[i] / dd4hep::tesla, expected[i]);
+        ++num_errors;
+        break;
+      }
+    }
+  }
+  if ( num_errors == 0 )  {
+    printout(ALWAYS,"FieldMapConverter","+++ Checked %ld grid points. Test PASSED", long(rows.size()));
+    return 1;
+  }
+  printout(ERROR,"FieldMapConverter","+++ %ld of %ld grid points differ. Test FAILED",
+           long(num_errors), long(rows.size()));
+  return 0;
+}
+DECLARE_APPLY(DD4hep_FieldMapConverter,fieldmap_converter)
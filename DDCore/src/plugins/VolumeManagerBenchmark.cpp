@@ -0,0 +1,113 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include "DD4hep/Detector.h"
+#include "DD4hep/Printout.h"
+#include "DD4hep/Factories.h"
+#include "DD4hep/VolumeManager.h"
+#include "DD4hep/detail/VolumeManagerInterna.h"
+
+// C/C++ include files
+#include <random>
+#include <chrono>
+#include <vector>
+#include <cstring>
+#include <iostream>
+#include <algorithm>
+
+using namespace dd4hep;
+using namespace dd4hep::detail;
+
+namespace  {
+
+  /// Reference lookup: search the own volumes and then linearly all subdetectors
+  VolumeManagerContext* linear_lookup(const VolumeManagerObject& o, VolumeID id)  {
+    auto i = o.volumes.find(id&o.detMask);
+    if ( i != o.volumes.end() ) return (*i).second;
+    for( const auto& j : o.subdetectors )  {
+      const VolumeManagerObject& mo = *j.second.ptr();
+      auto k = mo.volumes.find(id&mo.detMask);
+      if ( k != mo.volumes.end() ) return (*k).second;
+    }
+    return nullptr;
+  }
+}
+
+/// Micro-benchmark of the volume manager context lookup
+/**
+ *  Factory: DD4hep_VolumeManagerBenchmark
+ *
+ *  All volume identifiers known to the volume manager are looked up
+ *  in random order using VolumeManager::lookupContext and a reference
+ *  linear search over all subdetector sections. Both must agree.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ */
+static long volmgr_benchmark(Detector& description, int argc, char** argv) {
+  std::size_t repeat = 10;
+  for(int i = 0; i < argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-repeat",argv[i],4) && i+1 < argc )
+      repeat = std::stoul(argv[++i]);
+    else  {
+      std::cout <<
+        "Usage: -plugin DD4hep_VolumeManagerBenchmark -arg [-arg]         \n"
+        "     -repeat    <number> Number of lookups per volume identifier. \n"
+        "\tArguments given: " << arguments(argc,argv) << std::endl << std::flush;
+      ::exit(EINVAL);
+    }
+  }
+  VolumeManager mgr = VolumeManager::getVolumeManager(description);
+  const VolumeManagerObject& o = *mgr.data<VolumeManagerObject>();
+  std::vector<VolumeID> ids;
+  for( const auto& v : o.volumes )
+    ids.emplace_back(v.first);
+  for( const auto& j : o.subdetectors )  {
+    for( const auto& v : j.second->volumes )
+      ids.emplace_back(v.first);
+  }
+  std::shuffle(ids.begin(), ids.end(), std::mt19937(12345));
+
+  typedef std::chrono::high_resolution_clock clock_t;
+  std::size_t mismatch = 0, found_linear = 0, found = 0;
+  auto start = clock_t::now();
+  for( std::size_t r = 0; r < repeat; ++r )  {
+    for( VolumeID id : ids )
+      found_linear += linear_lookup(o, id) ? 1 : 0;
+  }
+  auto middle = clock_t::now();
+  for( std::size_t r = 0; r < repeat; ++r )  {
+    for( VolumeID id : ids )
+      found += mgr.lookupContext(id) ? 1 : 0;
+  }
+  auto stop = clock_t::now();
+  for( VolumeID id : ids )  {
+    if ( linear_lookup(o, id) != mgr.lookupContext(id) )
+      ++mismatch;
+  }
+  double num = double(std::max(ids.size()*repeat, std::size_t(1)));
+  printout(ALWAYS,"VolumeManagerBenchmark","+++ %ld volume identifiers in %ld subdetector sections. %ld repetitions.",
+           ids.size(), o.subdetectors.size(), repeat);
+  printout(ALWAYS,"VolumeManagerBenchmark","+++ Linear search lookup:    %9.1f ns/call",
+           std::chrono::duration<double, std::nano>(middle - start).count()/num);
+  printout(ALWAYS,"VolumeManagerBenchmark","+++ VolumeManager::lookupContext: %9.1f ns/call",
+           std::chrono::duration<double, std::nano>(stop - middle).count()/num);
+  if ( mismatch == 0 && found == found_linear && !ids.empty() )  {
+    printout(ALWAYS,"VolumeManagerBenchmark","+++ Volume manager benchmark PASSED");
+    return 1;
+  }
+  printout(ERROR,"VolumeManagerBenchmark","+++ Volume manager benchmark FAILED: %ld mismatches", mismatch);
+  return 0;
+}
+DECLARE_APPLY(DD4hep_VolumeManagerBenchmark,volmgr_benchmark)
@@ -70,6 +70,25 @@ namespace dd4hep{
   
 
 
+    BitFieldHandle::BitFieldHandle( const BitFieldElement& element ) :
+      _mask( element.mask() ),
+      _signBit( element.isSigned() ? ( 1ULL << ( element.width() - 1 ) ) : 0ULL ),
+      _minVal( element.minValue() ),
+      _maxVal( element.maxValue() ),
+      _offset( element.offset() ),
+      _width( element.width() ) {
+    }
+
+    void BitFieldHandle::unresolved() const {
+      throw std::runtime_error( " BitFieldHandle: access to unresolved field" ) ;
+    }
+
+    void BitFieldHandle::outOfRange( long64 in ) const {
+      if( _mask == 0 ) unresolved() ;
+      std::stringstream s ;
+      s << " BitFieldHandle: out of range : " << in << " for width " << _width ;
+      throw std::runtime_error( s.str() ) ;
+    }
 
     size_t BitFieldCoder::index( const std::string& name) const {
     
@@ -7,6 +7,8 @@
 
 #include "DDSegmentation/CartesianGridXY.h"
 
+#include <typeinfo>
+
 namespace dd4hep {
 namespace DDSegmentation {
 
@@ -23,7 +25,9 @@ CartesianGridXY::CartesianGridXY(const std::string& cellEncoding) :
 	registerParameter("offset_x", "Cell offset in X", _offsetX, 0., SegmentationParameter::LengthUnit, true);
 	registerParameter("offset_y", "Cell offset in Y", _offsetY, 0., SegmentationParameter::LengthUnit, true);
 	registerIdentifier("identifier_x", "Cell ID identifier for X", _xId, "x");
+	registerFieldHandle(_xId, _xField);
 	registerIdentifier("identifier_y", "Cell ID identifier for Y", _yId, "y");
+	registerFieldHandle(_yId, _yField);
 }
 
 /// Default constructor used by derived classes passing an existing decoder
@@ -40,7 +44,9 @@ CartesianGridXY::CartesianGridXY(const BitFieldCoder* decode) :
 	registerParameter("offset_x", "Cell offset in X", _offsetX, 0., SegmentationParameter::LengthUnit, true);
 	registerParameter("offset_y", "Cell offset in Y", _offsetY, 0., SegmentationParameter::LengthUnit, true);
 	registerIdentifier("identifier_x", "Cell ID identifier for X", _xId, "x");
+	registerFieldHandle(_xId, _xField);
 	registerIdentifier("identifier_y", "Cell ID identifier for Y", _yId, "y");
+	registerFieldHandle(_yId, _yField);
 }
 
 /// destructor
@@ -51,19 +57,63 @@ CartesianGridXY::~CartesianGridXY() {
 /// determine the position based on the cell ID
 Vector3D CartesianGridXY::position(const CellID& cID) const {
 	Vector3D cellPosition;
-	cellPosition.X = binToPosition( _decoder->get(cID,_xId ), _gridSizeX, _offsetX);
-	cellPosition.Y = binToPosition( _decoder->get(cID,_yId ), _gridSizeY, _offsetY);
+	cellPosition.X = binToPosition( _xField.value(cID), _gridSizeX, _offsetX);
+	cellPosition.Y = binToPosition( _yField.value(cID), _gridSizeY, _offsetY);
 	return cellPosition;
 }
 
 /// determine the cell ID based on the position
   CellID CartesianGridXY::cellID(const Vector3D& localPosition, const Vector3D& /* globalPosition */, const VolumeID& vID) const {
         CellID cID = vID ;
-	_decoder->set( cID,_xId, positionToBin(localPosition.X, _gridSizeX, _offsetX) );
-	_decoder->set( cID,_yId, positionToBin(localPosition.Y, _gridSizeY, _offsetY) );
+	_xField.set(cID, positionToBin(localPosition.X, _gridSizeX, _offsetX) );
+	_yField.set(cID, positionToBin(localPosition.Y, _gridSizeY, _offsetY) );
 	return cID ;
 }
 
+/// determine the local positions of n cell IDs in chunks
+void CartesianGridXY::positions(const CellID* cIDs, Vector3D* localPositions, std::size_t n) const {
+	// Derived classes may override position(): the fast path is only valid for this exact type
+	if ( typeid(*this) != typeid(CartesianGridXY) ) {
+		Segmentation::positions(cIDs, localPositions, n);
+		return;
+	}
+	double x[BATCH_CHUNK_SIZE], y[BATCH_CHUNK_SIZE];
+	for ( std::size_t first = 0; first < n; first += BATCH_CHUNK_SIZE ) {
+		const std::size_t num = n - first < std::size_t(BATCH_CHUNK_SIZE) ? n - first : std::size_t(BATCH_CHUNK_SIZE);
+		binsToPositions(_xField, cIDs + first, x, num, _gridSizeX, _offsetX);
+		binsToPositions(_yField, cIDs + first, y, num, _gridSizeY, _offsetY);
+		for ( std::size_t i = 0; i < num; ++i )
+			localPositions[first + i] = Vector3D(x[i], y[i], 0.);
+	}
+}
+
+/// determine the cell IDs of n positions in chunks
+void CartesianGridXY::cellIDs(const Vector3D* localPositions, const Vector3D* globalPositions,
+                         const VolumeID* vIDs, CellID* cIDs, std::size_t n) const {
+	// Derived classes may override cellID(): the fast path is only valid for this exact type
+	if ( typeid(*this) != typeid(CartesianGridXY) ) {
+		Segmentation::cellIDs(localPositions, globalPositions, vIDs, cIDs, n);
+		return;
+	}
+	double x[BATCH_CHUNK_SIZE], y[BATCH_CHUNK_SIZE];
+	long64 xBin[BATCH_CHUNK_SIZE], yBin[BATCH_CHUNK_SIZE];
+	for ( std::size_t first = 0; first < n; first += BATCH_CHUNK_SIZE ) {
+		const std::size_t num = n - first < std::size_t(BATCH_CHUNK_SIZE) ? n - first : std::size_t(BATCH_CHUNK_SIZE);
+		for ( std::size_t i = 0; i < num; ++i ) {
+			x[i] = localPositions[first + i].X;
+			y[i] = localPositions[first + i].Y;
+			cIDs[first + i] = vIDs[first + i];
+		}
+		positionsToBins(x, xBin, num, _gridSizeX, _offsetX);
+		positionsToBins(y, yBin, num, _gridSizeY, _offsetY);
+		// Out of range bins: redo the chunk with the scalar call to get the proper error
+		if ( !encodeBins(_xField, xBin, cIDs + first, num) ||
+		     !encodeBins(_yField, yBin, cIDs + first, num) ) {
+			Segmentation::cellIDs(localPositions + first, globalPositions + first, vIDs + first, cIDs + first, num);
+		}
+	}
+}
+
 std::vector<double> CartesianGridXY::cellDimensions(const CellID&) const {
 #if __cplusplus >= 201103L
   return {_gridSizeX, _gridSizeY};
@@ -7,6 +7,8 @@
 
 #include "DDSegmentation/CartesianGridXYZ.h"
 
+#include <typeinfo>
+
 namespace dd4hep {
 namespace DDSegmentation {
 
@@ -21,6 +23,7 @@ CartesianGridXYZ::CartesianGridXYZ(const std::string& cellEncoding) :
 	registerParameter("grid_size_z", "Cell size in Z", _gridSizeZ, 1., SegmentationParameter::LengthUnit);
 	registerParameter("offset_z", "Cell offset in Z", _offsetZ, 0., SegmentationParameter::LengthUnit, true);
 	registerIdentifier("identifier_z", "Cell ID identifier for Z", _zId, "z");
+	registerFieldHandle(_zId, _zField);
 }
 
 /// Default constructor used by derived classes passing an existing decoder
@@ -34,6 +37,7 @@ CartesianGridXYZ::CartesianGridXYZ(const BitFieldCoder* decode) :
 	registerParameter("grid_size_z", "Cell size in Z", _gridSizeZ, 1., SegmentationParameter::LengthUnit);
 	registerParameter("offset_z", "Cell offset in Z", _offsetZ, 0., SegmentationParameter::LengthUnit, true);
 	registerIdentifier("identifier_z", "Cell ID identifier for Z", _zId, "z");
+	registerFieldHandle(_zId, _zField);
 }
 
 /// destructor
@@ -44,21 +48,69 @@ CartesianGridXYZ::~CartesianGridXYZ() {
 /// determine the position based on the cell ID
 Vector3D CartesianGridXYZ::position(const CellID& cID) const {
 	Vector3D cellPosition;
-	cellPosition.X = binToPosition( _decoder->get(cID,_xId ), _gridSizeX, _offsetX);
-	cellPosition.Y = binToPosition( _decoder->get(cID,_yId ), _gridSizeY, _offsetY);
-	cellPosition.Z = binToPosition( _decoder->get(cID,_zId ), _gridSizeZ, _offsetZ);
+	cellPosition.X = binToPosition( _xField.value(cID), _gridSizeX, _offsetX);
+	cellPosition.Y = binToPosition( _yField.value(cID), _gridSizeY, _offsetY);
+	cellPosition.Z = binToPosition( _zField.value(cID), _gridSizeZ, _offsetZ);
 	return cellPosition;
 }
 
 /// determine the cell ID based on the position
   CellID CartesianGridXYZ::cellID(const Vector3D& localPosition, const Vector3D& /* globalPosition */, const VolumeID& vID) const {
         CellID cID = vID ;
-	_decoder->set( cID,_xId, positionToBin(localPosition.X, _gridSizeX, _offsetX) );
-	_decoder->set( cID,_yId, positionToBin(localPosition.Y, _gridSizeY, _offsetY) );
-	_decoder->set( cID,_zId, positionToBin(localPosition.Z, _gridSizeZ, _offsetZ) );
+	_xField.set(cID, positionToBin(localPosition.X, _gridSizeX, _offsetX) );
+	_yField.set(cID, positionToBin(localPosition.Y, _gridSizeY, _offsetY) );
+	_zField.set(cID, positionToBin(localPosition.Z, _gridSizeZ, _offsetZ) );
 	return cID ;
 }
 
+/// determine the local positions of n cell IDs in chunks
+void CartesianGridXYZ::positions(const CellID* cIDs, Vector3D* localPositions, std::size_t n) const {
+	// Derived classes may override position(): the fast path is only valid for this exact type
+	if ( typeid(*this) != typeid(CartesianGridXYZ) ) {
+		Segmentation::positions(cIDs, localPositions, n);
+		return;
+	}
+	double x[BATCH_CHUNK_SIZE], y[BATCH_CHUNK_SIZE], z[BATCH_CHUNK_SIZE];
+	for ( std::size_t first = 0; first < n; first += BATCH_CHUNK_SIZE ) {
+		const std::size_t num = n - first < std::size_t(BATCH_CHUNK_SIZE) ? n - first : std::size_t(BATCH_CHUNK_SIZE);
+		binsToPositions(_xField, cIDs + first, x, num, _gridSizeX, _offsetX);
+		binsToPositions(_yField, cIDs + first, y, num, _gridSizeY, _offsetY);
+		binsToPositions(_zField, cIDs + first, z, num, _gridSizeZ, _offsetZ);
+		for ( std::size_t i = 0; i < num; ++i )
+			localPositions[first + i] = Vector3D(x[i], y[i], z[i]);
+	}
+}
+
+/// determine the cell IDs of n positions in chunks
+void CartesianGridXYZ::cellIDs(const Vector3D* localPositions, const Vector3D* globalPositions,
+                         const VolumeID* vIDs, CellID* cIDs, std::size_t n) const {
+	// Derived classes may override cellID(): the fast path is only valid for this exact type
+	if ( typeid(*this) != typeid(CartesianGridXYZ) ) {
+		Segmentation::cellIDs(localPositions, globalPositions, vIDs, cIDs, n);
+		return;
+	}
+	double x[BATCH_CHUNK_SIZE], y[BATCH_CHUNK_SIZE], z[BATCH_CHUNK_SIZE];
+	long64 xBin[BATCH_CHUNK_SIZE], yBin[BATCH_CHUNK_SIZE], zBin[BATCH_CHUNK_SIZE];
+	for ( std::size_t first = 0; first < n; first += BATCH_CHUNK_SIZE ) {
+		const std::size_t num = n - first < std::size_t(BATCH_CHUNK_SIZE) ? n - first : std::size_t(BATCH_CHUNK_SIZE);
+		for ( std::size_t i = 0; i < num; ++i ) {
+			x[i] = localPositions[first + i].X;
+			y[i] = localPositions[first + i].Y;
+			z[i] = localPositions[first + i].Z;
+			cIDs[first + i] = vIDs[first + i];
+		}
+		positionsToBins(x, xBin, num, _gridSizeX, _offsetX);
+		positionsToBins(y, yBin, num, _gridSizeY, _offsetY);
+		positionsToBins(z, zBin, num, _gridSizeZ, _offsetZ);
+		// Out of range bins: redo the chunk with the scalar call to get the proper error
+		if ( !encodeBins(_xField, xBin, cIDs + first, num) ||
+		     !encodeBins(_yField, yBin, cIDs + first, num) ||
+		     !encodeBins(_zField, zBin, cIDs + first, num) ) {
+			Segmentation::cellIDs(localPositions + first, globalPositions + first, vIDs + first, cIDs + first, num);
+		}
+	}
+}
+
 std::vector<double> CartesianGridXYZ::cellDimensions(const CellID&) const {
 #if __cplusplus >= 201103L
   return {_gridSizeX, _gridSizeY, _gridSizeZ};
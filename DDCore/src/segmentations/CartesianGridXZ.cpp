@@ -7,6 +7,8 @@
 
 #include "DDSegmentation/CartesianGridXZ.h"
 
+#include <typeinfo>
+
 namespace dd4hep {
 namespace DDSegmentation {
 
@@ -26,7 +28,9 @@ CartesianGridXZ::CartesianGridXZ(const std::string& cellEncoding) :
 	registerParameter("offset_x", "Cell offset in X", _offsetX, 0., SegmentationParameter::LengthUnit, true);
 	registerParameter("offset_z", "Cell offset in Z", _offsetZ, 0., SegmentationParameter::LengthUnit, true);
 	registerIdentifier("identifier_x", "Cell ID identifier for X", _xId, "x");
+	registerFieldHandle(_xId, _xField);
 	registerIdentifier("identifier_z", "Cell ID identifier for Z", _zId, "z");
+	registerFieldHandle(_zId, _zField);
 }
 
 /// Default constructor used by derived classes passing an existing decoder
@@ -42,7 +46,9 @@ CartesianGridXZ::CartesianGridXZ(const BitFieldCoder* decode) :
 	registerParameter("offset_x", "Cell offset in X", _offsetX, 0., SegmentationParameter::LengthUnit, true);
 	registerParameter("offset_z", "Cell offset in Z", _offsetZ, 0., SegmentationParameter::LengthUnit, true);
 	registerIdentifier("identifier_x", "Cell ID identifier for X", _xId, "x");
+	registerFieldHandle(_xId, _xField);
 	registerIdentifier("identifier_z", "Cell ID identifier for Z", _zId, "z");
+	registerFieldHandle(_zId, _zField);
 }
 
 /// destructor
@@ -54,19 +60,63 @@ CartesianGridXZ::~CartesianGridXZ() {
 Vector3D CartesianGridXZ::position(const CellID& cID) const {
 	vector<double> localPosition(3);
 	Vector3D cellPosition;
-	cellPosition.X = binToPosition( _decoder->get(cID,_xId ), _gridSizeX, _offsetX);
-	cellPosition.Z = binToPosition( _decoder->get(cID,_zId ), _gridSizeZ, _offsetZ);
+	cellPosition.X = binToPosition( _xField.value(cID), _gridSizeX, _offsetX);
+	cellPosition.Z = binToPosition( _zField.value(cID), _gridSizeZ, _offsetZ);
 	return cellPosition;
 }
 
 /// determine the cell ID based on the position
   CellID CartesianGridXZ::cellID(const Vector3D& localPosition, const Vector3D& /* globalPosition */, const VolumeID& vID) const {
         CellID cID = vID ;
-        _decoder->set( cID,_xId, positionToBin(localPosition.X, _gridSizeX, _offsetX) );
-	_decoder->set( cID,_zId, positionToBin(localPosition.Z, _gridSizeZ, _offsetZ) );
+        _xField.set(cID, positionToBin(localPosition.X, _gridSizeX, _offsetX) );
+	_zField.set(cID, positionToBin(localPosition.Z, _gridSizeZ, _offsetZ) );
 	return cID ;
 }
 
+/// determine the local positions of n cell IDs in chunks
+void CartesianGridXZ::positions(const CellID* cIDs, Vector3D* localPositions, std::size_t n) const {
+	// Derived classes may override position(): the fast path is only valid for this exact type
+	if ( typeid(*this) != typeid(CartesianGridXZ) ) {
+		Segmentation::positions(cIDs, localPositions, n);
+		return;
+	}
+	double x[BATCH_CHUNK_SIZE], z[BATCH_CHUNK_SIZE];
+	for ( std::size_t first = 0; first < n; first += BATCH_CHUNK_SIZE ) {
+		const std::size_t num = n - first < std::size_t(BATCH_CHUNK_SIZE) ? n - first : std::size_t(BATCH_CHUNK_SIZE);
+		binsToPositions(_xField, cIDs + first, x, num, _gridSizeX, _offsetX);
+		binsToPositions(_zField, cIDs + first, z, num, _gridSizeZ, _offsetZ);
+		for ( std::size_t i = 0; i < num; ++i )
+			localPositions[first + i] = Vector3D(x[i], 0., z[i]);
+	}
+}
+
+/// determine the cell IDs of n positions in chunks
+void CartesianGridXZ::cellIDs(const Vector3D* localPositions, const Vector3D* globalPositions,
+                         const VolumeID* vIDs, CellID* cIDs, std::size_t n) const {
+	// Derived classes may override cellID(): the fast path is only valid for this exact type
+	if ( typeid(*this) != typeid(CartesianGridXZ) ) {
+		Segmentation::cellIDs(localPositions, globalPositions, vIDs, cIDs, n);
+		return;
+	}
+	double x[BATCH_CHUNK_SIZE], z[BATCH_CHUNK_SIZE];
+	long64 xBin[BATCH_CHUNK_SIZE], zBin[BATCH_CHUNK_SIZE];
+	for ( std::size_t first = 0; first < n; first += BATCH_CHUNK_SIZE ) {
+		const std::size_t num = n - first < std::size_t(BATCH_CHUNK_SIZE) ? n - first : std::size_t(BATCH_CHUNK_SIZE);
+		for ( std::size_t i = 0; i < num; ++i ) {
+			x[i] = localPositions[first + i].X;
+			z[i] = localPositions[first + i].Z;
+			cIDs[first + i] = vIDs[first + i];
+		}
+		positionsToBins(x, xBin, num, _gridSizeX, _offsetX);
+		positionsToBins(z, zBin, num, _gridSizeZ, _offsetZ);
+		// Out of range bins: redo the chunk with the scalar call to get the proper error
+		if ( !encodeBins(_xField, xBin, cIDs + first, num) ||
+		     !encodeBins(_zField, zBin, cIDs + first, num) ) {
+			Segmentation::cellIDs(localPositions + first, globalPositions + first, vIDs + first, cIDs + first, num);
+		}
+	}
+}
+
 std::vector<double> CartesianGridXZ::cellDimensions(const CellID&) const {
 #if __cplusplus >= 201103L
   return {_gridSizeX, _gridSizeZ};
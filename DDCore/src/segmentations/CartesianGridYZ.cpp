@@ -8,6 +8,8 @@
  */
 #include "DDSegmentation/CartesianGridYZ.h"
 
+#include <typeinfo>
+
 namespace dd4hep {
 namespace DDSegmentation {
 
@@ -24,7 +26,9 @@ CartesianGridYZ::CartesianGridYZ(const std::string& cellEncoding) :
 	registerParameter("offset_y", "Cell offset in Y", _offsetY, 0., SegmentationParameter::LengthUnit, true);
 	registerParameter("offset_z", "Cell offset in Z", _offsetZ, 0., SegmentationParameter::LengthUnit, true);
 	registerIdentifier("identifier_y", "Cell ID identifier for Y", _yId, "y");
+	registerFieldHandle(_yId, _yField);
 	registerIdentifier("identifier_z", "Cell ID identifier for Z", _zId, "z");
+	registerFieldHandle(_zId, _zField);
 }
 
 
@@ -41,7 +45,9 @@ CartesianGridYZ::CartesianGridYZ(const BitFieldCoder* decode) : CartesianGrid(de
 	registerParameter("offset_y", "Cell offset in Y", _offsetY, 0., SegmentationParameter::LengthUnit, true);
 	registerParameter("offset_z", "Cell offset in Z", _offsetZ, 0., SegmentationParameter::LengthUnit, true);
 	registerIdentifier("identifier_y", "Cell ID identifier for Y", _yId, "y");
+	registerFieldHandle(_yId, _yField);
 	registerIdentifier("identifier_z", "Cell ID identifier for Z", _zId, "z");
+	registerFieldHandle(_zId, _zField);
 }
 
 /// destructor
@@ -52,19 +58,63 @@ CartesianGridYZ::~CartesianGridYZ() {
 /// determine the position based on the cell ID
 Vector3D CartesianGridYZ::position(const CellID& cID) const {
 	Vector3D cellPosition;
-	cellPosition.Y = binToPosition( _decoder->get(cID,_yId ), _gridSizeY, _offsetY);
-	cellPosition.Z = binToPosition( _decoder->get(cID,_zId ), _gridSizeZ, _offsetZ);
+	cellPosition.Y = binToPosition( _yField.value(cID), _gridSizeY, _offsetY);
+	cellPosition.Z = binToPosition( _zField.value(cID), _gridSizeZ, _offsetZ);
 	return cellPosition;
 }
 
 /// determine the cell ID based on the position
   CellID CartesianGridYZ::cellID(const Vector3D& localPosition, const Vector3D& /* globalPosition */, const VolumeID& vID) const {
         CellID cID = vID ;
-	_decoder->set( cID,_yId, positionToBin(localPosition.Y, _gridSizeY, _offsetY) );
-	_decoder->set( cID,_zId, positionToBin(localPosition.Z, _gridSizeZ, _offsetZ) );
+	_yField.set(cID, positionToBin(localPosition.Y, _gridSizeY, _offsetY) );
+	_zField.set(cID, positionToBin(localPosition.Z, _gridSizeZ, _offsetZ) );
 	return cID ;
 }
 
+/// determine the local positions of n cell IDs in chunks
+void CartesianGridYZ::positions(const CellID* cIDs, Vector3D* localPositions, std::size_t n) const {
+	// Derived classes may override position(): the fast path is only valid for this exact type
+	if ( typeid(*this) != typeid(CartesianGridYZ) ) {
+		Segmentation::positions(cIDs, localPositions, n);
+		return;
+	}
+	double y[BATCH_CHUNK_SIZE], z[BATCH_CHUNK_SIZE];
+	for ( std::size_t first = 0; first < n; first += BATCH_CHUNK_SIZE ) {
+		const std::size_t num = n - first < std::size_t(BATCH_CHUNK_SIZE) ? n - first : std::size_t(BATCH_CHUNK_SIZE);
+		binsToPositions(_yField, cIDs + first, y, num, _gridSizeY, _offsetY);
+		binsToPositions(_zField, cIDs + first, z, num, _gridSizeZ, _offsetZ);
+		for ( std::size_t i = 0; i < num; ++i )
+			localPositions[first + i] = Vector3D(0., y[i], z[i]);
+	}
+}
+
+/// determine the cell IDs of n positions in chunks
+void CartesianGridYZ::cellIDs(const Vector3D* localPositions, const Vector3D* globalPositions,
+                         const VolumeID* vIDs, CellID* cIDs, std::size_t n) const {
+	// Derived classes may override cellID(): the fast path is only valid for this exact type
+	if ( typeid(*this) != typeid(CartesianGridYZ) ) {
+		Segmentation::cellIDs(localPositions, globalPositions, vIDs, cIDs, n);
+		return;
+	}
+	double y[BATCH_CHUNK_SIZE], z[BATCH_CHUNK_SIZE];
+	long64 yBin[BATCH_CHUNK_SIZE], zBin[BATCH_CHUNK_SIZE];
+	for ( std::size_t first = 0; first < n; first += BATCH_CHUNK_SIZE ) {
+		const std::size_t num = n - first < std::size_t(BATCH_CHUNK_SIZE) ? n - first : std::size_t(BATCH_CHUNK_SIZE);
+		for ( std::size_t i = 0; i < num; ++i ) {
+			y[i] = localPositions[first + i].Y;
+			z[i] = localPositions[first + i].Z;
+			cIDs[first + i] = vIDs[first + i];
+		}
+		positionsToBins(y, yBin, num, _gridSizeY, _offsetY);
+		positionsToBins(z, zBin, num, _gridSizeZ, _offsetZ);
+		// Out of range bins: redo the chunk with the scalar call to get the proper error
+		if ( !encodeBins(_yField, yBin, cIDs + first, num) ||
+		     !encodeBins(_zField, zBin, cIDs + first, num) ) {
+			Segmentation::cellIDs(localPositions + first, globalPositions + first, vIDs + first, cIDs + first, num);
+		}
+	}
+}
+
 std::vector<double> CartesianGridYZ::cellDimensions(const CellID&) const {
 #if __cplusplus >= 201103L
   return {_gridSizeY, _gridSizeZ};
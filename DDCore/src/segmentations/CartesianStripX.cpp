@@ -20,6 +20,7 @@ CartesianStripX::CartesianStripX(const std::string& cellEncoding) : CartesianStr
     registerParameter("strip_size_x", "Cell size in X", _stripSizeX, 1., SegmentationParameter::LengthUnit);
     registerParameter("offset_x", "Cell offset in X", _offsetX, 0., SegmentationParameter::LengthUnit, true);
     registerIdentifier("identifier_x", "Cell ID identifier for X", _xId, "strip");
+    registerFieldHandle(_xId, _xField);
 }
 
 /// Default constructor used by derived classes passing an existing decoder
@@ -32,6 +33,7 @@ CartesianStripX::CartesianStripX(const BitFieldCoder* decode) : CartesianStrip(d
     registerParameter("strip_size_x", "Cell size in X", _stripSizeX, 1., SegmentationParameter::LengthUnit);
     registerParameter("offset_x", "Cell offset in X", _offsetX, 0., SegmentationParameter::LengthUnit, true);
     registerIdentifier("identifier_x", "Cell ID identifier for X", _xId, "strip");
+    registerFieldHandle(_xId, _xField);
 }
 
 /// destructor
@@ -40,7 +42,7 @@ CartesianStripX::~CartesianStripX() {}
 /// determine the position based on the cell ID
 Vector3D CartesianStripX::position(const CellID& cID) const {
     Vector3D cellPosition;
-    cellPosition.X = binToPosition(_decoder->get(cID, _xId), _stripSizeX, _offsetX);
+    cellPosition.X = binToPosition(_xField.value(cID), _stripSizeX, _offsetX);
     return cellPosition;
 }
 
@@ -48,7 +50,7 @@ Vector3D CartesianStripX::position(const CellID& cID) const {
 CellID CartesianStripX::cellID(const Vector3D& localPosition, const Vector3D& /* globalPosition */,
                                const VolumeID& vID) const {
     CellID cID = vID;
-    _decoder->set(cID, _xId, positionToBin(localPosition.X, _stripSizeX, _offsetX));
+    _xField.set(cID, positionToBin(localPosition.X, _stripSizeX, _offsetX));
     return cID;
 }
 
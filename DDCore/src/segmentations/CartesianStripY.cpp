@@ -20,6 +20,7 @@ CartesianStripY::CartesianStripY(const std::string& cellEncoding) : CartesianStr
     registerParameter("strip_size_x", "Cell size in Y", _stripSizeY, 1., SegmentationParameter::LengthUnit);
     registerParameter("offset_x", "Cell offset in Y", _offsetY, 0., SegmentationParameter::LengthUnit, true);
     registerIdentifier("identifier_x", "Cell ID identifier for Y", _xId, "strip");
+    registerFieldHandle(_xId, _xField);
 }
 
 /// Default constructor used by derived classes passing an existing decoder
@@ -32,6 +33,7 @@ CartesianStripY::CartesianStripY(const BitFieldCoder* decode) : CartesianStrip(d
     registerParameter("strip_size_x", "Cell size in Y", _stripSizeY, 1., SegmentationParameter::LengthUnit);
     registerParameter("offset_x", "Cell offset in Y", _offsetY, 0., SegmentationParameter::LengthUnit, true);
     registerIdentifier("identifier_x", "Cell ID identifier for Y", _xId, "strip");
+    registerFieldHandle(_xId, _xField);
 }
 
 /// destructor
@@ -40,7 +42,7 @@ CartesianStripY::~CartesianStripY() {}
 /// determine the position based on the cell ID
 Vector3D CartesianStripY::position(const CellID& cID) const {
     Vector3D cellPosition;
-    cellPosition.Y = binToPosition(_decoder->get(cID, _xId), _stripSizeY, _offsetY);
+    cellPosition.Y = binToPosition(_xField.value(cID), _stripSizeY, _offsetY);
     return cellPosition;
 }
 
@@ -48,7 +50,7 @@ Vector3D CartesianStripY::position(const CellID& cID) const {
 CellID CartesianStripY::cellID(const Vector3D& localPosition, const Vector3D& /* globalPosition */,
                                const VolumeID& vID) const {
     CellID cID = vID;
-    _decoder->set(cID, _xId, positionToBin(localPosition.Y, _stripSizeY, _offsetY));
+    _xField.set(cID, positionToBin(localPosition.Y, _stripSizeY, _offsetY));
     return cID;
 }
 
@@ -20,6 +20,7 @@ CartesianStripZ::CartesianStripZ(const std::string& cellEncoding) : CartesianStr
     registerParameter("strip_size_x", "Cell size in Z", _stripSizeZ, 1., SegmentationParameter::LengthUnit);
     registerParameter("offset_x", "Cell offset in Z", _offsetZ, 0., SegmentationParameter::LengthUnit, true);
     registerIdentifier("identifier_x", "Cell ID identifier for Z", _xId, "strip");
+    registerFieldHandle(_xId, _xField);
 }
 
 /// Default constructor used by derived classes passing an existing decoder
@@ -32,6 +33,7 @@ CartesianStripZ::CartesianStripZ(const BitFieldCoder* decode) : CartesianStrip(d
     registerParameter("strip_size_x", "Cell size in Z", _stripSizeZ, 1., SegmentationParameter::LengthUnit);
     registerParameter("offset_x", "Cell offset in Z", _offsetZ, 0., SegmentationParameter::LengthUnit, true);
     registerIdentifier("identifier_x", "Cell ID identifier for Z", _xId, "strip");
+    registerFieldHandle(_xId, _xField);
 }
 
 /// destructor
@@ -40,7 +42,7 @@ CartesianStripZ::~CartesianStripZ() {}
 /// determine the position based on the cell ID
 Vector3D CartesianStripZ::position(const CellID& cID) const {
     Vector3D cellPosition;
-    cellPosition.Z = binToPosition(_decoder->get(cID, _xId), _stripSizeZ, _offsetZ);
+    cellPosition.Z = binToPosition(_xField.value(cID), _stripSizeZ, _offsetZ);
     return cellPosition;
 }
 
@@ -48,7 +50,7 @@ Vector3D CartesianStripZ::position(const CellID& cID) const {
 CellID CartesianStripZ::cellID(const Vector3D& localPosition, const Vector3D& /* globalPosition */,
                                const VolumeID& vID) const {
     CellID cID = vID;
-    _decoder->set(cID, _xId, positionToBin(localPosition.Z, _stripSizeZ, _offsetZ));
+    _xField.set(cID, positionToBin(localPosition.Z, _stripSizeZ, _offsetZ));
     return cID;
 }
 
@@ -1,6 +1,8 @@
 #include "DDSegmentation/GridPhiEta.h"
 #include "DDSegmentation/SegmentationUtil.h"
 
+#include <typeinfo>
+
 namespace dd4hep {
 namespace DDSegmentation {
 
@@ -16,7 +18,9 @@ GridPhiEta::GridPhiEta(const std::string& cellEncoding) :
   registerParameter("offset_eta", "Angular offset in eta", m_offsetEta, 0., SegmentationParameter::AngleUnit, true);
   registerParameter("offset_phi", "Angular offset in phi", m_offsetPhi, 0., SegmentationParameter::AngleUnit, true);
   registerIdentifier("identifier_eta", "Cell ID identifier for eta", m_etaID, "eta");
+  registerFieldHandle(m_etaID, m_etaField);
   registerIdentifier("identifier_phi", "Cell ID identifier for phi", m_phiID, "phi");
+  registerFieldHandle(m_phiID, m_phiField);
 }
 
 GridPhiEta::GridPhiEta(const BitFieldCoder* aDecoder) :
@@ -31,7 +35,9 @@ GridPhiEta::GridPhiEta(const BitFieldCoder* aDecoder) :
   registerParameter("offset_eta", "Angular offset in eta", m_offsetEta, 0., SegmentationParameter::AngleUnit, true);
   registerParameter("offset_phi", "Angular offset in phi", m_offsetPhi, 0., SegmentationParameter::AngleUnit, true);
   registerIdentifier("identifier_eta", "Cell ID identifier for eta", m_etaID, "eta");
+  registerFieldHandle(m_etaID, m_etaField);
   registerIdentifier("identifier_phi", "Cell ID identifier for phi", m_phiID, "phi");
+  registerFieldHandle(m_phiID, m_phiField);
 }
 
 Vector3D GridPhiEta::position(const CellID& cID) const {
@@ -42,17 +48,63 @@ CellID GridPhiEta::cellID(const Vector3D& /* localPosition */, const Vector3D& g
   double lEta = Util::etaFromXYZ(globalPosition);
   double lPhi = Util::phiFromXYZ(globalPosition);
   CellID cID = vID ;
-  _decoder->set( cID, m_etaID, positionToBin(lEta, m_gridSizeEta, m_offsetEta) );
-  _decoder->set( cID, m_phiID, positionToBin(lPhi, 2 * M_PI / (double) m_phiBins, m_offsetPhi) );
+  m_etaField.set(cID, positionToBin(lEta, m_gridSizeEta, m_offsetEta) );
+  m_phiField.set(cID, positionToBin(lPhi, 2 * M_PI / (double) m_phiBins, m_offsetPhi) );
   return cID;
 }
 
+/// determine the positions of n cell IDs in chunks
+void GridPhiEta::positions(const CellID* cIDs, Vector3D* localPositions, std::size_t n) const {
+  // Derived classes may override position(): the fast path is only valid for this exact type
+  if ( typeid(*this) != typeid(GridPhiEta) ) {
+    Segmentation::positions(cIDs, localPositions, n);
+    return;
+  }
+  const double phiSize = 2. * M_PI / (double) m_phiBins;
+  double eta[BATCH_CHUNK_SIZE], phi[BATCH_CHUNK_SIZE];
+  for ( std::size_t first = 0; first < n; first += BATCH_CHUNK_SIZE ) {
+    const std::size_t num = n - first < std::size_t(BATCH_CHUNK_SIZE) ? n - first : std::size_t(BATCH_CHUNK_SIZE);
+    binsToPositions(m_etaField, cIDs + first, eta, num, m_gridSizeEta, m_offsetEta);
+    binsToPositions(m_phiField, cIDs + first, phi, num, phiSize,       m_offsetPhi);
+    for ( std::size_t i = 0; i < num; ++i )
+      localPositions[first + i] = Util::positionFromREtaPhi(1.0, eta[i], phi[i]);
+  }
+}
+
+/// determine the cell IDs of n global positions in chunks
+void GridPhiEta::cellIDs(const Vector3D* localPositions, const Vector3D* globalPositions,
+                      const VolumeID* vIDs, CellID* cIDs, std::size_t n) const {
+  // Derived classes may override cellID(): the fast path is only valid for this exact type
+  if ( typeid(*this) != typeid(GridPhiEta) ) {
+    Segmentation::cellIDs(localPositions, globalPositions, vIDs, cIDs, n);
+    return;
+  }
+  const double phiSize = 2. * M_PI / (double) m_phiBins;
+  double eta[BATCH_CHUNK_SIZE], phi[BATCH_CHUNK_SIZE];
+  long64 etaBin[BATCH_CHUNK_SIZE], phiBin[BATCH_CHUNK_SIZE];
+  for ( std::size_t first = 0; first < n; first += BATCH_CHUNK_SIZE ) {
+    const std::size_t num = n - first < std::size_t(BATCH_CHUNK_SIZE) ? n - first : std::size_t(BATCH_CHUNK_SIZE);
+    for ( std::size_t i = 0; i < num; ++i ) {
+      eta[i] = Util::etaFromXYZ(globalPositions[first + i]);
+      phi[i] = Util::phiFromXYZ(globalPositions[first + i]);
+      cIDs[first + i] = vIDs[first + i];
+    }
+    positionsToBins(eta, etaBin, num, m_gridSizeEta, m_offsetEta);
+    positionsToBins(phi, phiBin, num, phiSize,       m_offsetPhi);
+    // Out of range bins: redo the chunk with the scalar call to get the proper error
+    if ( !encodeBins(m_etaField, etaBin, cIDs + first, num) ||
+         !encodeBins(m_phiField, phiBin, cIDs + first, num) ) {
+      Segmentation::cellIDs(localPositions + first, globalPositions + first, vIDs + first, cIDs + first, num);
+    }
+  }
+}
+
 double GridPhiEta::eta(const CellID& cID) const {
-  CellID etaValue = _decoder->get(cID, m_etaID);
+  CellID etaValue = m_etaField.value(cID);
   return binToPosition(etaValue, m_gridSizeEta, m_offsetEta);
 }
 double GridPhiEta::phi(const CellID& cID) const {
-  CellID phiValue = _decoder->get(cID, m_phiID);
+  CellID phiValue = m_phiField.value(cID);
   return binToPosition(phiValue, 2.*M_PI/(double)m_phiBins, m_offsetPhi);
 }
 }
@@ -1,6 +1,8 @@
 #include "DDSegmentation/GridRPhiEta.h"
 #include "DDSegmentation/SegmentationUtil.h"
 
+#include <typeinfo>
+
 namespace dd4hep {
 namespace DDSegmentation {
 
@@ -14,6 +16,7 @@ GridRPhiEta::GridRPhiEta(const std::string& cellEncoding) :
   registerParameter("grid_size_r", "Cell size in radial distance", m_gridSizeR, 1., SegmentationParameter::LengthUnit);
   registerParameter("offset_r", "Angular offset in radial distance", m_offsetR, 0., SegmentationParameter::LengthUnit, true);
   registerIdentifier("identifier_r", "Cell ID identifier for R", m_rID, "r");
+  registerFieldHandle(m_rID, m_rField);
 }
 
 GridRPhiEta::GridRPhiEta(const BitFieldCoder* aDecoder) :
@@ -26,6 +29,7 @@ GridRPhiEta::GridRPhiEta(const BitFieldCoder* aDecoder) :
   registerParameter("grid_size_r", "Cell size in radial distance", m_gridSizeR, 1., SegmentationParameter::LengthUnit);
   registerParameter("offset_r", "Angular offset in radial distance", m_offsetR, 0., SegmentationParameter::LengthUnit, true);
   registerIdentifier("identifier_r", "Cell ID identifier for R", m_rID, "r");
+  registerFieldHandle(m_rID, m_rField);
 }
 
 Vector3D GridRPhiEta::position(const CellID& cID) const {
@@ -37,14 +41,64 @@ CellID GridRPhiEta::cellID(const Vector3D& /* localPosition */, const Vector3D&
   double lEta = Util::etaFromXYZ(globalPosition);
   double lPhi = Util::phiFromXYZ(globalPosition);
   CellID cID = vID ;
-  _decoder->set( cID, m_etaID, positionToBin(lEta, m_gridSizeEta, m_offsetEta) );
-  _decoder->set( cID, m_phiID, positionToBin(lPhi, 2 * M_PI / (double) m_phiBins, m_offsetPhi) );
-  _decoder->set( cID, m_rID  , positionToBin(lRadius, m_gridSizeR, m_offsetR) );
+  m_etaField.set(cID, positionToBin(lEta, m_gridSizeEta, m_offsetEta) );
+  m_phiField.set(cID, positionToBin(lPhi, 2 * M_PI / (double) m_phiBins, m_offsetPhi) );
+  m_rField.set(cID, positionToBin(lRadius, m_gridSizeR, m_offsetR) );
   return cID;
 }
 
+/// determine the positions of n cell IDs in chunks
+void GridRPhiEta::positions(const CellID* cIDs, Vector3D* localPositions, std::size_t n) const {
+  // Derived classes may override position(): the fast path is only valid for this exact type
+  if ( typeid(*this) != typeid(GridRPhiEta) ) {
+    Segmentation::positions(cIDs, localPositions, n);
+    return;
+  }
+  const double phiSize = 2. * M_PI / (double) m_phiBins;
+  double eta[BATCH_CHUNK_SIZE], phi[BATCH_CHUNK_SIZE], r[BATCH_CHUNK_SIZE];
+  for ( std::size_t first = 0; first < n; first += BATCH_CHUNK_SIZE ) {
+    const std::size_t num = n - first < std::size_t(BATCH_CHUNK_SIZE) ? n - first : std::size_t(BATCH_CHUNK_SIZE);
+    binsToPositions(m_etaField, cIDs + first, eta, num, m_gridSizeEta, m_offsetEta);
+    binsToPositions(m_phiField, cIDs + first, phi, num, phiSize,       m_offsetPhi);
+    binsToPositions(m_rField,   cIDs + first, r,   num, m_gridSizeR,   m_offsetR);
+    for ( std::size_t i = 0; i < num; ++i )
+      localPositions[first + i] = Util::positionFromREtaPhi(r[i], eta[i], phi[i]);
+  }
+}
+
+/// determine the cell IDs of n global positions in chunks
+void GridRPhiEta::cellIDs(const Vector3D* localPositions, const Vector3D* globalPositions,
+                       const VolumeID* vIDs, CellID* cIDs, std::size_t n) const {
+  // Derived classes may override cellID(): the fast path is only valid for this exact type
+  if ( typeid(*this) != typeid(GridRPhiEta) ) {
+    Segmentation::cellIDs(localPositions, globalPositions, vIDs, cIDs, n);
+    return;
+  }
+  const double phiSize = 2. * M_PI / (double) m_phiBins;
+  double eta[BATCH_CHUNK_SIZE], phi[BATCH_CHUNK_SIZE], r[BATCH_CHUNK_SIZE];
+  long64 etaBin[BATCH_CHUNK_SIZE], phiBin[BATCH_CHUNK_SIZE], rBin[BATCH_CHUNK_SIZE];
+  for ( std::size_t first = 0; first < n; first += BATCH_CHUNK_SIZE ) {
+    const std::size_t num = n - first < std::size_t(BATCH_CHUNK_SIZE) ? n - first : std::size_t(BATCH_CHUNK_SIZE);
+    for ( std::size_t i = 0; i < num; ++i ) {
+      r[i]   = Util::radiusFromXYZ(globalPositions[first + i]);
+      eta[i] = Util::etaFromXYZ(globalPositions[first + i]);
+      phi[i] = Util::phiFromXYZ(globalPositions[first + i]);
+      cIDs[first + i] = vIDs[first + i];
+    }
+    positionsToBins(eta, etaBin, num, m_gridSizeEta, m_offsetEta);
+    positionsToBins(phi, phiBin, num, phiSize,       m_offsetPhi);
+    positionsToBins(r,   rBin,   num, m_gridSizeR,   m_offsetR);
+    // Out of range bins: redo the chunk with the scalar call to get the proper error
+    if ( !encodeBins(m_etaField, etaBin, cIDs + first, num) ||
+         !encodeBins(m_phiField, phiBin, cIDs + first, num) ||
+         !encodeBins(m_rField, rBin, cIDs + first, num) ) {
+      Segmentation::cellIDs(localPositions + first, globalPositions + first, vIDs + first, cIDs + first, num);
+    }
+  }
+}
+
 double GridRPhiEta::r(const CellID& cID) const {
-  CellID rValue = _decoder->get(cID, m_rID);
+  CellID rValue = m_rField.value(cID);
   return binToPosition(rValue, m_gridSizeR, m_offsetR);
 }
 }
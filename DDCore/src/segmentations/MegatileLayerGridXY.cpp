@@ -40,13 +40,17 @@ namespace dd4hep {
       _description = "Cartesian segmentation in the local XY-plane: megatiles, containing integer number of tiles/strips/cells";
 
       registerIdentifier("identifier_x", "Cell ID identifier for X", _xId, "cellX");
+      registerFieldHandle(_xId, _xField);
       registerIdentifier("identifier_y", "Cell ID identifier for Y", _yId, "cellY");
+      registerFieldHandle(_yId, _yField);
 
       registerParameter("identifier_wafer", "Cell encoding identifier for wafer", _identifierWafer, std::string("wafer"),
                         SegmentationParameter::NoUnit, true);
+      registerFieldHandle(_identifierWafer, _waferField);
 
       registerParameter("identifier_layer", "Cell encoding identifier for layer", _identifierLayer, std::string("layer"),
                         SegmentationParameter::NoUnit, true);
+      registerFieldHandle(_identifierLayer, _layerField);
 
       registerParameter("identifier_module", "Cell encoding identifier for module", _identifierModule, std::string("module"),
                         SegmentationParameter::NoUnit, true);
@@ -63,10 +67,10 @@ namespace dd4hep {
     Vector3D MegatileLayerGridXY::position(const CellID& cID) const {
       // this is local position within the megatile
 
-      unsigned int layerIndex = _decoder->get(cID,_identifierLayer);
-      unsigned int waferIndex = _decoder->get(cID,_identifierWafer);
-      int cellIndexX = _decoder->get(cID,_xId);
-      int cellIndexY = _decoder->get(cID,_yId);
+      unsigned int layerIndex = _layerField.value(cID);
+      unsigned int waferIndex = _waferField.value(cID);
+      int cellIndexX = _xField.value(cID);
+      int cellIndexY = _yField.value(cID);
 
       // segmentation info for this megatile ("wafer")
       getSegInfo(layerIndex, waferIndex);
@@ -94,8 +98,8 @@ namespace dd4hep {
       // this is the local position within a megatile, local coordinates
 
       // get the layer, wafer, module indices from the volumeID
-      unsigned int layerIndex = _decoder->get(vID,_identifierLayer);
-      unsigned int waferIndex = _decoder->get(vID,_identifierWafer);
+      unsigned int layerIndex = _layerField.value(vID);
+      unsigned int waferIndex = _waferField.value(vID);
 
       // segmentation info for this megatile ("wafer")
       getSegInfo(layerIndex, waferIndex);
@@ -112,16 +116,16 @@ namespace dd4hep {
       int _cellIndexY = int ( localY / ( _currentSegInfo.megaTileSizeY / _currentSegInfo.nCellsY ) );
 
       CellID cID = vID ;
-      _decoder->set(cID,_xId,_cellIndexX);
-      _decoder->set(cID,_yId,_cellIndexY);
+      _xField.set(cID, _cellIndexX);
+      _yField.set(cID, _cellIndexY);
 
       return cID;
     }
 
 
     std::vector<double> MegatileLayerGridXY::cellDimensions(const CellID& cID) const {
-      unsigned int layerIndex = _decoder->get(cID,_identifierLayer);
-      unsigned int waferIndex = _decoder->get(cID,_identifierWafer);
+      unsigned int layerIndex = _layerField.value(cID);
+      unsigned int waferIndex = _waferField.value(cID);
       return cellDimensions(layerIndex, waferIndex);
     }
 
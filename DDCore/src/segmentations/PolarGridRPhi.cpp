@@ -7,6 +7,8 @@
 
 #include "DDSegmentation/PolarGridRPhi.h"
 
+#include <typeinfo>
+
 namespace dd4hep {
 namespace DDSegmentation {
 
@@ -23,7 +25,9 @@ PolarGridRPhi::PolarGridRPhi(const std::string& cellEncoding) :
 	registerParameter("offset_r", "Cell offset in R", _offsetR, 0., SegmentationParameter::LengthUnit, true);
 	registerParameter("offset_phi", "Cell offset in Phi", _offsetPhi, 0., SegmentationParameter::AngleUnit, true);
 	registerIdentifier("identifier_r", "Cell ID identifier for R", _rId, "r");
+	registerFieldHandle(_rId, _rField);
 	registerIdentifier("identifier_phi", "Cell ID identifier for Phi", _phiId, "phi");
+	registerFieldHandle(_phiId, _phiField);
 }
 
 
@@ -39,7 +43,9 @@ PolarGridRPhi::PolarGridRPhi(const BitFieldCoder* decode) : PolarGrid(decode) {
 	registerParameter("offset_r", "Cell offset in R", _offsetR, 0., SegmentationParameter::LengthUnit, true);
 	registerParameter("offset_phi", "Cell offset in Phi", _offsetPhi, 0., SegmentationParameter::AngleUnit, true);
 	registerIdentifier("identifier_r", "Cell ID identifier for R", _rId, "r");
+	registerFieldHandle(_rId, _rField);
 	registerIdentifier("identifier_phi", "Cell ID identifier for Phi", _phiId, "phi");
+	registerFieldHandle(_phiId, _phiField);
 }
 
 /// destructor
@@ -50,8 +56,8 @@ PolarGridRPhi::~PolarGridRPhi() {
 /// determine the position based on the cell ID
 Vector3D PolarGridRPhi::position(const CellID& cID) const {
 	Vector3D cellPosition;
-	double R =   binToPosition(_decoder->get(cID,_rId),   _gridSizeR,   _offsetR);
-	double phi = binToPosition(_decoder->get(cID,_phiId), _gridSizePhi, _offsetPhi);
+	double R =   binToPosition(_rField.value(cID),   _gridSizeR,   _offsetR);
+	double phi = binToPosition(_phiField.value(cID), _gridSizePhi, _offsetPhi);
 	
 	cellPosition.X = R * cos(phi);
 	cellPosition.Y = R * sin(phi);
@@ -64,13 +70,58 @@ Vector3D PolarGridRPhi::position(const CellID& cID) const {
 	double phi = atan2(localPosition.Y,localPosition.X);
 	double R = sqrt( localPosition.X * localPosition.X + localPosition.Y * localPosition.Y );
 	CellID cID = vID ;
-	_decoder->set(cID,_rId  , positionToBin(R, _gridSizeR, _offsetR));
-	_decoder->set(cID,_phiId, positionToBin(phi, _gridSizePhi, _offsetPhi));
+	_rField.set(cID, positionToBin(R, _gridSizeR, _offsetR));
+	_phiField.set(cID, positionToBin(phi, _gridSizePhi, _offsetPhi));
 	return cID;
 }
 
+/// determine the local positions of n cell IDs in chunks
+void PolarGridRPhi::positions(const CellID* cIDs, Vector3D* localPositions, std::size_t n) const {
+	// Derived classes may override position(): the fast path is only valid for this exact type
+	if ( typeid(*this) != typeid(PolarGridRPhi) ) {
+		Segmentation::positions(cIDs, localPositions, n);
+		return;
+	}
+	double r[BATCH_CHUNK_SIZE], phi[BATCH_CHUNK_SIZE];
+	for ( std::size_t first = 0; first < n; first += BATCH_CHUNK_SIZE ) {
+		const std::size_t num = n - first < std::size_t(BATCH_CHUNK_SIZE) ? n - first : std::size_t(BATCH_CHUNK_SIZE);
+		binsToPositions(_rField,   cIDs + first, r,   num, _gridSizeR,   _offsetR);
+		binsToPositions(_phiField, cIDs + first, phi, num, _gridSizePhi, _offsetPhi);
+		for ( std::size_t i = 0; i < num; ++i )
+			localPositions[first + i] = Vector3D(r[i] * cos(phi[i]), r[i] * sin(phi[i]), 0.);
+	}
+}
+
+/// determine the cell IDs of n positions in chunks
+void PolarGridRPhi::cellIDs(const Vector3D* localPositions, const Vector3D* globalPositions,
+                            const VolumeID* vIDs, CellID* cIDs, std::size_t n) const {
+	// Derived classes may override cellID(): the fast path is only valid for this exact type
+	if ( typeid(*this) != typeid(PolarGridRPhi) ) {
+		Segmentation::cellIDs(localPositions, globalPositions, vIDs, cIDs, n);
+		return;
+	}
+	double r[BATCH_CHUNK_SIZE], phi[BATCH_CHUNK_SIZE];
+	long64 rBin[BATCH_CHUNK_SIZE], phiBin[BATCH_CHUNK_SIZE];
+	for ( std::size_t first = 0; first < n; first += BATCH_CHUNK_SIZE ) {
+		const std::size_t num = n - first < std::size_t(BATCH_CHUNK_SIZE) ? n - first : std::size_t(BATCH_CHUNK_SIZE);
+		for ( std::size_t i = 0; i < num; ++i ) {
+			const Vector3D& pos = localPositions[first + i];
+			phi[i] = atan2(pos.Y, pos.X);
+			r[i]   = sqrt(pos.X * pos.X + pos.Y * pos.Y);
+			cIDs[first + i] = vIDs[first + i];
+		}
+		positionsToBins(r,   rBin,   num, _gridSizeR,   _offsetR);
+		positionsToBins(phi, phiBin, num, _gridSizePhi, _offsetPhi);
+		// Out of range bins: redo the chunk with the scalar call to get the proper error
+		if ( !encodeBins(_rField, rBin, cIDs + first, num) ||
+		     !encodeBins(_phiField, phiBin, cIDs + first, num) ) {
+			Segmentation::cellIDs(localPositions + first, globalPositions + first, vIDs + first, cIDs + first, num);
+		}
+	}
+}
+
 std::vector<double> PolarGridRPhi::cellDimensions(const CellID& cID) const {
-  const double rPhiSize = binToPosition(_decoder->get(cID,_rId), _gridSizeR, _offsetR)*_gridSizePhi;
+  const double rPhiSize = binToPosition(_rField.value(cID), _gridSizeR, _offsetR)*_gridSizePhi;
 #if __cplusplus >= 201103L
   return {_gridSizeR, rPhiSize};
 #else
@@ -23,7 +23,9 @@ PolarGridRPhi2::PolarGridRPhi2(const std::string& cellEncoding) :
 	registerParameter("offset_r", "Cell offset in R", _offsetR, double(0.), SegmentationParameter::LengthUnit, true);
 	registerParameter("offset_phi", "Cell offset in Phi", _offsetPhi, double(0.), SegmentationParameter::AngleUnit, true);
 	registerIdentifier("identifier_r", "Cell ID identifier for R", _rId, "r");
+	registerFieldHandle(_rId, _rField);
 	registerIdentifier("identifier_phi", "Cell ID identifier for Phi", _phiId, "phi");
+	registerFieldHandle(_phiId, _phiField);
 }
 
 /// Default constructor used by derived classes passing an existing decoder
@@ -39,7 +41,9 @@ PolarGridRPhi2::PolarGridRPhi2(const BitFieldCoder* decode) :
 	registerParameter("offset_r", "Cell offset in R", _offsetR, double(0.), SegmentationParameter::LengthUnit, true);
 	registerParameter("offset_phi", "Cell offset in Phi", _offsetPhi, double(0.), SegmentationParameter::AngleUnit, true);
 	registerIdentifier("identifier_r", "Cell ID identifier for R", _rId, "r");
+	registerFieldHandle(_rId, _rField);
 	registerIdentifier("identifier_phi", "Cell ID identifier for Phi", _phiId, "phi");
+	registerFieldHandle(_phiId, _phiField);
 }
 
 /// destructor
@@ -50,9 +54,9 @@ PolarGridRPhi2::~PolarGridRPhi2() {
 /// determine the position based on the cell ID
 Vector3D PolarGridRPhi2::position(const CellID& cID) const {
 	Vector3D cellPosition;
-	const int rBin = _decoder->get(cID,_rId);
+	const int rBin = _rField.value(cID);
 	double R = binToPosition(rBin, _gridRValues, _offsetR);
-	double phi = binToPosition(_decoder->get(cID,_phiId), _gridPhiValues[rBin], _offsetPhi+_gridPhiValues[rBin]*0.5);
+	double phi = binToPosition(_phiField.value(cID), _gridPhiValues[rBin], _offsetPhi+_gridPhiValues[rBin]*0.5);
 
 	if ( phi < _offsetPhi) {
 	  phi += 2*M_PI;
@@ -73,13 +77,13 @@ Vector3D PolarGridRPhi2::position(const CellID& cID) const {
 	const int rBin = positionToBin(R, _gridRValues, _offsetR);
 
 	CellID cID = vID ;
-	_decoder->set(cID,_rId, rBin);
+	_rField.set(cID, rBin);
 
 	if ( phi < _offsetPhi) {
 	  phi += 2*M_PI;
 	}
 	const int pBin = positionToBin(phi, _gridPhiValues[rBin], _offsetPhi+_gridPhiValues[rBin]*0.5);
-	_decoder->set(cID,_phiId,pBin);
+	_phiField.set(cID, pBin);
 
 	return cID;
 }
@@ -87,7 +91,7 @@ Vector3D PolarGridRPhi2::position(const CellID& cID) const {
 
 std::vector<double> PolarGridRPhi2::cellDimensions(const CellID& cID) const {
 
-  const int rBin = _decoder->get(cID,_rId);
+  const int rBin = _rField.value(cID);
   const double rCenter = binToPosition(rBin, _gridRValues, _offsetR);
 
   const double rPhiSize = _gridPhiValues[rBin]*rCenter;
@@ -30,7 +30,9 @@ ProjectiveCylinder::ProjectiveCylinder(const std::string& cellEncoding) :
 	registerParameter("offset_theta", "Angular offset in theta", _offsetTheta, 0., SegmentationParameter::AngleUnit, true);
 	registerParameter("offset_phi", "Angular offset in phi", _offsetPhi, 0., SegmentationParameter::AngleUnit, true);
 	registerIdentifier("identifier_theta", "Cell ID identifier for theta", _thetaID, "theta");
+	registerFieldHandle(_thetaID, _thetaField);
 	registerIdentifier("identifier_phi", "Cell ID identifier for phi", _phiID, "phi");
+	registerFieldHandle(_phiID, _phiField);
 }
 
 
@@ -46,7 +48,9 @@ ProjectiveCylinder::ProjectiveCylinder(const BitFieldCoder* decode) :	Cylindrica
 	registerParameter("offset_theta", "Angular offset in theta", _offsetTheta, 0., SegmentationParameter::AngleUnit, true);
 	registerParameter("offset_phi", "Angular offset in phi", _offsetPhi, 0., SegmentationParameter::AngleUnit, true);
 	registerIdentifier("identifier_theta", "Cell ID identifier for theta", _thetaID, "theta");
+	registerFieldHandle(_thetaID, _thetaField);
 	registerIdentifier("identifier_phi", "Cell ID identifier for phi", _phiID, "phi");
+	registerFieldHandle(_phiID, _phiField);
 }
 
 /// destructor
@@ -64,19 +68,19 @@ CellID ProjectiveCylinder::cellID(const Vector3D& /* localPosition */, const Vec
         CellID cID = vID ;
 	double lTheta = thetaFromXYZ(globalPosition);
 	double lPhi = phiFromXYZ(globalPosition);
-	_decoder->set(cID,_thetaID, positionToBin(lTheta, M_PI / (double) _thetaBins, _offsetTheta));
-	_decoder->set(cID,_phiID  , positionToBin(lPhi, 2 * M_PI / (double) _phiBins, _offsetPhi));
+	_thetaField.set(cID, positionToBin(lTheta, M_PI / (double) _thetaBins, _offsetTheta));
+	_phiField.set(cID, positionToBin(lPhi, 2 * M_PI / (double) _phiBins, _offsetPhi));
 	return cID;
 }
 
 /// determine the polar angle theta based on the cell ID
 double ProjectiveCylinder::theta(const CellID& cID) const {
-        CellID thetaIndex = _decoder->get(cID,_thetaID);
+        CellID thetaIndex = _thetaField.value(cID);
 	return M_PI * ((double) thetaIndex + 0.5) / (double) _thetaBins;
 }
 /// determine the azimuthal angle phi based on the cell ID
 double ProjectiveCylinder::phi(const CellID& cID) const {
-        CellID phiIndex = _decoder->get(cID,_phiID);
+        CellID phiIndex = _phiField.value(cID);
 	return 2. * M_PI * ((double) phiIndex + 0.5) / (double) _phiBins;
 }
 
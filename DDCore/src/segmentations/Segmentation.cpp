@@ -52,6 +52,19 @@ namespace dd4hep {
       throw std::runtime_error("This segmentation type:"+_type+" does not support sub-segmentations.");
     }
 
+    /// Determine the local positions of n cell IDs. The default implementation loops over position()
+    void Segmentation::positions(const CellID* cIDs, Vector3D* localPositions, std::size_t n) const {
+      for ( std::size_t i = 0; i < n; ++i )
+        localPositions[i] = position(cIDs[i]);
+    }
+
+    /// Determine the cell IDs of n positions. The default implementation loops over cellID()
+    void Segmentation::cellIDs(const Vector3D* localPositions, const Vector3D* globalPositions,
+                               const VolumeID* vIDs, CellID* cIDs, std::size_t n) const {
+      for ( std::size_t i = 0; i < n; ++i )
+        cIDs[i] = cellID(localPositions[i], globalPositions[i], vIDs[i]);
+    }
+
     /// Determine the volume ID from the full cell ID by removing all local fields
     VolumeID Segmentation::volumeID(const CellID& cID) const {
       map<std::string, StringParameter>::const_iterator it;
@@ -88,12 +101,13 @@ namespace dd4hep {
 
     /// Set the underlying decoder
     void Segmentation::setDecoder(const BitFieldCoder* newDecoder) {
-      if ( _decoder == newDecoder )
-        return; //self assignment
-      else if (_ownsDecoder)
-        delete _decoder;
-      _decoder = newDecoder;
-      _ownsDecoder = false;
+      if ( _decoder != newDecoder )  {
+        if (_ownsDecoder)
+          delete _decoder;
+        _decoder = newDecoder;
+        _ownsDecoder = false;
+      }
+      resolveFieldHandles();
     }
 
     /// Access to parameter by name
@@ -119,6 +133,7 @@ namespace dd4hep {
     void Segmentation::setParameters(const Parameters& pars) {
       for ( const auto* p : pars )
         parameter(p->name())->value() = p->value();
+      resolveFieldHandles();
     }
 
     /// Add a cell identifier to this segmentation. Used by derived classes to define their required identifiers
@@ -127,10 +142,33 @@ namespace dd4hep {
       StringParameter idParameter =
         new TypedSegmentationParameter<std::string>(idName, idDescription, identifier, defaultValue,
                                                     SegmentationParameter::NoUnit, true);
+      idParameter->setChangedCallback([this]() { this->resolveFieldHandles(); });
       _parameters[idName]       = idParameter;
       _indexIdentifiers[idName] = idParameter;
     }
 
+    /// Bind a resolved field handle to the identifier string. Re-resolved whenever the decoder or the parameters change
+    void Segmentation::registerFieldHandle(const std::string& identifier, BitFieldHandle& handle)  {
+      // Identifiers registered as plain string parameters must also re-resolve the handles when overridden
+      for ( auto& p : _parameters )  {
+        auto* par = dynamic_cast<TypedSegmentationParameter<std::string>*>(p.second);
+        if ( par && &par->typedValue() == &identifier )  {
+          par->setChangedCallback([this]() { this->resolveFieldHandles(); });
+          break;
+        }
+      }
+      _fieldHandles.emplace_back(&identifier, &handle);
+      handle = (_decoder && _decoder->hasField(identifier)) ? _decoder->handle(identifier) : BitFieldHandle();
+    }
+
+    /// Resolve all registered field handles against the current decoder
+    void Segmentation::resolveFieldHandles()  {
+      for ( auto& h : _fieldHandles )  {
+        const std::string& identifier = *h.first;
+        *h.second = (_decoder && _decoder->hasField(identifier)) ? _decoder->handle(identifier) : BitFieldHandle();
+      }
+    }
+
     /// Helper method to convert a bin number to a 1D position
     double Segmentation::binToPosition(long64 bin, double cellSize, double offset) {
       return bin * cellSize + offset;
@@ -144,6 +182,39 @@ namespace dd4hep {
       return int(floor((position + 0.5 * cellSize - offset) / cellSize));
     }
 
+    /// Batch helper: convert n 1D positions to bins
+    void Segmentation::positionsToBins(const double* pos, long64* bins, std::size_t n,
+                                       double cellSize, double offset) {
+      if (cellSize <= 1e-10) {
+        throw runtime_error("Invalid cell size: 0.0");
+      }
+      for ( std::size_t i = 0; i < n; ++i )
+        bins[i] = int(floor((pos[i] + 0.5 * cellSize - offset) / cellSize));
+    }
+
+    /// Batch helper: decode the bins of one field of n cell IDs and convert them to 1D positions
+    void Segmentation::binsToPositions(const BitFieldHandle& field, const CellID* cIDs, double* pos,
+                                       std::size_t n, double cellSize, double offset) {
+      if ( !field.isValid() )  {
+        throw runtime_error("Segmentation: batch access to unresolved cell ID field");
+      }
+      for ( std::size_t i = 0; i < n; ++i )
+        pos[i] = double(field.decode(cIDs[i])) * cellSize + offset;
+    }
+
+    /// Batch helper: encode n bins into one field of the cell IDs. Returns false if any bin is out of range
+    bool Segmentation::encodeBins(const BitFieldHandle& field, const long64* bins, CellID* cIDs, std::size_t n) {
+      const long64 minVal = field.minValue(), maxVal = field.maxValue();
+      bool inRange = field.isValid();
+      for ( std::size_t i = 0; i < n; ++i )
+        inRange &= (bins[i] >= minVal) & (bins[i] <= maxVal);
+      if ( !inRange )
+        return false;
+      for ( std::size_t i = 0; i < n; ++i )
+        cIDs[i] = field.encode(cIDs[i], bins[i]);
+      return true;
+    }
+
     /// Helper method to convert a bin number to a 1D position given a vector of binBoundaries
     double Segmentation::binToPosition(CellID bin, std::vector<double> const& cellBoundaries, double offset) {
       return (cellBoundaries[bin+1] + cellBoundaries[bin])*0.5 + offset;
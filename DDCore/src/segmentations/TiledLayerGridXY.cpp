@@ -32,8 +32,11 @@ TiledLayerGridXY::TiledLayerGridXY(const std::string& cellEncoding) :
 	registerParameter("offset_x", "Cell offset in X", _offsetX, 0., SegmentationParameter::LengthUnit, true);
 	registerParameter("offset_y", "Cell offset in Y", _offsetY, 0., SegmentationParameter::LengthUnit, true);
 	registerIdentifier("identifier_x", "Cell ID identifier for X", _xId, "x");
+	registerFieldHandle(_xId, _xField);
 	registerIdentifier("identifier_y", "Cell ID identifier for Y", _yId, "y");
+	registerFieldHandle(_yId, _yField);
 	registerIdentifier("identifier_layer", "Cell encoding identifier for layer", _identifierLayer, "layer");
+	registerFieldHandle(_identifierLayer, _layerField);
 	registerParameter("layer_offsetX", "List of layer x offset", _layerOffsetX, std::vector<double>(),
 			SegmentationParameter::NoUnit, true);
 	registerParameter("layer_offsetY", "List of layer y offset", _layerOffsetY, std::vector<double>(),
@@ -54,8 +57,11 @@ TiledLayerGridXY::TiledLayerGridXY(const BitFieldCoder* decode) : CartesianGrid(
 	registerParameter("offset_x", "Cell offset in X", _offsetX, 0., SegmentationParameter::LengthUnit, true);
 	registerParameter("offset_y", "Cell offset in Y", _offsetY, 0., SegmentationParameter::LengthUnit, true);
 	registerIdentifier("identifier_x", "Cell ID identifier for X", _xId, "x");
+	registerFieldHandle(_xId, _xField);
 	registerIdentifier("identifier_y", "Cell ID identifier for Y", _yId, "y");
+	registerFieldHandle(_yId, _yField);
 	registerIdentifier("identifier_layer", "Cell encoding identifier for layer", _identifierLayer, "layer");
+	registerFieldHandle(_identifierLayer, _layerField);
 	registerParameter("layer_offsetX", "List of layer x offset", _layerOffsetX, std::vector<double>(),
 			SegmentationParameter::NoUnit, true);
 	registerParameter("layer_offsetY", "List of layer y offset", _layerOffsetY, std::vector<double>(),
@@ -73,10 +79,10 @@ Vector3D TiledLayerGridXY::position(const CellID& cID) const {
 	Vector3D cellPosition;
 
 	// AHcal: _layerIndex is [1,48], _layerOffsetX is [0,47]
-	_layerIndex = _decoder->get(cID,_identifierLayer);
+	_layerIndex = _layerField.value(cID);
 
 	if ( _layerOffsetX.size() != 0 && _layerIndex <=_layerOffsetX.size() ) {
-	  cellPosition.X = binToPosition(_decoder->get(cID,_xId), _gridSizeX, _layerOffsetX[_layerIndex - 1]*_gridSizeX/2.);
+	  cellPosition.X = binToPosition(_xField.value(cID), _gridSizeX, _layerOffsetX[_layerIndex - 1]*_gridSizeX/2.);
 	  // check the integer cell boundary in x,
 	  if ( ( _layerDimX.size() != 0 && _layerIndex <= _layerDimX.size() )
 	       &&( _fractCellSizeXPerLayer.size() != 0 && _layerIndex <=  _fractCellSizeXPerLayer.size() )
@@ -88,9 +94,9 @@ Vector3D TiledLayerGridXY::position(const CellID& cID) const {
 		*(_layerDimX.at(_layerIndex - 1) - _fractCellSizeXPerLayer.at(_layerIndex - 1)/2.0) ;
 	    }
 	} else {
-	  cellPosition.X = binToPosition(_decoder->get(cID,_xId), _gridSizeX, _offsetX);
+	  cellPosition.X = binToPosition(_xField.value(cID), _gridSizeX, _offsetX);
 	}
-	cellPosition.Y = binToPosition(_decoder->get(cID,_yId), _gridSizeY, _offsetY);
+	cellPosition.Y = binToPosition(_yField.value(cID), _gridSizeY, _offsetY);
 	return cellPosition;
 }
 
@@ -100,14 +106,14 @@ Vector3D TiledLayerGridXY::position(const CellID& cID) const {
 	unsigned int _layerIndex;
 
 	// AHcal: _layerIndex is [1,48], _layerOffsetX is [0,47]
-	_layerIndex = _decoder->get(cID,_identifierLayer);
+	_layerIndex = _layerField.value(cID);
 
 	if ( _layerOffsetX.size() != 0 && _layerIndex <=_layerOffsetX.size() ) {
-	  _decoder->set(cID,_xId,positionToBin(localPosition.X, _gridSizeX, _layerOffsetX[_layerIndex - 1]*_gridSizeX/2.));
+	  _xField.set(cID, positionToBin(localPosition.X, _gridSizeX, _layerOffsetX[_layerIndex - 1]*_gridSizeX/2.));
 	} else {
-	  _decoder->set(cID,_xId,positionToBin(localPosition.X, _gridSizeX, _offsetX));
+	  _xField.set(cID, positionToBin(localPosition.X, _gridSizeX, _offsetX));
 	}
-	_decoder->set(cID,_yId, positionToBin(localPosition.Y, _gridSizeY, _offsetY));
+	_yField.set(cID, positionToBin(localPosition.Y, _gridSizeY, _offsetY));
 	return cID;
 }
 
@@ -29,9 +29,12 @@ TiledLayerSegmentation::TiledLayerSegmentation(const std::string& cellEncoding)
 	registerParameter("grid_size_x", "Default cell size in X", _gridSizeX, 1., SegmentationParameter::LengthUnit);
 	registerParameter("grid_size_y", "Default cell size in Y", _gridSizeY, 1., SegmentationParameter::LengthUnit);
 	registerIdentifier("identifier_x", "Cell encoding identifier for X", _identifierX, "x");
+	registerFieldHandle(_identifierX, _xField);
 	registerIdentifier("identifier_y", "Cell encoding identifier for Y", _identifierY, "y");
+	registerFieldHandle(_identifierY, _yField);
 	registerParameter("identifier_layer", "Cell encoding identifier for layer", _identifierLayer, std::string("layer"),
 			SegmentationParameter::NoUnit, true);
+	registerFieldHandle(_identifierLayer, _layerField);
 	registerParameter("layer_identifiers", "List of valid layer identifiers", _layerIndices, vector<int>(),
 			SegmentationParameter::NoUnit, true);
 	registerParameter("x_dimensions", "List of layer x dimensions", _layerDimensionsX, vector<double>(),
@@ -50,9 +53,12 @@ TiledLayerSegmentation::TiledLayerSegmentation(const BitFieldCoder* decode) :	Se
 	registerParameter("grid_size_x", "Default cell size in X", _gridSizeX, 1., SegmentationParameter::LengthUnit);
 	registerParameter("grid_size_y", "Default cell size in Y", _gridSizeY, 1., SegmentationParameter::LengthUnit);
 	registerIdentifier("identifier_x", "Cell encoding identifier for X", _identifierX, "x");
+	registerFieldHandle(_identifierX, _xField);
 	registerIdentifier("identifier_y", "Cell encoding identifier for Y", _identifierY, "y");
+	registerFieldHandle(_identifierY, _yField);
 	registerParameter("identifier_layer", "Cell encoding identifier for layer", _identifierLayer, std::string("layer"),
 			SegmentationParameter::NoUnit, true);
+	registerFieldHandle(_identifierLayer, _layerField);
 	registerParameter("layer_identifiers", "List of valid layer identifiers", _layerIndices, vector<int>(),
 			SegmentationParameter::NoUnit, true);
 	registerParameter("x_dimensions", "List of layer x dimensions", _layerDimensionsX, vector<double>(),
@@ -116,28 +122,28 @@ TiledLayerSegmentation::LayerDimensions TiledLayerSegmentation::layerDimensions(
 
 /// determine the position based on the cell ID
 Vector3D TiledLayerSegmentation::position(const CellID& cID) const {
-	int layerIndex = _decoder->get(cID,_identifierLayer);
+	int layerIndex = _layerField.value(cID);
 	double cellSizeX = layerGridSizeX(layerIndex);
 	double cellSizeY = layerGridSizeY(layerIndex);
 	LayerDimensions dimensions = layerDimensions(layerIndex);
 	double offsetX = calculateOffset(cellSizeX, dimensions.x);
 	double offsetY = calculateOffset(cellSizeY, dimensions.y);
-	double localX = binToPosition(_decoder->get(cID,_identifierX), cellSizeX, offsetX);
-	double localY = binToPosition(_decoder->get(cID,_identifierY), cellSizeY, offsetY);
+	double localX = binToPosition(_xField.value(cID), cellSizeX, offsetX);
+	double localY = binToPosition(_yField.value(cID), cellSizeY, offsetY);
 	return Vector3D(localX, localY, 0.);
 }
 /// determine the cell ID based on the position
   CellID TiledLayerSegmentation::cellID(const Vector3D& localPosition, const Vector3D& /* globalPosition */,
 		const VolumeID& vID) const {
 	CellID cID = vID ;
-	int layerIndex = _decoder->get(cID,_identifierLayer);
+	int layerIndex = _layerField.value(cID);
 	double cellSizeX = layerGridSizeX(layerIndex);
 	double cellSizeY = layerGridSizeY(layerIndex);
 	LayerDimensions dimensions = layerDimensions(layerIndex);
 	double offsetX = calculateOffset(cellSizeX, dimensions.x);
 	double offsetY = calculateOffset(cellSizeY, dimensions.y);
-	_decoder->set(cID,_identifierX, positionToBin(localPosition.x(), cellSizeX, offsetX));
-	_decoder->set(cID,_identifierY, positionToBin(localPosition.y(), cellSizeY, offsetY));
+	_xField.set(cID, positionToBin(localPosition.x(), cellSizeX, offsetX));
+	_yField.set(cID, positionToBin(localPosition.y(), cellSizeY, offsetY));
 	return cID;
 }
 
@@ -23,11 +23,15 @@ WaferGridXY::WaferGridXY(const std::string& cellEncoding) :
 	registerParameter("offset_x", "Cell offset in X", _offsetX, 0., SegmentationParameter::LengthUnit, true);
 	registerParameter("offset_y", "Cell offset in Y", _offsetY, 0., SegmentationParameter::LengthUnit, true);
 	registerIdentifier("identifier_x", "Cell ID identifier for X", _xId, "x");
+	registerFieldHandle(_xId, _xField);
 	registerIdentifier("identifier_y", "Cell ID identifier for Y", _yId, "y");
+	registerFieldHandle(_yId, _yField);
         registerParameter("identifier_groupMGWafer", "Cell encoding identifier for Magic Wafer group", _identifierMGWaferGroup, std::string("layer"),
                         SegmentationParameter::NoUnit, true);
+        registerFieldHandle(_identifierMGWaferGroup, _mgWaferGroupField);
         registerParameter("identifier_wafer", "Cell encoding identifier for wafer", _identifierWafer, std::string("wafer"),
                         SegmentationParameter::NoUnit, true);
+        registerFieldHandle(_identifierWafer, _waferField);
 }
 
 /// Default constructor used by derived classes passing an existing decoder
@@ -42,11 +46,15 @@ WaferGridXY::WaferGridXY(const BitFieldCoder* decode) :	CartesianGrid(decode) {
 	registerParameter("offset_x", "Cell offset in X", _offsetX, 0., SegmentationParameter::LengthUnit, true);
 	registerParameter("offset_y", "Cell offset in Y", _offsetY, 0., SegmentationParameter::LengthUnit, true);
 	registerIdentifier("identifier_x", "Cell ID identifier for X", _xId, "x");
+	registerFieldHandle(_xId, _xField);
 	registerIdentifier("identifier_y", "Cell ID identifier for Y", _yId, "y");
+	registerFieldHandle(_yId, _yField);
         registerParameter("identifier_groupMGWafer", "Cell encoding identifier for Magic Wafer group", _identifierMGWaferGroup, std::string("layer"),
                         SegmentationParameter::NoUnit, true);
+        registerFieldHandle(_identifierMGWaferGroup, _mgWaferGroupField);
         registerParameter("identifier_wafer", "Cell encoding identifier for wafer", _identifierWafer, std::string("wafer"),
                         SegmentationParameter::NoUnit, true);
+        registerFieldHandle(_identifierWafer, _waferField);
 }
 
 /// destructor
@@ -60,25 +68,25 @@ Vector3D WaferGridXY::position(const CellID& cID) const {
         unsigned int _waferIndex;
 	Vector3D cellPosition;
 
-        _groupMGWaferIndex = _decoder->get(cID,_identifierMGWaferGroup);
-        _waferIndex = _decoder->get(cID,_identifierWafer);
+        _groupMGWaferIndex = _mgWaferGroupField.value(cID);
+        _waferIndex = _waferField.value(cID);
 
 	if ( _waferOffsetX[_groupMGWaferIndex][_waferIndex] > 0 || _waferOffsetX[_groupMGWaferIndex][_waferIndex] < 0 )
 	  {
-	    cellPosition.X = binToPosition(_decoder->get(cID,_xId), _gridSizeX, _offsetX+_waferOffsetX[_groupMGWaferIndex][_waferIndex]);
+	    cellPosition.X = binToPosition(_xField.value(cID), _gridSizeX, _offsetX+_waferOffsetX[_groupMGWaferIndex][_waferIndex]);
 	  }
 	else
 	  {
-	    cellPosition.X = binToPosition(_decoder->get(cID,_xId), _gridSizeX, _offsetX);
+	    cellPosition.X = binToPosition(_xField.value(cID), _gridSizeX, _offsetX);
 	  }
 
 	if ( _waferOffsetY[_groupMGWaferIndex][_waferIndex] > 0 || _waferOffsetY[_groupMGWaferIndex][_waferIndex] < 0 )
 	  {
-	    cellPosition.Y = binToPosition(_decoder->get(cID,_yId), _gridSizeY, _offsetY+_waferOffsetY[_groupMGWaferIndex][_waferIndex]);
+	    cellPosition.Y = binToPosition(_yField.value(cID), _gridSizeY, _offsetY+_waferOffsetY[_groupMGWaferIndex][_waferIndex]);
 	  }
 	else
 	  {
-	    cellPosition.Y = binToPosition(_decoder->get(cID,_yId), _gridSizeY, _offsetY);
+	    cellPosition.Y = binToPosition(_yField.value(cID), _gridSizeY, _offsetY);
 	  }
 
 	return cellPosition;
@@ -91,25 +99,25 @@ Vector3D WaferGridXY::position(const CellID& cID) const {
 
 	CellID cID = vID ;
 
-        _groupMGWaferIndex = _decoder->get(cID,_identifierMGWaferGroup);
-        _waferIndex = _decoder->get(cID,_identifierWafer);
+        _groupMGWaferIndex = _mgWaferGroupField.value(cID);
+        _waferIndex = _waferField.value(cID);
 
 	if ( _waferOffsetX[_groupMGWaferIndex][_waferIndex] > 0 || _waferOffsetX[_groupMGWaferIndex][_waferIndex] < 0 )
 	  {
-	    _decoder->set(cID,_xId, positionToBin(localPosition.X, _gridSizeX, _offsetX+_waferOffsetX[_groupMGWaferIndex][_waferIndex]));
+	    _xField.set(cID, positionToBin(localPosition.X, _gridSizeX, _offsetX+_waferOffsetX[_groupMGWaferIndex][_waferIndex]));
 	  }
 	else
 	  {
-	    _decoder->set(cID,_xId, positionToBin(localPosition.X, _gridSizeX, _offsetX));
+	    _xField.set(cID, positionToBin(localPosition.X, _gridSizeX, _offsetX));
 	  }
 
 	if ( _waferOffsetY[_groupMGWaferIndex][_waferIndex] > 0 ||  _waferOffsetY[_groupMGWaferIndex][_waferIndex] < 0)
 	  {
-	    _decoder->set(cID,_yId, positionToBin(localPosition.Y, _gridSizeY, _offsetY+_waferOffsetY[_groupMGWaferIndex][_waferIndex]));
+	    _yField.set(cID, positionToBin(localPosition.Y, _gridSizeY, _offsetY+_waferOffsetY[_groupMGWaferIndex][_waferIndex]));
 	  }
 	else
 	  {
-	    _decoder->set(cID,_yId, positionToBin(localPosition.Y, _gridSizeY, _offsetY));
+	    _yField.set(cID, positionToBin(localPosition.Y, _gridSizeY, _offsetY));
 	  }
 
 	return cID;
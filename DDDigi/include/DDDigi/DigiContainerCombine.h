@@ -66,6 +66,8 @@ namespace dd4hep {
       bool                           m_merge_history;
       /// Property: Flag to indicate to merge 
       bool                           m_merge_particles;
+      /// Property: Flag to combine deposits into a flat, sorted mapping (DepositFlatMapping)
+      bool                           m_flat_mapping;
 
       /// Fully qualified keys of all containers to be manipulated
       std::set<Key::key_type>        m_keys  { };
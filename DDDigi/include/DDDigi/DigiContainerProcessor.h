@@ -72,19 +72,31 @@ namespace dd4hep {
       struct predicate_t  {
         using deposit_t  = std::pair<const CellID, EnergyDeposit>;
         using callback_t = std::function<bool(const deposit_t&)>;
+        /// Selection kind: allows to evaluate the predicate without deposit objects
+        enum selection_t  {
+          SELECT_CALLBACK    = 0,
+          SELECT_ALL         = 1,
+          SELECT_NOT_KILLED  = 2,
+          SELECT_SEGMENT     = 3
+        };
         callback_t            callback      { };
         uint32_t              id            { 0 };
         const segmentation_t* segmentation  { nullptr };
+        selection_t           selection     { SELECT_CALLBACK };
 
         predicate_t() = default;
         predicate_t(std::function<bool(const deposit_t&)> func, uint32_t i, const segmentation_t* s)
           : callback(func), id(i), segmentation(s) {}
+        predicate_t(std::function<bool(const deposit_t&)> func, uint32_t i, const segmentation_t* s, selection_t sel)
+          : callback(func), id(i), segmentation(s), selection(sel) {}
         predicate_t(predicate_t&& copy) = default;
         predicate_t(const predicate_t& copy) = default;
         predicate_t& operator = (predicate_t&& copy) = default;
         predicate_t& operator = (const predicate_t& copy) = default;
         /// Check if a deposit should be processed
         bool operator()(const deposit_t& deposit)   const;
+        /// Evaluate the predicate for all deposits of a structure-of-arrays container
+        std::size_t select(const DepositArrays& deposits, std::vector<unsigned char>& selected)   const;
         static bool always_true(const deposit_t&)        { return true; }
         static bool not_killed (const deposit_t& depo)   { return 0 == (depo.second.flag&EnergyDeposit::KILLED); }
       };
@@ -150,6 +162,9 @@ namespace dd4hep {
     /**
      *  Worker class act on ONLY act on energy deposit containers in an event.
      *  The deposit containers are identified by input masks and container name.
+     *  Structure-of-arrays containers (DepositArrays) are handed to the arrays
+     *  handler if bound. Otherwise they are converted and passed to the
+     *  vector handler.
      *
      *  \author  M.Frank
      *  \version 1.0
@@ -159,6 +174,8 @@ namespace dd4hep {
     protected:
       std::function<void(context_t& context, DepositVector& cont,  work_t& work, const predicate_t& predicate)>	m_handleVector;
       std::function<void(context_t& context, DepositMapping& cont, work_t& work, const predicate_t& predicate)>	m_handleMapping;
+      std::function<void(context_t& context, DepositFlatMapping& cont, work_t& work, const predicate_t& predicate)>	m_handleFlatMapping;
+      std::function<void(context_t& context, DepositArrays& cont,  work_t& work, const predicate_t& predicate)>	m_handleArrays;
 
     public:
       /// Standard constructor
@@ -170,7 +187,11 @@ namespace dd4hep {
 
 #define DEPOSIT_PROCESSOR_BIND_HANDLERS(X)   {     using namespace std::placeholders; \
       this->m_handleVector  = std::bind( &X<DepositVector>,  this, _1, _2, _3, _4); \
-      this->m_handleMapping = std::bind( &X<DepositMapping>, this, _1, _2, _3, _4); }
+      this->m_handleMapping = std::bind( &X<DepositMapping>, this, _1, _2, _3, _4); \
+      this->m_handleFlatMapping = std::bind( &X<DepositFlatMapping>, this, _1, _2, _3, _4); }
+
+#define DEPOSIT_PROCESSOR_BIND_ARRAYS_HANDLER(X)   {     using namespace std::placeholders; \
+      this->m_handleArrays  = std::bind( &X, this, _1, _2, _3, _4); }
 
     /// Worker class act on containers in an event identified by input masks and container name
     /**
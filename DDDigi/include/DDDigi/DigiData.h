@@ -18,10 +18,13 @@
 
 /// C/C++ include files
 #include <cstdint>
+#include <iterator>
 #include <memory>
+#include <atomic>
 #include <limits>
 #include <mutex>
 #include <map>
+#include <vector>
 #include <any>
 
 /// Namespace for the AIDA detector description toolkit
@@ -40,6 +43,7 @@ namespace dd4hep {
     class EnergyDeposit;
     class ParticleMapping;
     class DepositMapping;
+    class DepositFlatMapping;
     class DigiEvent;
     class DataSegment;
 
@@ -616,6 +620,10 @@ namespace dd4hep {
       std::size_t insert(const DepositVector& updates);
       /// Merge new deposit map onto existing map (keep inputs. not thread safe!)
       std::size_t insert(const DepositMapping& updates);
+      /// Merge new flat deposit map onto existing vector (destroys inputs. not thread safe!)
+      std::size_t merge(DepositFlatMapping&& updates);
+      /// Merge new flat deposit map onto existing vector (keep inputs. not thread safe!)
+      std::size_t insert(const DepositFlatMapping& updates);
       /// Emplace entry
       void emplace(CellID cell, EnergyDeposit&& deposit);
 
@@ -652,6 +660,95 @@ namespace dd4hep {
       this->data.emplace_back(cell, std::move(deposit));
     }
 
+    /// Energy deposit container with structure-of-arrays layout
+    /**
+     *  Every field of the energy deposits is stored in a separate array.
+     *  Kernels touching only a few fields (energy, time, flag) stream only
+     *  these arrays. The deposit histories are kept in a side arena:
+     *  each deposit refers to a contiguous range of hit and particle entries.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DepositArrays : public SegmentEntry  {
+    public:
+      /// Range of history entries of one deposit in the history arena
+      struct history_range_t  {
+        std::uint32_t first_hit       { 0 };
+        std::uint32_t num_hits        { 0 };
+        std::uint32_t first_particle  { 0 };
+        std::uint32_t num_particles   { 0 };
+      };
+
+      /// Cell identifiers
+      std::vector<CellID>          cells            { };
+      /// Total energy deposits
+      std::vector<double>          deposits         { };
+      /// Errors of the energy deposits
+      std::vector<double>          depositErrors    { };
+      /// Creation times of the deposits
+      std::vector<double>          times            { };
+      /// Lengths of the contributing track segments
+      std::vector<double>          lengths          { };
+      /// Deposit flags
+      std::vector<std::uint64_t>   flags            { };
+      /// Source masks
+      std::vector<Key::mask_type>  masks            { };
+      /// Hit positions
+      std::vector<Position>        positions        { };
+      /// Hit directions
+      std::vector<Direction>       momenta          { };
+      /// History ranges of the deposits
+      std::vector<history_range_t> histories        { };
+      /// History arena: contributing hits
+      std::vector<History::hist_entry_t> history_hits       { };
+      /// History arena: contributing particles
+      std::vector<History::hist_entry_t> history_particles  { };
+
+    public: 
+      /// Initializing constructor
+      DepositArrays(const std::string& name, Key::mask_type mask, data_type_t typ);
+      /// Default constructor
+      DepositArrays() = default;
+      /// Default move constructor
+      DepositArrays(DepositArrays&& copy) = default;
+      /// Default copy constructor
+      DepositArrays(const DepositArrays& copy) = default;      
+      /// Default destructor
+      virtual ~DepositArrays() = default;
+      /// Default move assignment
+      DepositArrays& operator=(DepositArrays&& copy) = default;
+      /// Default copy assignment
+      DepositArrays& operator=(const DepositArrays& copy) = default;      
+
+      /// Append deposits of a deposit vector (keep inputs. not thread safe!)
+      std::size_t insert(const DepositVector& updates);
+      /// Append deposits of a deposit mapping (keep inputs. not thread safe!)
+      std::size_t insert(const DepositMapping& updates);
+      /// Append single entry
+      void emplace(CellID cell, const EnergyDeposit& deposit);
+      /// Reserve space for a given number of deposits
+      void reserve(std::size_t len);
+      /// Remove all deposits
+      void clear();
+
+      /// Access container size
+      std::size_t size()  const           { return this->cells.size();       }
+      /// Check container if empty
+      bool        empty() const           { return this->cells.empty();      }
+      /// Assemble the energy deposit object at a given index
+      EnergyDeposit at(std::size_t index)   const;
+      /// Convert to deposit vector with the same name and key
+      DepositVector to_vector()  const;
+    };
+
+    /// Initializing constructor
+    inline DepositArrays::DepositArrays(const std::string& nam, Key::mask_type msk, data_type_t typ)
+      : SegmentEntry(nam, msk, typ)
+    {
+    }
+
     /// Energy deposit mapping definition for digitization
     /**
      *
@@ -724,6 +821,106 @@ namespace dd4hep {
     {
     }
 
+    /// Flat energy deposit mapping sorted by cell identifier
+    /**
+     *  Drop-in alternative to DepositMapping without one heap node per deposit.
+     *  Deposits are appended to a vector. After filling, finalize() sorts the
+     *  entries in bulk by cell identifier using a stable radix sort. Deposits
+     *  merged with merge() are combined per cell using the deposit weighted update.
+     *  Once finalized, iteration yields the deposits ordered by cell identifier
+     *  like DepositMapping. The accessors never modify the container, hence
+     *  finalized containers may be read concurrently.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DepositFlatMapping : public SegmentEntry  {
+    public: 
+      using container_t    = std::vector<std::pair<const CellID, EnergyDeposit> >;
+      using value_type     = container_t::value_type;
+      using mapped_type    = container_t::value_type::second_type;
+      using key_type       = container_t::value_type::first_type;
+      using iterator       = container_t::iterator;
+      using const_iterator = container_t::const_iterator;
+
+    protected:
+      /// Deposit data. Sorted by finalize()
+      container_t data      { };
+      /// Number of leading entries known to be sorted
+      std::size_t sorted    { 0 };
+      /// Flag if deposits with identical cell identifiers must be combined
+      bool        combine   { false };
+
+    public: 
+      /// Initializing constructor
+      DepositFlatMapping(const std::string& name, Key::mask_type mask, data_type_t typ);
+      /// Default constructor
+      DepositFlatMapping() = default;
+      /// Default move constructor
+      DepositFlatMapping(DepositFlatMapping&& copy) = default;
+      /// Default copy constructor
+      DepositFlatMapping(const DepositFlatMapping& copy) = default;      
+      /// Default destructor
+      virtual ~DepositFlatMapping() = default;
+      /// Default move assignment
+      DepositFlatMapping& operator=(DepositFlatMapping&& copy) = default;
+      /// Default copy assignment
+      DepositFlatMapping& operator=(const DepositFlatMapping& copy) = default;      
+
+      /// Merge new deposits onto existing map (destroys inputs. not thread safe!)
+      std::size_t merge(DepositFlatMapping&& updates);
+      /// Merge new deposits onto existing map (keep inputs. not thread safe!)
+      std::size_t insert(const DepositFlatMapping& updates);
+      /// Merge new deposit map onto existing map (destroys inputs. not thread safe!)
+      std::size_t merge(DepositMapping&& updates);
+      /// Merge new deposit map onto existing map (keep inputs. not thread safe!)
+      std::size_t insert(const DepositMapping& updates);
+      /// Merge new deposit vector onto existing map (destroys inputs. not thread safe!)
+      std::size_t merge(DepositVector&& updates);
+      /// Merge new deposit vector onto existing map (keep inputs. not thread safe!)
+      std::size_t insert(const DepositVector& updates);
+      /// Emplace entry. The container must be finalized before it is accessed
+      void emplace(CellID cell, EnergyDeposit&& deposit);
+      /// Reserve space for a given number of deposits
+      void reserve(std::size_t len)       { this->data.reserve(len);         }
+      /// Sort all entries by cell identifier and combine merged deposits (not thread safe!)
+      void finalize();
+      /// Check if all entries are sorted and combined
+      bool finalized()  const             { return this->sorted == this->data.size() && !this->combine; }
+
+      /// Access container size
+      std::size_t size()  const           { return this->data.size();        }
+      /// Check container if empty
+      bool        empty() const           { return this->data.empty();       }
+      /// Access energy deposit by key. The container must be finalized
+      const EnergyDeposit& get(CellID cell)   const;
+
+      /** Iteration support */
+      /// Begin iteration
+      iterator begin()                    { return this->data.begin();       }
+      /// End iteration
+      iterator end()                      { return this->data.end();         }
+      /// Begin iteration (CONST)
+      const_iterator begin() const        { return this->data.begin();       }
+      /// End iteration (CONST)
+      const_iterator end()   const        { return this->data.end();         }
+      /// Remove entry. O(n): the remaining entries are moved, prefer filtering to drop many entries
+      void remove(iterator position);
+    };
+
+    /// Initializing constructor
+    inline DepositFlatMapping::DepositFlatMapping(const std::string& nam, Key::mask_type msk, data_type_t typ)
+      : SegmentEntry(nam, msk, typ)
+    {
+    }
+
+    /// Emplace entry
+    inline void DepositFlatMapping::emplace(CellID cell, EnergyDeposit&& deposit)   {
+      this->data.emplace_back(cell, std::move(deposit));
+    }
+
+
     class ADCValue   {
     public:
       using value_t = uint32_t;
@@ -952,8 +1149,16 @@ namespace dd4hep {
     }
 
 
-    ///  Data segment definition (locked map)
+    ///  Data segment definition (open addressing hash table)
     /**
+     *  Lookups, insertions and removals are lock-free: a key claims its
+     *  slot with a compare-and-swap and the slot state is published with
+     *  release semantics. Each key is searched on a bounded probe sequence
+     *  per table. If a table gets too full, the free slots on the probe
+     *  sequence are closed and a table with twice the capacity is chained
+     *  to it with a compare-and-swap. Items are never moved: references
+     *  and pointers to items remain valid until the item is erased.
+     *  Iteration visits the items in ascending key order like a std::map.
      *
      *  \author  M.Frank
      *  \version 1.0
@@ -961,12 +1166,115 @@ namespace dd4hep {
      */
     class DataSegment   {
     public:
-      using key_t = Key::key_type;
-      using container_map_t = std::map<Key, std::any>;
-      using iterator        = container_map_t::iterator;
-      using const_iterator  = container_map_t::const_iterator;
+      using key_t      = Key::key_type;
+      using value_type = std::pair<Key, std::any>;
+
+      /// Default number of slots of the first segment table
+      enum { DEFAULT_CAPACITY = 1024 };
+      /// Maximal number of slots probed per table for one key
+      enum { MAX_PROBE = 32 };
+
+    private:
+      /// Slot states of the open addressing table
+      enum slot_state_t : unsigned int  { SLOT_FREE = 0, SLOT_BUSY = 1, SLOT_VALID = 2, SLOT_ERASED = 3 };
+      /// Key of a slot not yet taken
+      static constexpr key_t EMPTY_KEY = ~key_t(0);
+      /// Key of a slot closed because the table is full. The key continues in the next table
+      static constexpr key_t MOVED_KEY = ~key_t(1);
+
+      /// Slot of the open addressing table.
+      /**
+       *  The key of a slot is claimed exactly once by a compare-and-swap
+       *  from EMPTY_KEY and never changes afterwards. Erased slots keep
+       *  their key and are revived if the same key is inserted again.
+       *  The state is published with release semantics: readers seeing
+       *  VALID may access the entry without further synchronization.
+       */
+      struct slot_t  {
+        std::atomic<key_t>        key    { EMPTY_KEY };
+        std::atomic<unsigned int> state  { SLOT_FREE };
+        value_type                entry  { };
+      };
+
+      /// Open addressing table. Full tables are extended by chaining a larger table
+      struct table_t  {
+        /// Slot array. The capacity is a power of 2
+        std::unique_ptr<slot_t[]> slots;
+        /// Number of slots in the table
+        std::size_t               capacity  { 0 };
+        /// Number of slots claimed by a key
+        std::atomic<std::size_t>  used      { 0 };
+        /// Next (larger) table of the chain. Owned by this table
+        std::atomic<table_t*>     next      { nullptr };
+        /// Initializing constructor
+        table_t(std::size_t cap) : slots(new slot_t[cap]), capacity(cap)  { }
+        /// Default destructor
+        ~table_t()  { delete next.load(std::memory_order_acquire); }
+      };
+
+      /// Valid slots sorted by key used for iterations
+      struct snapshot_t  {
+        /// Modification count of the segment the snapshot was taken at
+        std::size_t          version  { 0 };
+        /// Valid slots in ascending key order
+        std::vector<slot_t*> slots    { };
+      };
+
+      /// Iterator over the valid slots of the segment tables in ascending key order
+      /**
+       *  The iterator works on a snapshot of the valid slots. The snapshot
+       *  is cached by the segment and only rebuilt after modifications.
+       *  Items inserted later are not visited.
+       */
+      template <typename VALUE> class slot_iterator  {
+        std::shared_ptr<const snapshot_t> m_slots { };
+        std::size_t                       m_pos   { 0 };
+        slot_t* current()  const  {
+          return (m_slots && m_pos < m_slots->slots.size()) ? m_slots->slots[m_pos] : nullptr;
+        }
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = VALUE;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = VALUE*;
+        using reference         = VALUE&;
+        /// Default constructor: end of iteration
+        slot_iterator() = default;
+        /// Initializing constructor
+        slot_iterator(std::shared_ptr<const snapshot_t> s, std::size_t p) : m_slots(std::move(s)), m_pos(p)  { }
+        reference operator*()  const                      { return current()->entry;     }
+        pointer   operator->() const                      { return &current()->entry;    }
+        slot_iterator& operator++()                       { ++m_pos; return *this;       }
+        slot_iterator  operator++(int)                    { slot_iterator c(*this); ++m_pos; return c; }
+        bool operator==(const slot_iterator& c)  const    { return current() == c.current(); }
+        bool operator!=(const slot_iterator& c)  const    { return current() != c.current(); }
+      };
+
+    public:
+      using iterator       = slot_iterator<value_type>;
+      using const_iterator = slot_iterator<const value_type>;
 
     private:
+      /// First table of the chain
+      std::unique_ptr<table_t>  m_table;
+      /// Number of valid entries
+      std::atomic<std::size_t>  m_size      { 0 };
+      /// Modification count. Incremented after every insertion and removal
+      std::atomic<std::size_t>  m_version   { 0 };
+      /// Cached iteration snapshot. Accessed with the atomic shared_ptr functions
+      mutable std::shared_ptr<const snapshot_t> m_snapshot;
+
+      /// Hash function to map a key to its home slot
+      static std::size_t home_slot(key_t key, std::size_t capacity);
+      /// Lock-free lookup of the slot claimed by a key in any state. If not existing, nullptr is returned
+      slot_t* probe(key_t key)  const;
+      /// Lock-free lookup of a valid slot. If not existing, nullptr is returned
+      slot_t* find_slot(key_t key)  const;
+      /// Find or claim the slot of a key. Extends the table chain if necessary
+      slot_t* claim_slot(key_t key, bool& claimed);
+      /// Snapshot of all valid slots in ascending key order. Rebuilt only after modifications
+      std::shared_ptr<const snapshot_t> sorted_slots()  const;
+
       /// Call on failed any-casts
       std::string invalid_cast(Key key, const std::type_info& type)  const;
       /// Call on failed data requests during data requests
@@ -978,12 +1286,12 @@ namespace dd4hep {
       const std::any* get_item(Key key, bool exc)  const;
 
     public:
-      container_map_t   data;
+      /// Lock of the owning event. Not used by the segment table itself.
       std::mutex&       lock;
       Key::segment_type id  { 0 };
     public:
       /// Initializing constructor
-      DataSegment(std::mutex& lock, Key::segment_type id);
+      DataSegment(std::mutex& lock, Key::segment_type id, std::size_t capacity = DEFAULT_CAPACITY);
       /// Default constructor
       DataSegment() = delete;
       /// Disable move constructor
@@ -997,8 +1305,8 @@ namespace dd4hep {
       /// Disable copy assignment
       DataSegment& operator=(const DataSegment& copy) = delete;      
 
-      /** Locked operations */
-      /// Emplace data item (locked)
+      /** Thread safe, lock-free operations */
+      /// Emplace data item
       bool emplace_any(Key key, std::any&& data);
       /// Emplace arbitrary data item
       template <typename T> bool emplace(Key key, T&& data_item)   {
@@ -1008,14 +1316,14 @@ namespace dd4hep {
       }
       /// Move data items other than std::any to the data segment
       template <typename DATA> bool put(Key key, DATA&& data);
-      /// Remove data item from segment (locked)
+      /// Remove data item from segment. Items must not be accessed concurrently
       bool erase(Key key);
-      /// Remove data items from segment (locked)
+      /// Remove data items from segment. Items must not be accessed concurrently
       std::size_t erase(const std::vector<Key>& keys);
       /// Print segment keys
       void print_keys()   const;
       
-      /** Unlocked operations */
+      /** Lock-free read operations */
       /// Access data by key. If not existing, nullptr is returned
       std::any* entry(Key key)              { return this->get_item(key, false); }
       /// Access data by key. If not existing, nullptr is returned
@@ -1032,21 +1340,23 @@ namespace dd4hep {
       template<typename T> const T* pointer(Key key)  const;
 
       /// Access container size
-      std::size_t size()  const           { return this->data.size();        }
+      std::size_t size()  const           { return m_size.load(std::memory_order_acquire); }
       /// Check container if empty
-      bool        empty() const           { return this->data.empty();       }
-      /// Begin iteration
-      iterator begin()                    { return this->data.begin();       }
+      bool        empty() const           { return this->size() == 0;        }
+      /// Access the total number of slots of all chained tables
+      std::size_t capacity()  const;
+      /// Begin iteration in ascending key order
+      iterator begin()                    { return iterator(this->sorted_slots(), 0); }
       /// End iteration
-      iterator end()                      { return this->data.end();         }
+      iterator end()                      { return iterator(); }
       /// Find entry by key
-      iterator find(Key key)              { return this->data.find(key);     }
-      /// Begin iteration (CONST)
-      const_iterator begin() const        { return this->data.begin();       }
+      iterator find(Key key);
+      /// Begin iteration in ascending key order (CONST)
+      const_iterator begin() const        { return const_iterator(this->sorted_slots(), 0); }
       /// End iteration (CONST)
-      const_iterator end()   const        { return this->data.end();         }
+      const_iterator end()   const        { return const_iterator(); }
       /// Find entry by key
-      const_iterator find(Key key) const  { return this->data.find(key);     }
+      const_iterator find(Key key) const;
     };
 
     /// Access data as reference by key. If not existing, an exception is thrown
@@ -16,6 +16,9 @@
 /// Framework include files
 #include <DDDigi/DigiContainerProcessor.h>
 
+/// C/C++ include files
+#include <memory>
+
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
 
@@ -34,6 +37,19 @@ namespace dd4hep {
      */
     class DigiOutputAction : public DigiContainerSequenceAction {
     public:
+      /// Output frame: event data converted, but not yet written
+      /** Concrete output actions supporting asynchronous output
+       *  detach the converted event data into a frame, which is then
+       *  written by the dedicated writer thread.
+       */
+      class output_frame   {
+      public:
+	/// Default destructor
+	virtual ~output_frame() = default;
+      };
+      /// Asynchronous writer thread
+      class writer_t;
+
     protected:
       /// Property: Processor type to manage containers
       std::string                        m_processor_type  { };
@@ -43,6 +59,11 @@ namespace dd4hep {
       std::string                        m_output { };
       /// Property: Create stream names with sequence numbers
       bool                               m_sequence_streams  {  true };
+      /// Property: Depth of the output queue for asynchronous writing (0: synchronous output)
+      /** Asynchronous output may change the output format: e.g. DigiEdm4hepOutput
+       *  then writes podio frames (podio::ROOTFrameWriter) instead of using podio::ROOTWriter.
+       */
+      int                                m_queue_depth  { 0 };
 
       /// Total numbe rof events to be processed
       long num_events  { -1 };
@@ -50,6 +71,8 @@ namespace dd4hep {
       long event_count {  0 };
       /// Stream sequence counter
       long fseq_count  {  0 };
+      /// Writer thread for asynchronous output
+      std::unique_ptr<writer_t> m_writer;
 
     protected:
       /// Define standard assignments and constructors
@@ -80,6 +103,14 @@ namespace dd4hep {
       /// Commit event data to output stream
       virtual void commit_output() const = 0;
 
+      /// Detach the converted event data for asynchronous writing. Called with the output lock held.
+      /** Default: asynchronous output is not supported. Returns null.
+       */
+      virtual std::unique_ptr<output_frame> detach_output()  const;
+
+      /// Write detached event data to the output stream. Called by the writer thread
+      virtual void write_output(output_frame& frame)  const;
+
       /// Create new output stream name
       virtual std::string next_stream_name();
 
@@ -18,6 +18,7 @@
 
 /// C/C++ include files
 #include <memory>
+#include <vector>
 
 /// Forward declarations
 class TBranch;
@@ -45,23 +46,36 @@ namespace dd4hep {
       /// Helper classes
       class internals_t;
       class inputsource_t;
+      class frame_t;
       class container_t  {
       public:
 	Key          key;
 	TBranch&     branch;
 	TClass&      clazz;
+	/// Branch address: pointer to the object being read
+	void*        address { nullptr };
+	/// Branch objects released by the input frames, which are reused for reading
+	std::vector<void*> buffers { };
       container_t(Key k, TBranch& b, TClass& c) : key(k), branch(b), clazz(c) {}
       };
       class work_t   {
       public:
 	DataSegment& segment;
 	container_t& container;
+	/// Object read from the branch. Owned by the input frame
+	void*        object;
       };
 
 
     protected:
       /// Connection parameters to the "current" input source
       mutable std::unique_ptr<internals_t> imp;
+      /// Property: Number of events to be read ahead by a dedicated reader thread (0: read synchronously)
+      int          m_prefetch       { 0 };
+      /// Property: Size of the TTreeCache in bytes (0: ROOT default)
+      long         m_cache_size     { 0 };
+      /// Property: Enable ROOT implicit multi-threading to unzip branches in parallel
+      bool         m_implicit_mt    { false };
 
     protected:
       /// Define standard assignments and constructors
@@ -75,7 +89,7 @@ namespace dd4hep {
 
       /// Callback to read event input
       virtual void execute(DigiContext& context)  const override;
-      /// Callback to handle single branch
+      /// Callback to handle single branch. Called without holding the global I/O lock
       virtual void operator()(DigiContext& context, work_t& work)  const = 0;
     };
 
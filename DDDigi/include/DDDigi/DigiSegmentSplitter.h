@@ -84,7 +84,7 @@ namespace dd4hep {
      */
     struct accept_segment_t : public DigiContainerProcessor::predicate_t  {
       accept_segment_t(const DigiSegmentContext* s, uint32_t i)
-	: predicate_t(std::bind(&accept_segment_t::use_depo, this, std::placeholders::_1), i, s) {
+	: predicate_t(std::bind(&accept_segment_t::use_depo, this, std::placeholders::_1), i, s, SELECT_SEGMENT) {
       }
       /// Check if a deposit should be processed
       bool use_depo(const deposit_t& deposit)   const   {
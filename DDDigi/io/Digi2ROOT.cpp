@@ -60,6 +60,10 @@ namespace dd4hep {
       virtual void close_output()  const  override final;
       /// Commit event data to output stream
       virtual void commit_output() const  override final;
+      /// Detach the converted event data for asynchronous writing
+      virtual std::unique_ptr<output_frame> detach_output()  const  override final;
+      /// Write detached event data to the output stream
+      virtual void write_output(output_frame& frame)  const  override final;
     };
 
     /// Actor to save individual data containers to edm4hep
@@ -123,6 +127,7 @@ namespace dd4hep {
 #include <TBranch.h>
 
 #include <vector>
+#include <deque>
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -142,20 +147,43 @@ namespace dd4hep {
      */
     class Digi2ROOTWriter::internals_t  final {
     public:
+      struct frame_t;
       struct BranchWrapper   {
 	TClass*  clazz = nullptr;
 	TBranch* branch = nullptr;
+	/// Object connected to the branch
 	void*    address = nullptr;
-	void (*fcn_clear)(void* addr) = 0;
-	void (*fcn_del)(void* addr) = 0;
+	/// Object filled by the processors. Identical to address unless writing asynchronously
+	void*    buffer = nullptr;
+	void  (*fcn_clear)(void* addr) = 0;
+	void  (*fcn_del)(void* addr) = 0;
+	void* (*fcn_new)() = 0;
+	void  (*fcn_detach)(BranchWrapper& bw, frame_t& frame) = 0;
 	void clear()                    { this->fcn_clear(this->address); }
-	void del()                      { this->fcn_del(this->address);   }
-	template <typename T> T* get()  { return (T*)this->address;       }
+	void del()                      {
+	  if ( this->buffer != this->address ) this->fcn_del(this->buffer);
+	  this->fcn_del(this->address);
+	}
+	template <typename T> T* get()  { return (T*)this->buffer;        }
+	template <typename T> T& branch_object()  { return *(T*)this->address; }
 	template <typename T> void set(T* ptr);
       };
       template <typename O> struct _wrapper_handler  {
 	static void clear(void* ptr)  {  O* c = (O*)ptr; c->clear();  }
 	static void del(void* ptr)    {  O* c = (O*)ptr; delete c;    }
+	static void* create()         {  return new O();              }
+	static void detach(BranchWrapper& bw, frame_t& frame);
+      };
+      /// Event data detached for asynchronous writing. Owns copies of all objects
+      struct frame_t : public DigiOutputAction::output_frame  {
+	std::vector<std::pair<BranchWrapper*, persistent_particles_t> > particles;
+	std::vector<std::pair<BranchWrapper*, persistent_deposits_t> >  deposits;
+	std::deque<Particle>      particle_store;
+	std::deque<EnergyDeposit> deposit_store;
+	/// Move particle references to the frame and copy the particles
+	void add(BranchWrapper& bw, persistent_particles_t& cont);
+	/// Move deposit references to the frame and copy the deposits
+	void add(BranchWrapper& bw, persistent_deposits_t& cont);
       };
       typedef std::map<std::string, BranchWrapper> Collections;
 
@@ -192,6 +220,10 @@ namespace dd4hep {
       void close();
       /// Commit data at end of filling procedure
       void commit();
+      /// Detach converted event data from the conversion buffers
+      std::unique_ptr<frame_t> detach();
+      /// Write detached event data
+      void write(frame_t& frame);
 
       /// Create all collections according to the parent setup (locked)
       void create_collections();
@@ -202,11 +234,43 @@ namespace dd4hep {
     };
 
     template <typename T> void Digi2ROOTWriter::internals_t::BranchWrapper::set(T* ptr)   {
-      clazz     = gROOT->GetClass(typeid(*ptr), kTRUE);
-      branch    = nullptr;
-      address   = ptr;
-      fcn_clear = _wrapper_handler<T>::clear;
-      fcn_del   = _wrapper_handler<T>::del;
+      clazz      = gROOT->GetClass(typeid(*ptr), kTRUE);
+      branch     = nullptr;
+      address    = ptr;
+      buffer     = ptr;
+      fcn_clear  = _wrapper_handler<T>::clear;
+      fcn_del    = _wrapper_handler<T>::del;
+      fcn_new    = _wrapper_handler<T>::create;
+      fcn_detach = _wrapper_handler<T>::detach;
+    }
+
+    template <typename O> 
+    void Digi2ROOTWriter::internals_t::_wrapper_handler<O>::detach(BranchWrapper& bw, frame_t& frame)   {
+      frame.add(bw, *(O*)bw.buffer);
+    }
+
+    /// Move particle references to the frame and copy the particles
+    void Digi2ROOTWriter::internals_t::frame_t::add(BranchWrapper& bw, persistent_particles_t& cont)   {
+      particles.emplace_back(&bw, persistent_particles_t());
+      auto& vec = particles.back().second;
+      vec.reserve(cont.size());
+      for( const auto& p : cont )   {
+	particle_store.emplace_back(*p.second);
+	vec.emplace_back(p.first, &particle_store.back());
+      }
+      cont.clear();
+    }
+
+    /// Move deposit references to the frame and copy the deposits
+    void Digi2ROOTWriter::internals_t::frame_t::add(BranchWrapper& bw, persistent_deposits_t& cont)   {
+      deposits.emplace_back(&bw, persistent_deposits_t());
+      auto& vec = deposits.back().second;
+      vec.reserve(cont.size());
+      for( const auto& d : cont )   {
+	deposit_store.emplace_back(*d.second);
+	vec.emplace_back(d.first, &deposit_store.back());
+      }
+      cont.clear();
     }
 
     /// Default constructor
@@ -320,6 +384,23 @@ namespace dd4hep {
       m_parent->except("+++ Failed to write output file. [Stream is not open]");
     }
 
+    /// Detach converted event data from the conversion buffers
+    std::unique_ptr<Digi2ROOTWriter::internals_t::frame_t> Digi2ROOTWriter::internals_t::detach()   {
+      auto frame = std::make_unique<frame_t>();
+      for( auto& coll : m_collections )
+	coll.second.fcn_detach(coll.second, *frame);
+      return frame;
+    }
+
+    /// Write detached event data
+    void Digi2ROOTWriter::internals_t::write(frame_t& frame)   {
+      for( auto& p : frame.particles )
+	p.first->branch_object<persistent_particles_t>().swap(p.second);
+      for( auto& d : frame.deposits )
+	d.first->branch_object<persistent_deposits_t>().swap(d.second);
+      commit();
+    }
+
     /// Standard constructor
     Digi2ROOTWriter::Digi2ROOTWriter(const DigiKernel& krnl, const std::string& nam)
       : DigiOutputAction(krnl, nam)
@@ -350,6 +431,11 @@ namespace dd4hep {
       }
       m_parallel = false;
       internals->create_collections();
+      if ( m_queue_depth > 0 )   {
+	/// Asynchronous output: the processors fill separate conversion buffers
+	for( auto& coll : internals->m_collections )
+	  coll.second.buffer = coll.second.fcn_new();
+      }
     }
 
     /// Check for valid output stream
@@ -372,6 +458,16 @@ namespace dd4hep {
       internals->commit();
     }
 
+    /// Detach the converted event data for asynchronous writing
+    std::unique_ptr<DigiOutputAction::output_frame> Digi2ROOTWriter::detach_output()  const  {
+      return internals->detach();
+    }
+
+    /// Write detached event data to the output stream
+    void Digi2ROOTWriter::write_output(output_frame& frame)  const  {
+      internals->write(dynamic_cast<internals_t::frame_t&>(frame));
+    }
+
     /// Standard constructor
     Digi2ROOTProcessor::Digi2ROOTProcessor(const DigiKernel& krnl, const std::string& nam)
       : DigiContainerProcessor(krnl, nam)
@@ -20,8 +20,10 @@
 #include "DigiIO.h"
 
 /// edm4hep include files
+#include <podio/Frame.h>
 #include <podio/EventStore.h>
 #include <podio/ROOTWriter.h>
+#include <podio/ROOTFrameWriter.h>
 #include <edm4hep/SimTrackerHit.h>
 #include <edm4hep/MCParticleCollection.h>
 #include <edm4hep/TrackerHitCollection.h>
@@ -45,11 +47,21 @@ namespace dd4hep {
      */
     class DigiEdm4hepOutput::internals_t {
     public:
+      /// Event data detached for asynchronous writing
+      struct frame_t : public DigiOutputAction::output_frame  {
+        podio::Frame frame { };
+      };
+      using mover_t = void (*)(podio::Frame& frame, const std::string& name, podio::CollectionBase* coll);
+
       DigiEdm4hepOutput* m_parent                    { nullptr };
       /// Reference to podio store
       std::unique_ptr<podio::EventStore>  m_store     { };
       /// Reference to podio writer
       std::unique_ptr<podio::ROOTWriter>  m_file      { };
+      /// Reference to podio frame writer (asynchronous output only)
+      std::unique_ptr<podio::ROOTFrameWriter> m_frame_file { };
+      /// Functions to move the collection content to a frame
+      std::map<std::string, mover_t> m_movers;
       /// edm4hep event header collection
       edm4hep::EventHeaderCollection*     m_header    { nullptr };
       /// MC particle collection
@@ -65,6 +77,8 @@ namespace dd4hep {
     private:
       /// Helper to register single collection
       template <typename T> T* register_collection(const std::string& name, T* collection);
+      /// Helper to move the content of a collection to a frame
+      template <typename T> static void move_collection(podio::Frame& frame, const std::string& name, podio::CollectionBase* coll);
 
     public:
       /// Default constructor
@@ -74,6 +88,10 @@ namespace dd4hep {
 
       /// Commit data at end of filling procedure
       void commit();
+      /// Detach converted event data from the collections
+      std::unique_ptr<frame_t> detach();
+      /// Write detached event data
+      void write(frame_t& frame);
       /// Open new output stream
       void open();
       /// Commit data to disk and close output stream
@@ -93,17 +111,26 @@ namespace dd4hep {
 
     /// Default destructor
     DigiEdm4hepOutput::internals_t::~internals_t()    {
-      if ( m_file ) close();
+      if ( m_file || m_frame_file ) close();
       m_store.reset();
     }
 
     template <typename T> T* DigiEdm4hepOutput::internals_t::register_collection(const std::string& nam, T* coll)   {
       m_collections.emplace(nam, coll);
+      m_movers.emplace(nam, move_collection<T>);
       m_store->registerCollection(nam, coll);
       m_parent->debug("+++ created collection %s <%s>", nam.c_str(), coll->getTypeName().c_str());
       return coll;
     }
 
+    template <typename T> void DigiEdm4hepOutput::internals_t::move_collection(podio::Frame& frame,
+                                                                                const std::string& nam,
+                                                                                podio::CollectionBase* coll)   {
+      T* c = static_cast<T*>(coll);
+      frame.put(std::move(*c), nam);
+      *c = T();
+    }
+
     /// Create all collections according to the parent setup
     void DigiEdm4hepOutput::internals_t::create_collections()    {
       if ( nullptr == m_header )   {
@@ -145,13 +172,36 @@ namespace dd4hep {
       m_parent->except("+++ Failed to write output file. [Stream is not open]");
     }
 
+    /// Detach converted event data from the collections
+    std::unique_ptr<DigiEdm4hepOutput::internals_t::frame_t> DigiEdm4hepOutput::internals_t::detach()   {
+      auto frame = std::make_unique<frame_t>();
+      for( const auto& c : m_collections )
+        m_movers[c.first](frame->frame, c.first, c.second);
+      return frame;
+    }
+
+    /// Write detached event data
+    void DigiEdm4hepOutput::internals_t::write(frame_t& frame)   {
+      if ( m_frame_file )   {
+        m_frame_file->writeFrame(frame.frame, "events");
+        return;
+      }
+      m_parent->except("+++ Failed to write output file. [Stream is not open]");
+    }
+
     /// Open new output stream
     void DigiEdm4hepOutput::internals_t::open()    {
-      if ( m_file )   {
+      if ( m_file || m_frame_file )   {
         close();
       }
       m_file.reset();
       std::string fname = m_parent->next_stream_name();
+      if ( m_parent->m_queue_depth > 0 )   {
+        /// Asynchronous output writes podio frames
+        m_frame_file = std::make_unique<podio::ROOTFrameWriter>(fname);
+        m_parent->info("+++ Opened EDM4HEP frame output file %s", fname.c_str());
+        return;
+      }
       m_file = std::make_unique<podio::ROOTWriter>(fname, m_store.get());
       m_parent->info("+++ Opened EDM4HEP output file %s", fname.c_str());
       for( const auto& c : m_collections )   {
@@ -165,7 +215,11 @@ namespace dd4hep {
       if ( m_file )   {
         m_file->finish();
       }
+      if ( m_frame_file )   {
+        m_frame_file->finish();
+      }
       m_file.reset();
+      m_frame_file.reset();
     }
 
     /// Standard constructor
@@ -199,7 +253,7 @@ namespace dd4hep {
 
     /// Check for valid output stream
     bool DigiEdm4hepOutput::have_output()  const  {
-      return internals->m_file.get() != nullptr;
+      return internals->m_file.get() != nullptr || internals->m_frame_file.get() != nullptr;
     }
 
     /// Open new output stream
@@ -217,6 +271,16 @@ namespace dd4hep {
       internals->commit();
     }
 
+    /// Detach the converted event data for asynchronous writing
+    std::unique_ptr<DigiOutputAction::output_frame> DigiEdm4hepOutput::detach_output()  const  {
+      return internals->detach();
+    }
+
+    /// Write detached event data to the output stream
+    void DigiEdm4hepOutput::write_output(output_frame& frame)  const  {
+      internals->write(dynamic_cast<internals_t::frame_t&>(frame));
+    }
+
     /// Standard constructor
     DigiEdm4hepOutputProcessor::DigiEdm4hepOutputProcessor(const DigiKernel& krnl, const std::string& nam)
       : DigiContainerProcessor(krnl, nam)
@@ -40,6 +40,11 @@ namespace dd4hep {
      *  This entity actually is only the work dispatcher:
      *  It opens files and dumps data into
      *
+     *  Note: With the property queue_depth > 0 (asynchronous output) the events
+     *  are written as podio frames using podio::ROOTFrameWriter instead of the
+     *  podio::ROOTWriter used for synchronous output. The resulting files must
+     *  be read with the frame reader (podio::ROOTFrameReader).
+     *
      *  \author  M.Frank
      *  \version 1.0
      *  \ingroup DD4HEP_DIGITIZATION
@@ -70,6 +75,10 @@ namespace dd4hep {
       virtual void close_output()  const  override final;
       /// Commit event data to output stream
       virtual void commit_output() const  override final;
+      /// Detach the converted event data for asynchronous writing
+      virtual std::unique_ptr<output_frame> detach_output()  const  override final;
+      /// Write detached event data to the output stream
+      virtual void write_output(output_frame& frame)  const  override final;
     };
 
     /// Actor to save individual data containers to edm4hep
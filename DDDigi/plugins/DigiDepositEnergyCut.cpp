@@ -58,12 +58,32 @@ namespace dd4hep {
 	     context.event->id(), cont.name.c_str(), dropped, cont.size(), cont.key.mask());
       }
 
+      /// Structure-of-arrays version: only the energy and flag arrays are touched
+      void cut_energy_arrays(context_t& context, DepositArrays& cont, work_t& /* work */, const predicate_t& predicate)  const  {
+	std::vector<unsigned char> selected;
+	predicate.select(cont, selected);
+	const std::size_t num = cont.size();
+	const unsigned char* sel = selected.data();
+	const double*  deposits  = cont.deposits.data();
+	std::uint64_t* flags     = cont.flags.data();
+	std::size_t    dropped   = 0UL;
+	for( std::size_t i = 0; i < num; ++i )   {
+	  std::uint64_t kill = (sel[i] != 0 && deposits[i] < m_cutoff) ? 1 : 0;
+	  flags[i] |= kill * EnergyDeposit::KILLED;
+	  dropped  += kill;
+	}
+	if ( m_monitor ) m_monitor->count_shift(cont.size(), dropped);
+	info("%s+++ %-32s dropped %6ld out of %6ld entries from mask: %04X",
+	     context.event->id(), cont.name.c_str(), dropped, cont.size(), cont.key.mask());
+      }
+
       /// Standard constructor
       DigiDepositEnergyCut(const DigiKernel& krnl, const std::string& nam)
 	: DigiDepositsProcessor(krnl, nam)
       {
 	declareProperty("deposit_cutoff", m_cutoff);
 	DEPOSIT_PROCESSOR_BIND_HANDLERS(DigiDepositEnergyCut::cut_energy)
+	DEPOSIT_PROCESSOR_BIND_ARRAYS_HANDLER(DigiDepositEnergyCut::cut_energy_arrays)
       }
     };
   }    // End namespace digi
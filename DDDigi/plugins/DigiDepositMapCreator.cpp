@@ -56,6 +56,8 @@ namespace dd4hep {
 	  create_deposits(context.event->id(), *m, work, predicate);
 	else if ( const auto* v = work.get_input<DepositVector>() )
 	  create_deposits(context.event->id(), *v, work, predicate);
+	else if ( const auto* f = work.get_input<DepositFlatMapping>() )
+	  create_deposits(context.event->id(), *f, work, predicate);
 	else
 	  except("Request to handle unknown data type: %s", work.input_type_name().c_str());
       }
@@ -96,6 +96,7 @@ namespace dd4hep {
 	declareProperty("ionization_fluctuation",     m_ionization_fluctuation = false);
 	declareProperty("modify_energy",              m_modify_energy = true);
 	DEPOSIT_PROCESSOR_BIND_HANDLERS(DigiDepositSmearEnergy::smear)
+	DEPOSIT_PROCESSOR_BIND_ARRAYS_HANDLER(DigiDepositSmearEnergy::smear_arrays)
       }
 
       /// Create deposit mapping with updates on same cellIDs
@@ -151,6 +152,68 @@ namespace dd4hep {
 	info("%s+++ %-32s Smear energy: updated %6ld out of %6ld entries from mask: %04X",
 	     context.event->id(), cont.name.c_str(), updated, cont.size(), cont.key.mask());
       }
+
+      /// Structure-of-arrays version: random numbers are drawn first, then the energy arrays are updated
+      void smear_arrays(DigiContext& context, DepositArrays& cont, work_t& /* work */, const predicate_t& predicate)  const  {
+	constexpr static double eps = std::numeric_limits<double>::epsilon();
+	auto& random = context.randomGenerator();
+	std::vector<unsigned char> selected;
+	std::size_t updated = predicate.select(cont, selected);
+	const std::size_t num = cont.size();
+	const unsigned char* sel = selected.data();
+	const double sigma_E_instrument = m_instrumentation_resolution / dd4hep::GeV;
+	const bool   print_deposits     = dd4hep::isActivePrintLevel(outputLevel());
+	std::vector<double> delta(num, 0e0);
+	double* delta_E  = delta.data();
+	double* deposits = cont.deposits.data();
+	double* errors   = cont.depositErrors.data();
+	std::uint64_t* flags = cont.flags.data();
+
+	/// Random numbers are drawn in the same order as by the scalar version
+	for( std::size_t i = 0; i < num; ++i )   {
+	  if ( sel[i] )   {
+	    double energy = deposits[i] / dd4hep::GeV; // E in units of GeV
+	    double sigma_E_systematic   = m_systematic_resolution * energy;
+	    double sigma_E_intrin_fluct = m_intrinsic_fluctuation * std::sqrt(energy);
+	    double dE = 0e0;
+	    double delta_ion = 0e0, num_pairs = 0e0;
+	    if ( sigma_E_systematic > eps )
+	      dE += sigma_E_systematic * random.gaussian(0e0, 1e0);
+	    if ( sigma_E_intrin_fluct > eps )
+	      dE += sigma_E_intrin_fluct * random.gaussian(0e0, 1e0);
+	    if ( sigma_E_instrument > eps )
+	      dE += sigma_E_instrument * random.gaussian(0e0, 1e0);
+	    if ( m_ionization_fluctuation )   {
+	      num_pairs = energy / (m_pair_ionization_energy/dd4hep::GeV);
+	      delta_ion = energy * (random.poisson(num_pairs)/num_pairs);
+	      dE += delta_ion;
+	    }
+	    if ( print_deposits )   {
+	      print("%s+++ %016lX [GeV] E:%9.2e [%9.2e %9.2e] intrin_fluct:%9.2e systematic:%9.2e instrument:%9.2e ioni:%9.2e/%.0f",
+		    context.event->id(), cont.cells[i], energy, deposits[i]/dd4hep::GeV, dE,
+		    sigma_E_intrin_fluct, sigma_E_systematic, sigma_E_instrument, delta_ion, num_pairs);
+	    }
+	    /// delta_E is in GeV
+	    delta_E[i] = dE * dd4hep::GeV;
+	  }
+	}
+	for( std::size_t i = 0; i < num; ++i )   {
+	  errors[i] = sel[i] ? delta_E[i] : errors[i];
+	}
+	if ( m_monitor )   {
+	  for( std::size_t i = 0; i < num; ++i )
+	    if ( sel[i] ) m_monitor->energy_shift(std::make_pair(cont.cells[i], cont.at(i)), delta_E[i]);
+	}
+	if ( m_modify_energy )  {
+	  for( std::size_t i = 0; i < num; ++i )   {
+	    std::uint64_t use = sel[i];
+	    deposits[i] += delta_E[i];
+	    flags[i]    |= use * EnergyDeposit::ENERGY_SMEARED;
+	  }
+	}
+	info("%s+++ %-32s Smear energy: updated %6ld out of %6ld entries from mask: %04X",
+	     context.event->id(), cont.name.c_str(), updated, cont.size(), cont.key.mask());
+      }
     };
 
     /// Actor to only set energy error (as above, but with preset option
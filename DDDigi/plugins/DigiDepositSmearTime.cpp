@@ -66,6 +66,38 @@ namespace dd4hep {
 	     context.event->id(), cont.name.c_str(), cont.size(), updated, killed, cont.key.mask());
       }
 
+      /// Structure-of-arrays version: random numbers are drawn first, then the time arrays are updated
+      void smear_arrays(DigiContext& context, DepositArrays& cont, work_t& /* work */, const predicate_t& predicate)  const  {
+	auto& random = context.randomGenerator();
+	std::vector<unsigned char> selected;
+	std::size_t updated = predicate.select(cont, selected);
+	const std::size_t num = cont.size();
+	std::vector<double> delta(num, 0e0);
+	const unsigned char* sel = selected.data();
+	double*        delta_T = delta.data();
+	double*        times   = cont.times.data();
+	std::uint64_t* flags   = cont.flags.data();
+	std::size_t    killed  = 0UL;
+	for( std::size_t i = 0; i < num; ++i )   {
+	  if ( sel[i] ) delta_T[i] = m_resolution_time * random.gaussian();
+	}
+	if ( m_monitor )   {
+	  for( std::size_t i = 0; i < num; ++i )
+	    if ( sel[i] ) m_monitor->time_shift(std::make_pair(cont.cells[i], cont.at(i)), delta_T[i]);
+	}
+	const double t_min = m_window_time.first, t_max = m_window_time.second;
+	for( std::size_t i = 0; i < num; ++i )   {
+	  std::uint64_t use  = sel[i];
+	  std::uint64_t kill = use & ((delta_T[i] < t_min || delta_T[i] > t_max) ? 1 : 0);
+	  times[i] += delta_T[i];
+	  flags[i] |= use * EnergyDeposit::TIME_SMEARED | kill * EnergyDeposit::KILLED;
+	  killed   += kill;
+	}
+	if ( m_monitor ) m_monitor->count_shift(cont.size(), -killed);
+	info("%s+++ %-32s Smeared time resolution: %6ld entries, updated %6ld killed %6ld entries from mask: %04X",
+	     context.event->id(), cont.name.c_str(), cont.size(), updated, killed, cont.key.mask());
+      }
+
       /// Standard constructor
       DigiDepositSmearTime(const DigiKernel& krnl, const std::string& nam)
 	: DigiDepositsProcessor(krnl, nam)
@@ -73,6 +105,7 @@ namespace dd4hep {
 	declareProperty("resolution_time", m_resolution_time);
 	declareProperty("window_time",     m_window_time);
 	DEPOSIT_PROCESSOR_BIND_HANDLERS(DigiDepositSmearTime::smear)
+	DEPOSIT_PROCESSOR_BIND_ARRAYS_HANDLER(DigiDepositSmearTime::smear_arrays)
       }
     };
   }    // End namespace digi
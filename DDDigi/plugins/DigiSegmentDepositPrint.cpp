@@ -62,6 +62,8 @@ namespace dd4hep {
 	  print(format, *m, predicate);
 	else if ( const auto* v = work.get_input<DepositVector>() )
 	  print(format, *v, predicate);
+	else if ( const auto* f = work.get_input<DepositFlatMapping>() )
+	  print(format, *f, predicate);
 	else
 	  error("+++ Request to dump an invalid container %s", Key::key_name(work.input.key).c_str());
       }
@@ -102,24 +102,44 @@ public:
   }
 
   /// Generic deposit merger: implicitly assume identical item types are mapped sequentially
-  void merge(const std::string& nam, size_t start, int thr)  {
+  template <typename OUT> void merge_deposits(const std::string& nam, size_t start, int thr)  {
     Key key = keys[start];
-    DepositVector out(nam, combine->m_deposit_mask, SegmentEntry::UNKNOWN);
+    OUT out(nam, combine->m_deposit_mask, SegmentEntry::UNKNOWN);
     for( std::size_t j = start; j < keys.size(); ++j )   {
       if ( keys[j].item() == key.item() )   {
 	if ( DepositMapping* m = std::any_cast<DepositMapping>(work[j]) )
 	  merge_depos(out, *m, thr);
 	else if ( DepositVector* v = std::any_cast<DepositVector>(work[j]) )
 	  merge_depos(out, *v, thr);
+	else if ( DepositFlatMapping* f = std::any_cast<DepositFlatMapping>(work[j]) )
+	  merge_depos(out, *f, thr);
 	else
 	  break;
 	used_keys_insert(keys[j]);
       }
     }
+    finalize_output(out);
     key.set_mask(combine->m_deposit_mask);
     outputs.emplace(key, std::move(out));
   }
 
+  /// Deposit vectors need no final treatment
+  static void finalize_output(DepositVector& /* out */)   {
+  }
+
+  /// Flat mappings are sorted and combined once all inputs are merged
+  static void finalize_output(DepositFlatMapping& out)   {
+    out.finalize();
+  }
+
+  /// Generic deposit merger: select the output container type
+  void merge(const std::string& nam, size_t start, int thr)  {
+    if ( combine->m_flat_mapping )
+      merge_deposits<DepositFlatMapping>(nam, start, thr);
+    else
+      merge_deposits<DepositVector>(nam, start, thr);
+  }
+
   /// Merge history records: implicitly assume identical item types are mapped sequentially
   void merge_hist(const std::string& nam, size_t start, int thr)  {
     std::size_t cnt;
@@ -198,6 +218,10 @@ public:
       else if ( DepositVector* depov = std::any_cast<DepositVector>(work[i]) )   {
 	if ( combine->m_merge_deposits  ) merge(depov->name+opt, i, thr);
       }
+      /// Merge flat deposit mapping
+      else if ( DepositFlatMapping* depof = std::any_cast<DepositFlatMapping>(work[i]) )   {
+	if ( combine->m_merge_deposits  ) merge(depof->name+opt, i, thr);
+      }
       /// Merge detector response
       else if ( DetectorResponse* resp = std::any_cast<DetectorResponse>(work[i]) )   {
 	if ( combine->m_merge_response  ) merge_response(resp->name+opt, i, thr);
@@ -249,6 +273,7 @@ DigiContainerCombine::DigiContainerCombine(const DigiKernel& krnl, const std::st
   declareProperty("merge_response",   m_merge_response  = true);
   declareProperty("merge_history",    m_merge_history   = true);
   declareProperty("merge_particles",  m_merge_particles = false);
+  declareProperty("flat_mapping",     m_flat_mapping    = false);
   m_kernel.register_initialize(std::bind(&DigiContainerCombine::initialize,this));
   InstanceCount::increment(this);
 }
@@ -59,6 +59,9 @@ public:
       /// Drop deposit vector
       else if ( std::any_cast<DepositVector>(work[i]) )
 	work[i]->reset();
+      /// Drop flat deposit mapping
+      else if ( std::any_cast<DepositFlatMapping>(work[i]) )
+	work[i]->reset();
       /// Drop particle container
       else if ( std::any_cast<ParticleMapping>(work[i]) )
 	work[i]->reset();
@@ -20,6 +20,7 @@
 #include <DDDigi/DigiSegmentSplitter.h>
 
 /// C/C++ include files
+#include <algorithm>
 #include <sstream>
 
 using namespace dd4hep::digi;
@@ -64,8 +65,12 @@ namespace dd4hep {
 
 template       DepositVector*    DigiContainerProcessor::work_t::get_input(bool exc);
 template const DepositVector*    DigiContainerProcessor::work_t::get_input(bool exc)  const;
+template       DepositArrays*    DigiContainerProcessor::work_t::get_input(bool exc);
+template const DepositArrays*    DigiContainerProcessor::work_t::get_input(bool exc)  const;
 template       DepositMapping*   DigiContainerProcessor::work_t::get_input(bool exc);
 template const DepositMapping*   DigiContainerProcessor::work_t::get_input(bool exc)  const;
+template       DepositFlatMapping* DigiContainerProcessor::work_t::get_input(bool exc);
+template const DepositFlatMapping* DigiContainerProcessor::work_t::get_input(bool exc)  const;
 template       ParticleMapping*  DigiContainerProcessor::work_t::get_input(bool exc);
 template const ParticleMapping*  DigiContainerProcessor::work_t::get_input(bool exc)  const;
 template       DetectorHistory*  DigiContainerProcessor::work_t::get_input(bool exc);
@@ -83,15 +88,49 @@ std::string DigiContainerProcessor::work_t::input_type_name()  const   {
   return typeName(input.data->type());
 }
 
+/// Evaluate the predicate for all deposits of a structure-of-arrays container
+std::size_t DigiContainerProcessor::predicate_t::select(const DepositArrays& cont,
+							 std::vector<unsigned char>& selected)   const   {
+  std::size_t num = cont.size(), count = 0;
+  selected.resize(num);
+  unsigned char* sel = selected.data();
+  switch( this->selection )   {
+  case SELECT_ALL:
+    std::fill(selected.begin(), selected.end(), 1);
+    return num;
+  case SELECT_NOT_KILLED:   {
+    const std::uint64_t* flags = cont.flags.data();
+    for( std::size_t i = 0; i < num; ++i )
+      sel[i] = (flags[i] & EnergyDeposit::KILLED) == 0 ? 1 : 0;
+    break;
+  }
+  case SELECT_SEGMENT:   {
+    const CellID* cells = cont.cells.data();
+    for( std::size_t i = 0; i < num; ++i )
+      sel[i] = this->segmentation->split_id(cells[i]) == this->id ? 1 : 0;
+    break;
+  }
+  default:
+    for( std::size_t i = 0; i < num; ++i )
+      sel[i] = this->callback(deposit_t(cont.cells[i], cont.at(i))) ? 1 : 0;
+    break;
+  }
+  for( std::size_t i = 0; i < num; ++i )
+    count += sel[i];
+  return count;
+}
+
 /// Access to default callback 
 const DigiContainerProcessor::predicate_t& DigiContainerProcessor::accept_all()  {
-  static predicate_t s_pred { std::bind(predicate_t::always_true, std::placeholders::_1), 0, nullptr };
+  static predicate_t s_pred { std::bind(predicate_t::always_true, std::placeholders::_1), 0, nullptr,
+                              predicate_t::SELECT_ALL };
   return s_pred;
 }
 
 /// Access to default callback 
 const DigiContainerProcessor::predicate_t& DigiContainerProcessor::accept_not_killed()  {
-  static predicate_t s_pred { std::bind(predicate_t::not_killed, std::placeholders::_1), 0, nullptr };
+  static predicate_t s_pred { std::bind(predicate_t::not_killed, std::placeholders::_1), 0, nullptr,
+                              predicate_t::SELECT_NOT_KILLED };
   return s_pred;
 }
 
@@ -126,6 +165,19 @@ void DigiDepositsProcessor::execute(context_t& context, work_t& work, const pred
     m_handleVector(context,  *vector_data, work, predicate);
   else if ( auto* mapped_data = work.get_input<DepositMapping>() )
     m_handleMapping(context, *mapped_data, work, predicate);
+  else if ( auto* flat_data = work.get_input<DepositFlatMapping>() )
+    m_handleFlatMapping(context, *flat_data, work, predicate);
+  else if ( auto* array_data = work.get_input<DepositArrays>() )   {
+    if ( m_handleArrays )   {
+      m_handleArrays(context, *array_data, work, predicate);
+      return;
+    }
+    /// No dedicated handler: process the deposits in vector form
+    DepositVector vector_data = array_data->to_vector();
+    m_handleVector(context, vector_data, work, predicate);
+    array_data->clear();
+    array_data->insert(vector_data);
+  }
   else
     except("Request to handle unknown data type: %s", work.input_type_name().c_str());
 }
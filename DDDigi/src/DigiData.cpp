@@ -19,6 +19,7 @@
 #include <DDDigi/DigiData.h>
 
 // C/C++ include files
+#include <algorithm>
 #include <mutex>
 
 namespace   {
@@ -30,6 +31,39 @@ namespace   {
     static digi_keys k;
     return k;
   }
+
+  using sort_key_t = std::pair<std::uint64_t, std::uint32_t>;
+
+  /// Stable LSD radix sort on 64 bit keys with 16 bit digits. Constant digits are skipped
+  void radix_sort(std::vector<sort_key_t>& keys)   {
+    constexpr std::size_t num_buckets = 1UL << 16;
+    const std::size_t num = keys.size();
+    if ( num < 2 ) return;
+    if ( num < 1024 )   {
+      /// Small arrays: the histogram setup is more expensive than a comparison sort
+      std::stable_sort(keys.begin(), keys.end(),
+		       [](const sort_key_t& a, const sort_key_t& b) { return a.first < b.first; });
+      return;
+    }
+    std::vector<sort_key_t>  buffer(num);
+    std::vector<std::size_t> count(num_buckets);
+    for( int shift = 0; shift < 64; shift += 16 )   {
+      std::fill(count.begin(), count.end(), 0);
+      for( const auto& k : keys )
+	++count[(k.first >> shift) & (num_buckets-1)];
+      if ( count[(keys[0].first >> shift) & (num_buckets-1)] == num )
+	continue;
+      std::size_t sum = 0;
+      for( auto& c : count )   {
+	std::size_t n = c;
+	c = sum;
+	sum += n;
+      }
+      for( const auto& k : keys )
+	buffer[count[(k.first >> shift) & (num_buckets-1)]++] = k;
+      keys.swap(buffer);
+    }
+  }
 }
 
 using namespace dd4hep::digi;
@@ -245,6 +279,129 @@ void DepositVector::remove(iterator /* position */)   {
   //data.erase(position);
 }
 
+/// Reserve space for a given number of deposits
+void DepositArrays::reserve(std::size_t len)   {
+  cells.reserve(len);
+  deposits.reserve(len);
+  depositErrors.reserve(len);
+  times.reserve(len);
+  lengths.reserve(len);
+  flags.reserve(len);
+  masks.reserve(len);
+  positions.reserve(len);
+  momenta.reserve(len);
+  histories.reserve(len);
+}
+
+/// Remove all deposits
+void DepositArrays::clear()   {
+  cells.clear();
+  deposits.clear();
+  depositErrors.clear();
+  times.clear();
+  lengths.clear();
+  flags.clear();
+  masks.clear();
+  positions.clear();
+  momenta.clear();
+  histories.clear();
+  history_hits.clear();
+  history_particles.clear();
+}
+
+/// Append single entry
+void DepositArrays::emplace(CellID cell, const EnergyDeposit& depo)   {
+  history_range_t range;
+  range.first_hit      = std::uint32_t(history_hits.size());
+  range.num_hits       = std::uint32_t(depo.history.hits.size());
+  range.first_particle = std::uint32_t(history_particles.size());
+  range.num_particles  = std::uint32_t(depo.history.particles.size());
+  history_hits.insert(history_hits.end(), depo.history.hits.begin(), depo.history.hits.end());
+  history_particles.insert(history_particles.end(), depo.history.particles.begin(), depo.history.particles.end());
+  cells.emplace_back(cell);
+  deposits.emplace_back(depo.deposit);
+  depositErrors.emplace_back(depo.depositError);
+  times.emplace_back(depo.time);
+  lengths.emplace_back(depo.length);
+  flags.emplace_back(depo.flag);
+  masks.emplace_back(depo.mask);
+  positions.emplace_back(depo.position);
+  momenta.emplace_back(depo.momentum);
+  histories.emplace_back(range);
+}
+
+/// Append deposits of a deposit vector (keep inputs)
+std::size_t DepositArrays::insert(const DepositVector& updates)    {
+  std::size_t update_size = updates.size();
+  this->reserve(this->size() + update_size);
+  for( const auto& c : updates )    {
+    this->emplace(c.first, c.second);
+  }
+  return update_size;
+}
+
+/// Append deposits of a deposit mapping (keep inputs)
+std::size_t DepositArrays::insert(const DepositMapping& updates)    {
+  std::size_t update_size = updates.size();
+  this->reserve(this->size() + update_size);
+  for( const auto& c : updates )    {
+    this->emplace(c.first, c.second);
+  }
+  return update_size;
+}
+
+/// Assemble the energy deposit object at a given index
+EnergyDeposit DepositArrays::at(std::size_t index)   const   {
+  EnergyDeposit depo;
+  const history_range_t& range = histories.at(index);
+  depo.position     = positions[index];
+  depo.momentum     = momenta[index];
+  depo.length       = lengths[index];
+  depo.deposit      = deposits[index];
+  depo.depositError = depositErrors[index];
+  depo.time         = times[index];
+  depo.flag         = flags[index];
+  depo.mask         = masks[index];
+  depo.history.hits.assign(history_hits.begin() + range.first_hit,
+			   history_hits.begin() + range.first_hit + range.num_hits);
+  depo.history.particles.assign(history_particles.begin() + range.first_particle,
+				history_particles.begin() + range.first_particle + range.num_particles);
+  return depo;
+}
+
+/// Convert to deposit vector with the same name and key
+DepositVector DepositArrays::to_vector()  const   {
+  DepositVector vec;
+  vec.name      = this->name;
+  vec.key       = this->key;
+  vec.data_type = this->data_type;
+  for( std::size_t i = 0, n = this->size(); i < n; ++i )
+    vec.emplace(cells[i], this->at(i));
+  return vec;
+}
+
+/// Merge new flat deposit map onto existing vector (destroys inputs)
+std::size_t DepositVector::merge(DepositFlatMapping&& updates)    {
+  std::size_t update_size = updates.size();
+  std::size_t newlen = std::max(2*data.size(), data.size()+updates.size());
+  data.reserve(newlen);
+  for( auto& c : updates )    {
+    data.emplace_back(c.first, std::move(c.second));
+  }
+  return update_size;
+}
+
+/// Merge new flat deposit map onto existing vector (keep inputs)
+std::size_t DepositVector::insert(const DepositFlatMapping& updates)    {
+  std::size_t update_size = updates.size();
+  std::size_t newlen = std::max(2*data.size(), data.size()+updates.size());
+  data.reserve(newlen);
+  for( const auto& c : updates )    {
+    data.emplace_back(c);
+  }
+  return update_size;
+}
+
 /// Merge new deposit map onto existing map
 std::size_t DepositMapping::merge(DepositVector&& updates)    {
   std::size_t update_size = updates.size();
@@ -312,6 +469,125 @@ void DepositMapping::remove(iterator position)   {
   data.erase(position);
 }
 
+/// Sort all entries by cell identifier and combine deposits if requested
+void DepositFlatMapping::finalize()   {
+  const std::size_t num = data.size();
+  bool in_order = true;
+  for( std::size_t i = std::max(sorted, std::size_t(1)); i < num && in_order; ++i )
+    in_order = !(data[i].first < data[i-1].first);
+  if ( in_order && !combine )   {
+    sorted = num;
+    return;
+  }
+  /// Sort (cell, index) pairs. The sign bit is flipped to keep the ordering of signed identifiers
+  std::vector<std::pair<std::uint64_t, std::uint32_t> > keys;
+  keys.reserve(num);
+  for( std::size_t i = 0; i < num; ++i )
+    keys.emplace_back(std::uint64_t(data[i].first) ^ (1ULL << 63), std::uint32_t(i));
+  if ( !in_order ) radix_sort(keys);
+
+  /// Single pass: permute the deposits and combine identical cells if requested
+  container_t ordered;
+  ordered.reserve(num);
+  for( std::size_t i = 0; i < num; )   {
+    std::size_t j = i + 1;
+    auto& entry = data[keys[i].second];
+    if ( combine )   {
+      for( ; j < num && keys[j].first == keys[i].first; ++j )
+	entry.second.update_deposit_weighted(std::move(data[keys[j].second].second));
+    }
+    ordered.emplace_back(entry.first, std::move(entry.second));
+    i = j;
+  }
+  data.swap(ordered);
+  sorted  = data.size();
+  combine = false;
+}
+
+/// Merge new deposits onto existing map (destroys inputs)
+std::size_t DepositFlatMapping::merge(DepositFlatMapping&& updates)    {
+  std::size_t update_size = updates.data.size();
+  data.reserve(std::max(2*data.size(), data.size() + update_size));
+  for( auto& c : updates.data )
+    data.emplace_back(c.first, std::move(c.second));
+  combine = true;
+  return update_size;
+}
+
+/// Merge new deposits onto existing map (keep inputs)
+std::size_t DepositFlatMapping::insert(const DepositFlatMapping& updates)    {
+  std::size_t update_size = updates.data.size();
+  data.reserve(std::max(2*data.size(), data.size() + update_size));
+  for( const auto& c : updates.data )
+    data.emplace_back(c);
+  return update_size;
+}
+
+/// Merge new deposit map onto existing map (destroys inputs)
+std::size_t DepositFlatMapping::merge(DepositMapping&& updates)    {
+  std::size_t update_size = updates.size();
+  data.reserve(std::max(2*data.size(), data.size() + update_size));
+  for( auto& c : updates )
+    data.emplace_back(c.first, std::move(c.second));
+  combine = true;
+  return update_size;
+}
+
+/// Merge new deposit map onto existing map (keep inputs)
+std::size_t DepositFlatMapping::insert(const DepositMapping& updates)    {
+  std::size_t update_size = updates.size();
+  data.reserve(std::max(2*data.size(), data.size() + update_size));
+  for( const auto& c : updates )
+    data.emplace_back(c);
+  return update_size;
+}
+
+/// Merge new deposit vector onto existing map (destroys inputs)
+std::size_t DepositFlatMapping::merge(DepositVector&& updates)    {
+  std::size_t update_size = updates.size();
+  data.reserve(std::max(2*data.size(), data.size() + update_size));
+  for( auto& c : updates )
+    data.emplace_back(c.first, std::move(c.second));
+  combine = true;
+  return update_size;
+}
+
+/// Merge new deposit vector onto existing map (keep inputs)
+std::size_t DepositFlatMapping::insert(const DepositVector& updates)    {
+  std::size_t update_size = updates.size();
+  data.reserve(std::max(2*data.size(), data.size() + update_size));
+  for( const auto& c : updates )
+    data.emplace_back(c);
+  return update_size;
+}
+
+/// Access energy deposit by key
+const EnergyDeposit& DepositFlatMapping::get(CellID cell)   const    {
+  if ( !this->finalized() )   {
+    except("DepositFlatMapping","%s: Access by CellID %016X to a container, which is not finalized.",
+	   this->name.c_str(), cell);
+  }
+  auto iter = std::lower_bound(data.begin(), data.end(), cell,
+			       [](const value_type& v, CellID c) { return v.first < c; });
+  if ( iter != data.end() && iter->first == cell )
+    return iter->second;
+  except("DepositFlatMapping","Failed to access deposit by CellID. UNKNOWN ID: %016X", cell);
+  throw std::runtime_error("Failed to access deposit by CellID");
+}
+
+/// Remove entry
+void DepositFlatMapping::remove(iterator position)   {
+  /// The cell identifiers are constant: the remaining entries are moved to a new array
+  container_t remaining;
+  remaining.reserve(data.size());
+  for( auto i = data.begin(); i != data.end(); ++i )   {
+    if ( i != position ) remaining.emplace_back(i->first, std::move(i->second));
+  }
+  bool in_order = sorted == data.size();
+  data.swap(remaining);
+  sorted = in_order ? data.size() : 0;
+}
+
 /// Move particle
 void Particle::move_position(const Position& delta)    {
   this->start_position += delta;
@@ -402,26 +678,142 @@ std::size_t DetectorHistory::insert(const DetectorHistory& updates)   {
 }
 
 /// Initializing constructor
-DataSegment::DataSegment(std::mutex& l, Key::segment_type i)
-  : data(), lock(l), id(i)
+DataSegment::DataSegment(std::mutex& l, Key::segment_type i, std::size_t capacity)
+  : lock(l), id(i)
 {
+  std::size_t cap = 16;
+  while( cap < capacity ) cap <<= 1;
+  m_table.reset(new table_t(cap));
 }
 
-/// Remove data item from segment
+/// Hash function to map a key to its home slot
+std::size_t DataSegment::home_slot(key_t key, std::size_t capacity)   {
+  /// Finalizer of murmur3: the segment/mask bits are in the low word
+  key ^= key >> 33;
+  key *= 0xff51afd7ed558ccdULL;
+  key ^= key >> 33;
+  key *= 0xc4ceb9fe1a85ec53ULL;
+  key ^= key >> 33;
+  return std::size_t(key) & (capacity-1);
+}
+
+/// Lock-free lookup of the slot claimed by a key in any state. If not existing, nullptr is returned
+DataSegment::slot_t* DataSegment::probe(key_t key)  const   {
+  for( const table_t* t = m_table.get(); t; t = t->next.load(std::memory_order_acquire) )   {
+    std::size_t mask  = t->capacity - 1;
+    std::size_t idx   = home_slot(key, t->capacity);
+    std::size_t limit = std::min<std::size_t>(MAX_PROBE, t->capacity);
+    for( std::size_t i = 0; i < limit; ++i, idx = (idx+1) & mask )   {
+      slot_t& slot = t->slots[idx];
+      key_t   k    = slot.key.load(std::memory_order_acquire);
+      /// Inserters never pass an empty slot: the key is nowhere in the chain
+      if ( k == EMPTY_KEY )
+	return nullptr;
+      if ( k == key )
+	return &slot;
+    }
+  }
+  return nullptr;
+}
+
+/// Lock-free lookup of a valid slot. If not existing, nullptr is returned
+DataSegment::slot_t* DataSegment::find_slot(key_t key)  const   {
+  slot_t* slot = probe(key);
+  return (slot && slot->state.load(std::memory_order_acquire) == SLOT_VALID) ? slot : nullptr;
+}
+
+/// Find or claim the slot of a key. Extends the table chain if necessary
+DataSegment::slot_t* DataSegment::claim_slot(key_t key, bool& claimed)   {
+  claimed = false;
+  for( table_t* t = m_table.get(); ; )   {
+    std::size_t mask  = t->capacity - 1;
+    std::size_t idx   = home_slot(key, t->capacity);
+    std::size_t limit = std::min<std::size_t>(MAX_PROBE, t->capacity);
+    for( std::size_t i = 0; i < limit; ++i, idx = (idx+1) & mask )   {
+      slot_t& slot = t->slots[idx];
+      key_t   k    = slot.key.load(std::memory_order_acquire);
+      while ( k == EMPTY_KEY )   {
+	/// Above a load factor of 3/4 free slots are closed and the key moves on
+	bool  full = 4*(t->used.load(std::memory_order_relaxed)+1) > 3*t->capacity;
+	key_t desired = full ? MOVED_KEY : key;
+	if ( slot.key.compare_exchange_weak(k, desired, std::memory_order_acq_rel, std::memory_order_acquire) )   {
+	  k = desired;
+	  if ( !full ) t->used.fetch_add(1, std::memory_order_relaxed);
+	  claimed = !full;
+	}
+      }
+      if ( k == key )
+	return &slot;
+    }
+    table_t* next = t->next.load(std::memory_order_acquire);
+    if ( !next )   {
+      std::unique_ptr<table_t> table(new table_t(2*t->capacity));
+      if ( t->next.compare_exchange_strong(next, table.get(), std::memory_order_acq_rel, std::memory_order_acquire) )
+	next = table.release();
+    }
+    t = next;
+  }
+}
+
+/// Snapshot of all valid slots in ascending key order. Rebuilt only after modifications
+std::shared_ptr<const DataSegment::snapshot_t> DataSegment::sorted_slots()  const   {
+  std::size_t version = m_version.load(std::memory_order_acquire);
+  std::shared_ptr<const snapshot_t> cached = std::atomic_load(&m_snapshot);
+  if ( cached && cached->version == version )
+    return cached;
+  auto snap = std::make_shared<snapshot_t>();
+  snap->version = version;
+  snap->slots.reserve(this->size());
+  for( const table_t* t = m_table.get(); t; t = t->next.load(std::memory_order_acquire) )   {
+    for( std::size_t i = 0; i < t->capacity; ++i )   {
+      slot_t& slot = t->slots[i];
+      if ( slot.state.load(std::memory_order_acquire) == SLOT_VALID )
+	snap->slots.emplace_back(&slot);
+    }
+  }
+  std::sort(snap->slots.begin(), snap->slots.end(), [](const slot_t* a, const slot_t* b)  {
+      return a->entry.first.value() < b->entry.first.value();  });
+  std::shared_ptr<const snapshot_t> result(std::move(snap));
+  std::atomic_store(&m_snapshot, result);
+  return result;
+}
+
+/// Access the total number of slots of all chained tables
+std::size_t DataSegment::capacity()  const   {
+  std::size_t cap = 0;
+  for( const table_t* t = m_table.get(); t; t = t->next.load(std::memory_order_acquire) )
+    cap += t->capacity;
+  return cap;
+}
+
+/// Emplace data item
 bool DataSegment::emplace_any(Key key, std::any&& item)    {
   bool has_value = item.has_value();
 #if DD4HEP_DDDIGI_DEBUG
   printout(INFO, "DataSegment", "PUT Key No.%4d: %-32s %016lX -> %04X %04X %08Xld Value:%s  %s",
-	   data.size(), Key::key_name(key).c_str(), key.value(), key.segment(), key.mask(), key.item(),
+	   size(), Key::key_name(key).c_str(), key.value(), key.segment(), key.mask(), key.item(),
 	   yes_no(has_value), digiTypeName(item.type()).c_str());
 #endif
-  std::lock_guard<std::mutex> l(lock);
-  bool ret = data.emplace(key, std::move(item)).second;
-  if ( !ret )   {
-    except("DataSegment","Error in DataSegment map. Duplicate ID: segment:%04X mask:%04X Number:%d Value:%s",
-	   key.mask(), key.item(), yes_no(has_value));
+  if ( key.value() == EMPTY_KEY || key.value() == MOVED_KEY )   {
+    except("DataSegment","Error in DataSegment map. Reserved ID: segment:%04X mask:%04X Number:%d Value:%s",
+	   key.segment(), key.mask(), key.item(), yes_no(has_value));
+    return false;
   }
-  return ret;
+  bool claimed = false;
+  slot_t* slot = claim_slot(key.value(), claimed);
+  unsigned int state = SLOT_ERASED;
+  /// Either the key was claimed by this call or an erased item is revived
+  if ( claimed || slot->state.compare_exchange_strong(state, SLOT_BUSY, std::memory_order_acquire) )   {
+    slot->entry.first  = key;
+    slot->entry.second = std::move(item);
+    slot->state.store(SLOT_VALID, std::memory_order_release);
+    ++m_size;
+    ++m_version;
+    return true;
+  }
+  except("DataSegment","Error in DataSegment map. Duplicate ID: segment:%04X mask:%04X Number:%d Value:%s",
+	 key.segment(), key.mask(), key.item(), yes_no(has_value));
+  return false;
 }
 
 /// Access  data size
@@ -431,32 +823,33 @@ std::size_t DataParameters::size()  const    {
 
 template bool DataSegment::put(Key key, DataParameters&& data);
 template bool DataSegment::put(Key key, DepositVector&& data);
+template bool DataSegment::put(Key key, DepositArrays&& data);
 template bool DataSegment::put(Key key, DepositMapping&& data);
+template bool DataSegment::put(Key key, DepositFlatMapping&& data);
 template bool DataSegment::put(Key key, ParticleMapping&& data);
 template bool DataSegment::put(Key key, DetectorHistory&& data);
 template bool DataSegment::put(Key key, DetectorResponse&& data);
 
 /// Remove data item from segment
 bool DataSegment::erase(Key key)    {
-  std::lock_guard<std::mutex> l(lock);
-  auto iter = data.find(key);
-  if ( iter != data.end() )   {
-    data.erase(iter);
-    return true;
+  if ( slot_t* slot = probe(key.value()) )   {
+    unsigned int state = SLOT_VALID;
+    if ( slot->state.compare_exchange_strong(state, SLOT_BUSY, std::memory_order_acquire) )   {
+      slot->entry.second.reset();
+      slot->state.store(SLOT_ERASED, std::memory_order_release);
+      --m_size;
+      ++m_version;
+      return true;
+    }
   }
   return false;
 }
 
-/// Remove data items from segment (locked)
+/// Remove data items from segment
 std::size_t DataSegment::erase(const std::vector<Key>& keys)   {
   std::size_t count = 0;
-  std::lock_guard<std::mutex> l(lock);
   for(const auto& key : keys)   {
-    auto iter = data.find(key);
-    if ( iter != data.end() )   {
-      data.erase(iter);
-      ++count;
-    }
+    if ( this->erase(key) ) ++count;
   }
   return count;
 }
@@ -464,7 +857,7 @@ std::size_t DataSegment::erase(const std::vector<Key>& keys)   {
 /// Print segment keys
 void DataSegment::print_keys()   const   {
   size_t count = 0;
-  for( const auto& e : this->data )   {
+  for( const auto& e : *this )   {
     Key key(e.first);
     printout(INFO, "DataSegment", "Key No.%4d: %-32s %016lX -> %04X %04X %08Xld   %s",
 	     count, Key::key_name(key).c_str(), key.value(), key.segment(), key.mask(), key.item(),
@@ -486,13 +879,35 @@ std::string DataSegment::invalid_request(Key key)  const   {
   return dd4hep::format(0, "Invalid segment data requested. Key:%ld",key.value());
 }
 
+/// Find entry by key
+DataSegment::iterator DataSegment::find(Key key)   {
+  if ( find_slot(key.value()) )   {
+    auto snap = this->sorted_slots();
+    auto iter = std::lower_bound(snap->slots.begin(), snap->slots.end(), key.value(), [](const slot_t* s, key_t k)  {
+	return s->entry.first.value() < k;  });
+    if ( iter != snap->slots.end() && (*iter)->entry.first.value() == key.value() )
+      return iterator(snap, iter - snap->slots.begin());
+  }
+  return this->end();
+}
+
+/// Find entry by key
+DataSegment::const_iterator DataSegment::find(Key key)  const   {
+  if ( find_slot(key.value()) )   {
+    auto snap = this->sorted_slots();
+    auto iter = std::lower_bound(snap->slots.begin(), snap->slots.end(), key.value(), [](const slot_t* s, key_t k)  {
+	return s->entry.first.value() < k;  });
+    if ( iter != snap->slots.end() && (*iter)->entry.first.value() == key.value() )
+      return const_iterator(snap, iter - snap->slots.begin());
+  }
+  return this->end();
+}
+
 /// Access data item by key
 std::any* DataSegment::get_item(Key key, bool exc)   {
-  auto it = this->data.find(key);
-  if (it != this->data.end()) return &it->second;
+  if ( slot_t* slot = find_slot(key.value()) ) return &slot->entry.second;
   key.set_segment(0x0);
-  it = this->data.find(key);
-  if (it != this->data.end()) return &it->second;
+  if ( slot_t* slot = find_slot(key.value()) ) return &slot->entry.second;
 
   if ( exc ) throw std::runtime_error(invalid_request(key));
   return nullptr;
@@ -500,11 +915,9 @@ std::any* DataSegment::get_item(Key key, bool exc)   {
 
 /// Access data item by key  (CONST)
 const std::any* DataSegment::get_item(Key key, bool exc)  const   {
-  auto it = this->data.find(key);
-  if (it != this->data.end()) return &it->second;
+  if ( const slot_t* slot = find_slot(key.value()) ) return &slot->entry.second;
   key.set_segment(0x0);
-  it = this->data.find(key);
-  if (it != this->data.end()) return &it->second;
+  if ( const slot_t* slot = find_slot(key.value()) ) return &slot->entry.second;
 
   if ( exc ) throw std::runtime_error(invalid_request(key));
   return nullptr;
@@ -19,10 +19,141 @@
 #include <DDDigi/DigiKernel.h>
 
 // C/C++ include files
+#include <condition_variable>
 #include <stdexcept>
+#include <exception>
+#include <chrono>
+#include <thread>
+#include <deque>
 
 using namespace dd4hep::digi;
 
+/// Asynchronous writer thread of the output action
+/**
+ *  Event slots push detached output frames into a bounded queue.
+ *  If the queue is full, the event slot waits (back-pressure).
+ *  A single thread writes the frames in the order they were queued.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \ingroup DD4HEP_DIGITIZATION
+ */
+class DigiOutputAction::writer_t   {
+public:
+  using frame_t = std::unique_ptr<output_frame>;
+  using clock_t = std::chrono::steady_clock;
+
+  /// Reference to parent action
+  const DigiOutputAction& parent;
+  /// Reference to the global I/O lock protecting the file access
+  std::mutex&             io_lock;
+  /// Maximal number of frames in the queue
+  std::size_t             depth;
+  /// Writer thread
+  std::thread             thread     { };
+  /// Lock protecting the frame queue
+  std::mutex              lock       { };
+  /// Signal event slots that space is available in the queue
+  std::condition_variable space      { };
+  /// Signal the writer thread that frames are available
+  std::condition_variable ready      { };
+  /// Queue of frames to be written
+  std::deque<frame_t>     queue      { };
+  /// Exception raised by the writer thread
+  std::exception_ptr      error      { };
+  /// Flag to stop the writer thread once the queue is drained
+  bool                    stop       { false };
+
+  /// Counter: number of frames written
+  std::size_t             num_frames { 0 };
+  /// Counter: number of times event slots had to wait for space in the queue
+  std::size_t             num_blocked { 0 };
+  /// Counter: time event slots were blocked by a full queue
+  clock_t::duration       blocked    { clock_t::duration::zero() };
+  /// Counter: time the writer thread waited for frames
+  clock_t::duration       idle       { clock_t::duration::zero() };
+  /// Counter: time the writer thread spent writing
+  clock_t::duration       writing    { clock_t::duration::zero() };
+
+public:
+  /// Initializing constructor: starts the writer thread
+  writer_t(const DigiOutputAction& p, std::mutex& l, std::size_t d)
+    : parent(p), io_lock(l), depth(d)
+  {
+    thread = std::thread([this] { this->run(); });
+  }
+  /// Default destructor
+  ~writer_t()   {
+    drain();
+  }
+  /// Stop the writer thread after all pending frames are written
+  void drain()   {
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      stop = true;
+    }
+    ready.notify_all();
+    if ( thread.joinable() )  {
+      thread.join();
+    }
+  }
+  /// Queue new frame. Blocks if the queue is full
+  void push(frame_t&& frame)   {
+    std::unique_lock<std::mutex> guard(lock);
+    if ( error )   {
+      std::rethrow_exception(error);
+    }
+    if ( queue.size() >= depth )   {
+      auto start = clock_t::now();
+      space.wait(guard, [this] { return queue.size() < depth || error; });
+      blocked += clock_t::now() - start;
+      ++num_blocked;
+      if ( error )   {
+	std::rethrow_exception(error);
+      }
+    }
+    queue.emplace_back(std::move(frame));
+    ready.notify_one();
+  }
+  /// Thread body
+  void run()   {
+    for(;;)   {
+      frame_t frame;
+      {
+	std::unique_lock<std::mutex> guard(lock);
+	auto start = clock_t::now();
+	ready.wait(guard, [this] { return stop || !queue.empty(); });
+	idle += clock_t::now() - start;
+	if ( queue.empty() ) break;
+	frame = std::move(queue.front());
+	queue.pop_front();
+	space.notify_one();
+      }
+      try   {
+	auto start = clock_t::now();
+	{
+	  std::lock_guard<std::mutex> io(io_lock);
+	  if ( !parent.have_output() )   {
+	    parent.open_output();
+	  }
+	  parent.write_output(*frame);
+	  frame.reset();
+	}
+	std::lock_guard<std::mutex> guard(lock);
+	writing += clock_t::now() - start;
+	++num_frames;
+      }
+      catch(...)   {
+	std::lock_guard<std::mutex> guard(lock);
+	error = std::current_exception();
+	queue.clear();
+	space.notify_all();
+	break;
+      }
+    }
+  }
+};
+
 /// Standard constructor
 DigiOutputAction::DigiOutputAction(const DigiKernel& kernel, const std::string& nam)
   : DigiContainerSequenceAction(kernel, nam)
@@ -31,11 +162,13 @@ DigiOutputAction::DigiOutputAction(const DigiKernel& kernel, const std::string&
   declareProperty("processor_type", m_processor_type);
   declareProperty("containers",     m_containers);
   declareProperty("output",         m_output);
+  declareProperty("queue_depth",    m_queue_depth);
   InstanceCount::increment(this);
 }
 
 /// Default destructor
 DigiOutputAction::~DigiOutputAction()   {
+  m_writer.reset();
   InstanceCount::decrement(this);
 }
 
@@ -79,12 +212,38 @@ void DigiOutputAction::initialize()   {
   }
   std::lock_guard<std::mutex> lock(m_kernel.global_io_lock());
   this->DigiContainerSequenceAction::initialize();
+  if ( m_queue_depth > 0 )   {
+    m_writer = std::make_unique<writer_t>(*this, m_kernel.global_io_lock(), m_queue_depth);
+    info("+++ Asynchronous output enabled. Queue depth: %d frames", m_queue_depth);
+  }
 }
 
 /// Finalization callback
 void DigiOutputAction::finalize()   {
+  using ms_t = std::chrono::duration<double, std::milli>;
+  if ( m_writer )   {
+    m_writer->drain();
+    info("+++ Asynchronous output: %ld frames written in %9.1f ms. Writer idle: %9.1f ms",
+	 m_writer->num_frames, ms_t(m_writer->writing).count(), ms_t(m_writer->idle).count());
+    info("+++ Asynchronous output: Event slots blocked %ld times by full queue for %9.1f ms",
+	 m_writer->num_blocked, ms_t(m_writer->blocked).count());
+  }
   close_output();
   this->DigiContainerSequenceAction::finalize();
+  if ( m_writer && m_writer->error )   {
+    error("+++ Asynchronous output: The writer thread failed. Output is incomplete!");
+    std::rethrow_exception(m_writer->error);
+  }
+}
+
+/// Detach the converted event data for asynchronous writing
+std::unique_ptr<DigiOutputAction::output_frame> DigiOutputAction::detach_output()  const   {
+  return {};
+}
+
+/// Write detached event data to the output stream
+void DigiOutputAction::write_output(output_frame& /* frame */)  const   {
+  except("+++ Asynchronous output is not supported by this output action.");
 }
 
 /// Adopt new parallel worker
@@ -112,6 +271,20 @@ void DigiOutputAction::adopt_processor(DigiContainerProcessor* action,
 
 /// Pre-track action callback
 void DigiOutputAction::execute(DigiContext& context)  const   {
+  if ( m_writer )   {
+    std::unique_ptr<output_frame> frame;
+    {
+      /// Conversion to the output format is serialized, but not interlocked with I/O
+      std::lock_guard<std::mutex> lock(context.global_output_lock());
+      this->DigiContainerSequenceAction::execute(context);
+      frame = detach_output();
+    }
+    if ( frame )   {
+      m_writer->push(std::move(frame));
+      return;
+    }
+    except("+++ Asynchronous output is not supported by this output action.");
+  }
   std::lock_guard<std::mutex> lock(context.global_io_lock());
   /// Check for valid output stream. If not: open new stream
   if ( !have_output() )   {
@@ -20,6 +20,12 @@
 #include <TFile.h>
 #include <TTree.h>
 
+// C/C++ include files
+#include <condition_variable>
+#include <exception>
+#include <thread>
+#include <deque>
+
 using namespace dd4hep::digi;
 
 class DigiROOTInput::inputsource_t
@@ -37,8 +43,17 @@ public:
 public:
   /// Default constructor
   inputsource_t() = default;
-  /// Default destructor
-  ~inputsource_t() = default;
+  /// Default destructor. Caller must hold the global I/O lock
+  ~inputsource_t()   {
+    for( auto& b : branches )   {
+      auto& ent = b.second;
+      ent.branch.ResetAddress();
+      for( void* obj : ent.buffers )
+	ent.clazz.Destructor(obj);
+      ent.buffers.clear();
+      ent.address = nullptr;
+    }
+  }
   /// Check if the input source is exhausted
   bool done()   const     {
     return (entry+1) >= tree->GetEntries();
@@ -49,6 +64,42 @@ public:
   }
 };
 
+/// Event data read from the input source, but not yet converted
+/**
+ *  The branch objects are owned by the frame. When the frame is deleted
+ *  they are handed back to their branch for reuse. The frame must be
+ *  deleted while holding the global I/O lock.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \ingroup DD4HEP_DIGITIZATION
+ */
+class DigiROOTInput::frame_t   {
+public:
+  struct item_t  {
+    container_t* container;
+    void*        object;
+    Long64_t     bytes;
+  };
+  /// Reference to the input source to keep the branches alive
+  std::shared_ptr<inputsource_t> source { };
+  /// Objects read from the branches
+  std::vector<item_t>            items  { };
+  /// Entry number in the input tree
+  Long64_t                       entry  { -1 };
+  /// Total number of bytes read
+  std::size_t                    length { 0 };
+
+public:
+  /// Default constructor
+  frame_t() = default;
+  /// Default destructor
+  ~frame_t()   {
+    for( auto& i : items )
+      i.container->buffers.emplace_back(i.object);
+  }
+};
+
 /// Helper class to hide internal ROOT stuff
 /**
  *
@@ -58,7 +109,8 @@ public:
  */
 class DigiROOTInput::internals_t   {
 public:
-  using source_t = std::unique_ptr<inputsource_t>;
+  using source_t = std::shared_ptr<inputsource_t>;
+  using frame_ptr_t = std::unique_ptr<frame_t>;
   /// Reference to parent action
   DigiROOTInput* m_parent       { nullptr };
   /// Handle to input source
@@ -66,15 +118,40 @@ public:
   /// Pointer to current input source
   int            m_curr_input   { INPUT_START };
 
+  /// Prefetch: Reader thread
+  std::thread             m_reader     { };
+  /// Prefetch: Flag to start the reader thread only once
+  std::once_flag          m_started    { };
+  /// Prefetch: Reference to the global I/O lock used by the reader thread
+  std::mutex*             m_io_lock    { nullptr };
+  /// Prefetch: Lock protecting the frame queue
+  std::mutex              m_queue_lock { };
+  /// Prefetch: Signal reader that space is available in the queue
+  std::condition_variable m_space      { };
+  /// Prefetch: Signal event slots that new frames are available
+  std::condition_variable m_ready      { };
+  /// Prefetch: Queue of frames read ahead
+  std::deque<frame_ptr_t> m_queue      { };
+  /// Prefetch: Exception raised by the reader thread
+  std::exception_ptr      m_error      { };
+  /// Prefetch: Stop flag for the reader thread
+  bool                    m_stop       { false };
+
 public:
   /// Default constructor
   internals_t (DigiROOTInput* p);
   /// Default destructor
-  ~internals_t () = default;
+  ~internals_t ();
   /// Access the next valid event entry
   inputsource_t& next();
   /// Open the next input source from the input list
-  std::unique_ptr<inputsource_t> open_source();
+  source_t open_source();
+  /// Read all branches of the next event entry. Caller must hold the global I/O lock
+  frame_ptr_t read_frame();
+  /// Prefetch: Access the next frame from the queue. Starts the reader thread if necessary
+  frame_ptr_t pop_frame(std::mutex& io_lock);
+  /// Prefetch: Reader thread body
+  void reader();
 };
 
 /// Default constructor
@@ -83,8 +160,27 @@ DigiROOTInput::internals_t::internals_t (DigiROOTInput* p)
 {
 }
 
+/// Default destructor
+DigiROOTInput::internals_t::~internals_t ()   {
+  {
+    std::lock_guard<std::mutex> lock(m_queue_lock);
+    m_stop = true;
+  }
+  m_space.notify_all();
+  if ( m_reader.joinable() )  {
+    m_reader.join();
+  }
+  /// Frames and input sources may only be released while holding the global I/O lock.
+  /// The lock is only known once the reader thread was started: otherwise no frames are queued.
+  if ( m_io_lock )  {
+    std::lock_guard<std::mutex> lock(*m_io_lock);
+    m_queue.clear();
+    m_source.reset();
+  }
+}
+
 /// Open the next input source from the input list
-std::unique_ptr<DigiROOTInput::inputsource_t> DigiROOTInput::internals_t::open_source()   {
+DigiROOTInput::internals_t::source_t DigiROOTInput::internals_t::open_source()   {
   const auto& inputs    = m_parent->inputs();
   const auto& tree_name = m_parent->input_section();
   int len = inputs.size();
@@ -110,7 +206,7 @@ std::unique_ptr<DigiROOTInput::inputsource_t> DigiROOTInput::internals_t::open_s
 			tree_name.c_str(), fname.c_str());
 	continue;
       }
-      auto source   = std::make_unique<inputsource_t>();
+      auto source   = std::make_shared<inputsource_t>();
       source->file  = std::move(file);
       source->tree  = tree;
       auto* branches = tree->GetListOfBranches();
@@ -128,6 +224,12 @@ std::unique_ptr<DigiROOTInput::inputsource_t> DigiROOTInput::internals_t::open_s
       if ( source->branches.empty() )    {
 	m_parent->except("+++ No branches to be loaded. Configuration error!");
       }
+      if ( m_parent->m_cache_size > 0 )   {
+	tree->SetCacheSize(m_parent->m_cache_size);
+	for( auto& b : source->branches )
+	  tree->AddBranchToCache(&b.second.branch, kTRUE);
+	tree->StopCacheLearningPhase();
+      }
       m_parent->onOpenFile(*source);
       return source;
     }
@@ -146,10 +248,88 @@ DigiROOTInput::inputsource_t& DigiROOTInput::internals_t::next()   {
   return src;
 }
 
+/// Read all branches of the next event entry. Caller must hold the global I/O lock
+DigiROOTInput::internals_t::frame_ptr_t DigiROOTInput::internals_t::read_frame()   {
+  auto& src   = next();
+  auto  frame = std::make_unique<frame_t>();
+  frame->source = m_source;
+  frame->entry  = src.entry;
+  frame->items.reserve(src.branches.size());
+  for( auto& b : src.branches )    {
+    auto& ent = b.second;
+    /// Every entry is read into an object no other frame uses, which is then handed over
+    /// to the frame. Objects of released frames are reused: if the object is still
+    /// connected to the branch, the branch address need not be changed.
+    void* obj = nullptr;
+    if ( ent.buffers.empty() )   {
+      obj = ent.clazz.New();
+    }
+    else   {
+      obj = ent.buffers.back();
+      ent.buffers.pop_back();
+    }
+    if ( obj != ent.address )   {
+      ent.address = obj;
+      ent.branch.SetAddress(&ent.address);
+    }
+    Long64_t bytes = ent.branch.GetEntry( src.entry );
+    frame->items.emplace_back(frame_t::item_t{ &ent, obj, bytes });
+    frame->length += bytes > 0 ? bytes : 0;
+  }
+  return frame;
+}
+
+/// Prefetch: Reader thread body
+void DigiROOTInput::internals_t::reader()   {
+  std::size_t depth = m_parent->m_prefetch;
+  for(;;)   {
+    frame_ptr_t frame;
+    {
+      std::unique_lock<std::mutex> lock(m_queue_lock);
+      m_space.wait(lock, [this, depth] { return m_stop || m_queue.size() < depth; });
+      if ( m_stop ) break;
+    }
+    try  {
+      std::lock_guard<std::mutex> lock(*m_io_lock);
+      frame = read_frame();
+    }
+    catch(...)   {
+      std::lock_guard<std::mutex> lock(m_queue_lock);
+      m_error = std::current_exception();
+      m_ready.notify_all();
+      break;
+    }
+    std::lock_guard<std::mutex> lock(m_queue_lock);
+    m_queue.emplace_back(std::move(frame));
+    m_ready.notify_one();
+  }
+}
+
+/// Prefetch: Access the next frame from the queue. Starts the reader thread if necessary
+DigiROOTInput::internals_t::frame_ptr_t DigiROOTInput::internals_t::pop_frame(std::mutex& io_lock)   {
+  std::call_once(m_started, [this, &io_lock]  {
+    ROOT::EnableThreadSafety();
+    m_io_lock = &io_lock;
+    m_reader  = std::thread([this] { this->reader(); });
+  });
+  std::unique_lock<std::mutex> lock(m_queue_lock);
+  m_ready.wait(lock, [this] { return !m_queue.empty() || m_error; });
+  if ( m_queue.empty() )   {
+    std::rethrow_exception(m_error);
+  }
+  frame_ptr_t frame = std::move(m_queue.front());
+  m_queue.pop_front();
+  m_space.notify_one();
+  return frame;
+}
+
 /// Standard constructor
 DigiROOTInput::DigiROOTInput(const DigiKernel& kernel, const std::string& nam)
   : DigiInputAction(kernel, nam)
 {
+  declareProperty("prefetch",    m_prefetch);
+  declareProperty("cache_size",  m_cache_size);
+  declareProperty("implicit_mt", m_implicit_mt);
   imp = std::make_unique<internals_t>(this);
   InstanceCount::increment(this);
 }
@@ -164,24 +344,44 @@ DigiROOTInput::~DigiROOTInput()   {
 void DigiROOTInput::execute(DigiContext& context)  const   {
   //
   //  We have to lock all ROOT based actions. Consequences are SEGV otherwise.
+  //  Only the reading of the branches is protected by the global I/O lock.
+  //  The conversion of the objects read is done outside.
   //
-  std::lock_guard<std::mutex> lock(context.global_io_lock());
+  std::unique_ptr<frame_t> frame;
+  /// Release the objects and possibly the input source while holding the lock.
+  /// The guard also covers the exception path of reading and conversion.
+  struct frame_release_t  {
+    std::mutex&               lock;
+    std::unique_ptr<frame_t>& frame;
+    ~frame_release_t()   {
+      std::lock_guard<std::mutex> guard(lock);
+      frame.reset();
+    }
+  } release { context.global_io_lock(), frame };
+  if ( m_implicit_mt && !ROOT::IsImplicitMTEnabled() )   {
+    std::lock_guard<std::mutex> lock(context.global_io_lock());
+    if ( !ROOT::IsImplicitMTEnabled() ) ROOT::EnableImplicitMT();
+  }
+  if ( m_prefetch > 0 )   {
+    frame = imp->pop_frame(context.global_io_lock());
+  }
+  else   {
+    std::lock_guard<std::mutex> lock(context.global_io_lock());
+    frame = imp->read_frame();
+  }
   auto& event = context.event;
-  auto& source = imp->next();
-  std::size_t input_len = 0;
+  auto& source = *frame->source;
 
   /// We only get here with a valid input
   DataSegment& segment = event->get_segment(m_input_segment);
-  for( auto& b : source.branches )    {
-    auto& ent = b.second;
-    Long64_t bytes = ent.branch.GetEntry( source.entry );
-    if ( bytes > 0 )  {
-      work_t work { segment, ent };
+  for( auto& i : frame->items )    {
+    auto& ent = *i.container;
+    if ( i.bytes > 0 )  {
+      work_t work { segment, ent, i.object };
       (*this)(context, work);
-      input_len += bytes;
     }
-    debug("%s+++ Loaded %8ld bytes from branch %s", event->id(), bytes, ent.branch.GetName());
+    debug("%s+++ Loaded %8ld bytes from branch %s", event->id(), i.bytes, ent.branch.GetName());
   }
   info("%s+++ Read event %6ld [%ld bytes] from tree %s file: %s",
-       event->id(), source.entry, input_len, source.tree->GetName(), source.file->GetName());
+       event->id(), frame->entry, frame->length, source.tree->GetName(), source.file->GetName());
 }
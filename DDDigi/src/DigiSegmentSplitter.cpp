@@ -43,6 +43,7 @@ void DigiSegmentProcessContext::enable(uint32_t split_id)  {
   this->predicate.id = split_id;
   this->predicate.segmentation = this;
   this->predicate.callback = std::bind(&DigiSegmentProcessContext::use_depo, this, std::placeholders::_1);
+  this->predicate.selection = predicate_t::SELECT_SEGMENT;
 }
 
 /// Worker adaptor for caller DigiContainerSequence
@@ -190,14 +190,16 @@ Geant4Output2EDM4hep::Geant4Output2EDM4hep(Geant4Context* ctxt, const std::strin
 
 /// Default destructor
 Geant4Output2EDM4hep::~Geant4Output2EDM4hep()  {
-  G4AutoLock protection_lock(&action_mutex);
+  G4AutoLock protection_lock(&action_mutex, std::defer_lock);
+  if ( !m_filesByThread ) protection_lock.lock();
   m_file.reset();
   InstanceCount::decrement(this);
 }
 
 // Callback to store the Geant4 run information
 void Geant4Output2EDM4hep::beginRun(const G4Run* run)  {
-  G4AutoLock protection_lock(&action_mutex);
+  G4AutoLock protection_lock(&action_mutex, std::defer_lock);
+  if ( !m_filesByThread ) protection_lock.lock();
   std::string fname = m_output;
   m_runNo = run->GetRunID();
   if ( m_filesByRun )    {
@@ -206,6 +208,7 @@ void Geant4Output2EDM4hep::beginRun(const G4Run* run)  {
       fname = m_output.substr(0, idx) + _toString(m_runNo, ".run%08d") + m_output.substr(idx);
     }
   }
+  fname = threadOutputName(fname);
   if ( !m_file && !fname.empty() )   {
     m_file = std::make_unique<podio::ROOTFrameWriter>(fname);
     if ( !m_file )   {
@@ -227,7 +230,9 @@ void Geant4Output2EDM4hep::endRun(const G4Run* run)  {
 /// Commit data at end of filling procedure
 void Geant4Output2EDM4hep::commit( OutputContext<G4Event>& /* ctxt */)   {
   if ( m_file )   {
-    G4AutoLock protection_lock(&action_mutex);
+    /// Worker files need no protection: every thread owns its writer
+    G4AutoLock protection_lock(&action_mutex, std::defer_lock);
+    if ( !m_filesByThread ) protection_lock.lock();
     m_frame.put( std::move(m_particles), "MCParticles");
     m_file->writeFrame(m_frame, m_section_name);
     m_particles.clear();
@@ -239,7 +244,8 @@ void Geant4Output2EDM4hep::commit( OutputContext<G4Event>& /* ctxt */)   {
 
 /// Callback to store the Geant4 run information
 void Geant4Output2EDM4hep::saveRun(const G4Run* run)   {
-  G4AutoLock protection_lock(&action_mutex);
+  G4AutoLock protection_lock(&action_mutex, std::defer_lock);
+  if ( !m_filesByThread ) protection_lock.lock();
   // --- write an edm4hep::RunHeader ---------
   // Runs are just Frames with different contents in EDM4hep / podio. We simply
   // store everything as parameters for now
@@ -299,6 +299,16 @@ namespace dd4hep {
         Hit& storePoint(const G4Step* step, const G4StepPoint* point);
 	/// Store Geant4 spot information into tracker hit structure.
 	Hit& storePoint(const Geant4FastSimSpot* spot);
+#ifndef __DDG4_STANDALONE_DICTIONARIES__
+        /// Pooled allocation: memory of deleted hits is recycled by the deleting thread
+        static void* operator new(std::size_t size);
+        /// Pooled deallocation: keep the memory block for the next hit
+        static void  operator delete(void* ptr, std::size_t size);
+        /// Placement new (required by the ROOT dictionaries, hidden otherwise)
+        static void* operator new(std::size_t, void* ptr) noexcept  {  return ptr;  }
+        /// Placement delete matching the placement new
+        static void  operator delete(void*, void*) noexcept  {   }
+#endif
       };
     };
 
@@ -345,6 +355,16 @@ namespace dd4hep {
         Hit& operator=(Hit&& c) = delete;
         /// Copy assignment operator
         Hit& operator=(const Hit& c) = delete;
+#ifndef __DDG4_STANDALONE_DICTIONARIES__
+        /// Pooled allocation: memory of deleted hits is recycled by the deleting thread
+        static void* operator new(std::size_t size);
+        /// Pooled deallocation: keep the memory block for the next hit
+        static void  operator delete(void* ptr, std::size_t size);
+        /// Placement new (required by the ROOT dictionaries, hidden otherwise)
+        static void* operator new(std::size_t, void* ptr) noexcept  {  return ptr;  }
+        /// Placement delete matching the placement new
+        static void  operator delete(void*, void*) noexcept  {   }
+#endif
       };
     };
 
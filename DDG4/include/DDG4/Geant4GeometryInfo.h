@@ -24,6 +24,7 @@
 // C/C++ include files
 #include <map>
 #include <vector>
+#include <cstdint>
 
 // Forward declarations (TGeo)
 class TGeoElement;
@@ -47,6 +48,7 @@ class G4LogicalBorderSurface;
 class G4AssemblyVolume;
 class G4VSensitiveDetector;
 class G4PhysicsOrderedFreeVector;
+class G4VTouchable;
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -93,9 +95,20 @@ namespace dd4hep {
      */
     class Geant4GeometryInfo : public TNamed, public detail::GeoHandlerTypes::GeometryInfo {
     public:
+      /// Pre-computed encoding of the copy number of a parameterised or replicated path level
+      struct PlacementCopyEncoder  {
+	/// Touchable history depth of the parameterised/replicated placement
+	int          depth;
+	/// Bit offset of the volume ID field. Negative if the field could not be resolved
+	int          offset;
+	/// Bit mask of the volume ID field
+	VolumeID     mask;
+      };
       struct Placement  {
 	VolumeID     volumeID;
 	int          flags;
+	/// Copy number encoders of all parameterised/replicated levels of the path
+	std::vector<PlacementCopyEncoder> copyEncoders;
       };
       union PlacementFlags {
 	int value;
@@ -109,6 +122,62 @@ namespace dd4hep {
 	PlacementFlags(int v) { this->value = v; }
       };
       typedef std::vector<const G4VPhysicalVolume*>  Geant4PlacementPath;
+
+      /// Flat open-addressing hash index over the sensitive placement paths in g4Paths
+      /**
+       *  The hash is a rolling hash over the physical volumes of the touchable
+       *  history. It is computed directly from the G4VTouchable without
+       *  materializing the placement path. Each thread keeps the last hit
+       *  to short-cut consecutive steps in the same cell.
+       *
+       *  \author  M.Frank
+       *  \version 1.0
+       *  \ingroup DD4HEP_SIMULATION
+       */
+      class PlacementIndex  {
+      public:
+        /// Single slot of the hash table. Pointers reference the entries of g4Paths
+        struct Entry  {
+          std::size_t                 hash  { 0UL };
+          const Geant4PlacementPath*  path  { nullptr };
+          const Placement*            value { nullptr };
+        };
+      private:
+        /// Open addressing table with linear probing. Size is always a power of 2
+        std::vector<Entry> m_table;
+        /// Bit-mask to map the hash value to the table slot
+        std::size_t        m_mask { 0UL };
+        /// Unique build identifier to invalidate the per-thread last-hit caches
+        std::size_t        m_generation { 0UL };
+
+      public:
+        /// Rolling hash: add one placement level
+        static std::size_t hash_level(std::size_t hash, const G4VPhysicalVolume* pv)  {
+          hash ^= reinterpret_cast<std::uintptr_t>(pv);
+          hash *= 0x100000001B3ULL;
+          return hash ^ (hash >> 29);
+        }
+        /// Initial value of the rolling hash
+        static constexpr std::size_t hash_seed()  {   return 0xCBF29CE484222325ULL;  }
+        /// Compute the path hash from a placement path
+        static std::size_t hash(const Geant4PlacementPath& path);
+        /// Compute the path hash from a touchable object
+        static std::size_t hash(const G4VTouchable* touchable);
+
+        /// (Re-)build the index from the placement path map
+        void build(const std::map<Geant4PlacementPath, Placement>& paths);
+        /// Clear the index content
+        void clear();
+        /// Number of occupied slots
+        std::size_t size()  const;
+        /// Capacity of the hash table
+        std::size_t capacity()  const   {  return m_table.size();   }
+        /// Lookup by placement path. Returns null if the path is not indexed
+        const Entry* find(const Geant4PlacementPath& path)  const;
+        /// Lookup by touchable object. Returns null if the touchable history is not indexed
+        const Entry* find(const G4VTouchable* touchable)  const;
+      };
+
       TGeoManager*                         manager = 0;
       Geant4GeometryMaps::IsotopeMap       g4Isotopes;
       Geant4GeometryMaps::ElementMap       g4Elements;
@@ -137,6 +206,7 @@ namespace dd4hep {
       std::map<VisAttr, G4VisAttributes*>                      g4Vis;
       std::map<LimitSet, G4UserLimits*>                        g4Limits;
       std::map<Geant4PlacementPath, Placement>                 g4Paths;
+      PlacementIndex                                           g4PathIndex;
       std::map<SensitiveDetector,std::set<const TGeoVolume*> > sensitives;
       std::map<Region,           std::set<const TGeoVolume*> > regions;
       std::map<LimitSet,         std::set<const TGeoVolume*> > limits;
@@ -193,6 +193,11 @@ namespace dd4hep {
      * This obviously only helps, if contributions to the same cell come in
      * sequence ie. from the same G4Track.
      *
+     * Hits added with a key (see add(VolumeID key, TYPE* hit)) are
+     * found in O(1) using findByKey with an open addressing hash index.
+     * The memory of the hit container and of the key index is recycled
+     * at the end of the event by the next collection created by the thread.
+     *
      *
      *  \author  M.Frank
      *  \version 1.0
@@ -205,8 +210,74 @@ namespace dd4hep {
       typedef std::vector<Geant4HitWrapper>    WrappedHits;
       /// Hit manipulator
       typedef Geant4HitWrapper::HitManipulator Manip;
+
+      /// Open addressing hash index of the hit keys for fast random lookup
+      /**
+       *  Maps the hit key (typically the cell identifier) to the position
+       *  of the hit in the container. Linear probing in a table with a
+       *  power-of-two size. The table is grown at a load factor of 1/2.
+       *  clear() keeps the table for re-use. The tables of deleted hit
+       *  collections are recycled by the next collection of the same thread,
+       *  hence after the first events no memory is allocated anymore.
+       *
+       * \author  M.Frank
+       * \version 1.0
+       *  \ingroup DD4HEP_SIMULATION
+       */
+      class KeyIndex  {
+      public:
+        /// Marker of the empty table slots
+        static constexpr size_t npos = ~size_t(0);
+        /// Table slot
+        struct Entry  {
+          VolumeID key;
+          size_t   index;
+        };
+        typedef std::vector<Entry> Table;
+
+      protected:
+        /// Slot table
+        Table  m_table;
+        /// Number of used slots
+        size_t m_size  { 0 };
+
+        /// Slot of a key in the table
+        static size_t hash(VolumeID key)  {
+          unsigned long long h = key;
+          h ^= h >> 33;
+          h *= 0xff51afd7ed558ccdULL;
+          h ^= h >> 33;
+          return size_t(h);
+        }
+        /// Re-hash all entries into a table of the given size
+        void rehash(size_t new_size);
+
+      public:
+        /// Number of keys
+        size_t size()  const    {  return m_size;       }
+        /// Check if the index has no entries
+        bool   empty()  const   {  return m_size == 0;  }
+        /// Remove all entries. The table is kept for re-use
+        void   clear();
+        /// Access the position of a given key. Returns npos if not present
+        size_t find(VolumeID key)  const  {
+          if ( m_size == 0 ) return npos;
+          const size_t mask = m_table.size()-1;
+          for( size_t i = hash(key) & mask; ; i = (i+1) & mask )  {
+            const Entry& e = m_table[i];
+            if ( e.index == npos ) return npos;
+            if ( e.key == key    ) return e.index;
+          }
+        }
+        /// Insert key if not present. Returns false if the key is already present
+        bool   insert(VolumeID key, size_t index);
+        /// Hand the table over to the caller. Used to recycle the memory
+        Table  detach();
+        /// Adopt a recycled table
+        void   adopt(Table&& table);
+      };
       /// Hit key map for fast random lookup
-      typedef std::map<VolumeID, size_t>  Keys;
+      typedef KeyIndex  Keys;
 
       /// Generic class template to compare/select hits in Geant4HitCollection objects
       /**
@@ -338,8 +409,7 @@ namespace dd4hep {
       /// Add a new hit with a check, that the hit is of the same type
       template <typename TYPE> void add(VolumeID key, TYPE* hit_pointer) {
         m_lastHit = m_hits.size();
-        std::pair<Keys::iterator,bool> ret = m_keys.emplace(key,m_lastHit);
-        if ( ret.second )  {
+        if ( m_keys.insert(key,m_lastHit) )  {
           Geant4HitWrapper w(m_manipulator->castHit(hit_pointer));
           m_hits.emplace_back(w);
           return;
@@ -352,10 +422,10 @@ namespace dd4hep {
       }
       /// Find hits in a collection by comparison of key value
       template <typename TYPE> TYPE* findByKey(VolumeID key) {
-        Keys::const_iterator i=m_keys.find(key);
-        if ( i == m_keys.end() ) return 0;
-        m_lastHit = (*i).second;
-        TYPE* obj = m_hits.at(m_lastHit);
+        size_t idx = m_keys.find(key);
+        if ( idx == Keys::npos ) return 0;
+        m_lastHit = idx;
+        TYPE* obj = m_hits[idx];
         return obj;
       }
       /// Release all hits from the Geant4 container and pass ownership to the caller
@@ -73,6 +73,8 @@ namespace dd4hep {
       virtual void closeOutput();
       /// Callback to store the Geant4 run information
       virtual void beginRun(const G4Run* run);
+      /// Callback to close the worker output files at the end of the run
+      virtual void endRun(const G4Run* run);
       /// Callback to store each Geant4 hit collection
       virtual void saveCollection(OutputContext<G4Event>& ctxt, G4VHitsCollection* collection);
       /// Callback to store the Geant4 event
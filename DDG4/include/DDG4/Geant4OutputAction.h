@@ -56,8 +56,24 @@ namespace dd4hep {
       std::string m_output;
       /// Property: "HandleErrorsAsFatal" Handle errors as fatal and rethrow eventual exceptions
       bool        m_errorFatal;
+      /// Property: "FilesByThread" Every worker thread writes its own output file
+      bool        m_filesByThread    { false };
+      /// Property: "MergeThreadFiles" Merge the worker output files when the master kernel terminates
+      bool        m_mergeThreadFiles { true };
+      /// Flag if this instance contributed worker output files
+      bool        m_threadFilesUsed  { false };
       /// Reference to MC truth object
       Geant4ParticleMap* m_truth;
+
+      /// Access the output file name for the calling thread
+      /** With the property "FilesByThread" set, the worker thread identifier is
+       *  appended to the file name and the file is registered to be merged
+       *  into the requested output file when the master kernel terminates.
+       *  Worker files must therefore be closed at the end of each run; files
+       *  of later runs get a sequence number appended to the thread identifier.
+       *  This requires one output action instance per worker thread.
+       */
+      std::string threadOutputName(const std::string& fname);
     public:
       /// Inhibit default constructor
       Geant4OutputAction() = delete;
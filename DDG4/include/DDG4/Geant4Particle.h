@@ -15,6 +15,7 @@
 #define DDG4_GEANT4PARTICLE_H
 
 // Framework include files
+#include "DDG4/Geant4TrackIndexMap.h"
 
 // ROOT includes
 #include "Math/Vector4D.h"
@@ -168,6 +169,16 @@ namespace dd4hep {
       void removeDaughter(int id_daughter);
       /// Charge accessor (for python etc.)
       int charge3() const  {  return charge; }
+#ifndef __DDG4_STANDALONE_DICTIONARIES__
+      /// Pooled allocation: memory of released particles is recycled by the deleting thread
+      static void* operator new(std::size_t size);
+      /// Pooled deallocation: keep the memory block for the next particle
+      static void  operator delete(void* ptr, std::size_t size);
+      /// Placement new (required by the ROOT dictionaries, hidden otherwise)
+      static void* operator new(std::size_t, void* ptr) noexcept  {  return ptr;  }
+      /// Placement delete matching the placement new
+      static void  operator delete(void*, void*) noexcept  {   }
+#endif
     };
 
 #ifndef __DDG4_STANDALONE_DICTIONARIES__
@@ -328,15 +339,18 @@ namespace dd4hep {
      *  Note: This object takes OWNERSHIP of the inserted particles!
      *        beware of double deletion of objects!
      *
+     *  Both maps are keyed by Geant4 track identifiers and are stored
+     *  densely indexed by the track identifier (see Geant4TrackIndexMap).
+     *
      *  \author  M.Frank
      *  \version 1.0
      *  \ingroup DD4HEP_SIMULATION
      */
     class Geant4ParticleMap  {
     public:
-      typedef Geant4Particle          Particle;
-      typedef std::map<int,Particle*> ParticleMap;
-      typedef std::map<int,int>       TrackEquivalents;
+      typedef Geant4Particle                       Particle;
+      typedef Geant4TrackIndexMap<Particle*>       ParticleMap;
+      typedef Geant4TrackIndexMap<int>             TrackEquivalents;
       /// Mapping of particles of this event
       ParticleMap particleMap; //! not persistent
       /// Map associating the G4Track identifiers with identifiers of existing MCParticles
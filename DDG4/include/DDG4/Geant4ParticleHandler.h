@@ -105,6 +105,16 @@ namespace dd4hep {
       double m_minDistToParentVertex;
       /// Property: All the processes of which the decay products will be explicitly stored
       Processes                  m_processNames;
+      /// Property: Accumulated time [seconds] spent to recombine parents at the end of the event
+      double m_timeRecombine;
+      /// Property: Accumulated time [seconds] spent to rebase the simulated tracks
+      double m_timeRebase;
+      /// Property: Accumulated time [seconds] spent in the record consistency check
+      double m_timeConsistency;
+      /// Property: Accumulated time [seconds] spent to set the vertex endpoint bits
+      double m_timeVertexBits;
+      /// Property: Number of events processed by the end-of-event passes
+      long   m_numTimedEvents;
 
       /** Object variables, which are constant after initialization */
       /// User action pointer
@@ -124,6 +134,10 @@ namespace dd4hep {
       bool              m_haveSuspended = false;
       /// Map associating the G4Track identifiers with identifiers of existing MCParticles
       TrackEquivalents  m_equivalentTracks;
+      /// Work buffer: identifiers of the tracks removed by recombineParents
+      std::vector<int>  m_removedTracks;
+      /// Work buffer: G4Track identifier -> identifier of the track kept in the record
+      std::vector<int>  m_resolvedTracks;
 
       /// Recombine particles and associate the to parents with cleanup
       int recombineParents();
@@ -0,0 +1,214 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+#ifndef DDG4_GEANT4TRACKINDEXMAP_H
+#define DDG4_GEANT4TRACKINDEXMAP_H
+
+// C/C++ include files
+#include <vector>
+#include <string>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
+  namespace sim {
+
+    /// Dense associative container keyed by a non-negative Geant4 track identifier
+    /**
+     *  Drop-in replacement for std::map<int,T> where the keys are track or
+     *  particle identifiers: these are small, non-negative and nearly dense
+     *  within one event. The entries are stored in a vector indexed by the key.
+     *  Unused slots are marked with a negative key and skipped by the iterators,
+     *  hence iteration is in ascending key order like for std::map.
+     *
+     *  Differences to std::map:
+     *  - Keys must be non-negative. Negative keys are not found and
+     *    cannot be inserted.
+     *  - Insertions beyond the current capacity invalidate iterators.
+     *    Erasing an entry does not invalidate iterators to other entries.
+     *  - clear() keeps the allocated memory for the next event.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    template <typename T> class Geant4TrackIndexMap   {
+    public:
+      typedef int                    key_type;
+      typedef T                      mapped_type;
+      typedef std::pair<int, T>      value_type;
+      typedef std::size_t            size_type;
+      typedef std::vector<value_type> data_type;
+
+      /// Bidirectional iterator skipping unused slots
+      template <typename V> class iterator_t  {
+        friend class Geant4TrackIndexMap;
+        template <typename W> friend class iterator_t;
+        V* m_ptr   { nullptr };
+        V* m_begin { nullptr };
+        V* m_end   { nullptr };
+        iterator_t(V* p, V* b, V* e) : m_ptr(p), m_begin(b), m_end(e)  {
+          while ( m_ptr != m_end && m_ptr->first < 0 ) ++m_ptr;
+        }
+      public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef typename std::remove_const<V>::type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef V* pointer;
+        typedef V& reference;
+        /// Default constructor
+        iterator_t() = default;
+        /// Conversion from non-const to const iterator
+        template <typename W> iterator_t(const iterator_t<W>& c)
+          : m_ptr(c.m_ptr), m_begin(c.m_begin), m_end(c.m_end)  {}
+        reference operator*()  const  {  return *m_ptr;  }
+        pointer   operator->() const  {  return m_ptr;   }
+        iterator_t& operator++()  {
+          do { ++m_ptr; } while ( m_ptr != m_end && m_ptr->first < 0 );
+          return *this;
+        }
+        iterator_t operator++(int)  {  iterator_t tmp(*this); ++(*this); return tmp;  }
+        iterator_t& operator--()  {
+          do { --m_ptr; } while ( m_ptr != m_begin && m_ptr->first < 0 );
+          return *this;
+        }
+        iterator_t operator--(int)  {  iterator_t tmp(*this); --(*this); return tmp;  }
+        template <typename W> bool operator==(const iterator_t<W>& c) const  {  return m_ptr == c.m_ptr;  }
+        template <typename W> bool operator!=(const iterator_t<W>& c) const  {  return m_ptr != c.m_ptr;  }
+      };
+      typedef iterator_t<value_type>                iterator;
+      typedef iterator_t<const value_type>          const_iterator;
+      typedef std::reverse_iterator<iterator>       reverse_iterator;
+      typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    protected:
+      /// Slot storage indexed by key. Unused slots have first < 0
+      data_type m_data;
+      /// Number of used slots
+      size_type m_size { 0 };
+
+      iterator make_iter(size_type idx)  {
+        value_type* b = m_data.data();
+        return iterator(b+idx, b, b+m_data.size());
+      }
+      const_iterator make_iter(size_type idx)  const  {
+        const value_type* b = m_data.data();
+        return const_iterator(b+idx, b, b+m_data.size());
+      }
+      bool used(key_type key)  const  {
+        return key >= 0 && size_type(key) < m_data.size() && m_data[key].first >= 0;
+      }
+
+    public:
+      /// Default constructor
+      Geant4TrackIndexMap() = default;
+      /// Copy constructor
+      Geant4TrackIndexMap(const Geant4TrackIndexMap& copy) = default;
+      /// Move constructor
+      Geant4TrackIndexMap(Geant4TrackIndexMap&& copy) = default;
+      /// Assignment operator
+      Geant4TrackIndexMap& operator=(const Geant4TrackIndexMap& copy) = default;
+      /// Move assignment
+      Geant4TrackIndexMap& operator=(Geant4TrackIndexMap&& copy) = default;
+
+      /// Number of entries
+      size_type size()  const     {  return m_size;         }
+      /// Check if the container has no entries
+      bool empty()  const         {  return m_size == 0;    }
+      /// Remove all entries. The slot storage is kept for re-use
+      void clear()                {  m_data.clear(); m_size = 0;  }
+      /// Pre-allocate slots for keys [0, num_keys)
+      void reserve(size_type num_keys)  {  m_data.reserve(num_keys);  }
+
+      iterator begin()                        {  return make_iter(0);              }
+      iterator end()                          {  return make_iter(m_data.size());  }
+      const_iterator begin()  const           {  return make_iter(0);              }
+      const_iterator end()    const           {  return make_iter(m_data.size());  }
+      reverse_iterator rbegin()               {  return reverse_iterator(end());   }
+      reverse_iterator rend()                 {  return reverse_iterator(begin()); }
+      const_reverse_iterator rbegin()  const  {  return const_reverse_iterator(end());   }
+      const_reverse_iterator rend()    const  {  return const_reverse_iterator(begin()); }
+
+      /// Number of entries with a given key (0 or 1)
+      size_type count(key_type key)  const  {  return used(key) ? 1 : 0;  }
+      /// Find entry by key
+      iterator find(key_type key)  {
+        return used(key) ? make_iter(key) : end();
+      }
+      /// Find entry by key
+      const_iterator find(key_type key)  const  {
+        return used(key) ? make_iter(key) : end();
+      }
+      /// Checked access by key
+      mapped_type& at(key_type key)  {
+        if ( !used(key) ) throw std::out_of_range("Geant4TrackIndexMap: No entry with key "+std::to_string(key));
+        return m_data[key].second;
+      }
+      /// Checked access by key
+      const mapped_type& at(key_type key)  const  {
+        if ( !used(key) ) throw std::out_of_range("Geant4TrackIndexMap: No entry with key "+std::to_string(key));
+        return m_data[key].second;
+      }
+      /// Access entry by key. Inserts a default constructed entry if not present
+      mapped_type& operator[](key_type key)  {
+        return emplace(key).first->second;
+      }
+      /// Insert entry if the key is not present (same semantics as std::map::emplace)
+      template <typename... Args> std::pair<iterator,bool> emplace(key_type key, Args&&... args)  {
+        if ( key < 0 )  {
+          throw std::out_of_range("Geant4TrackIndexMap: Invalid negative key "+std::to_string(key));
+        }
+        if ( size_type(key) >= m_data.size() )  {
+          size_type n = m_data.size();
+          if ( size_type(key) >= m_data.capacity() )
+            m_data.reserve(std::max(2*m_data.capacity(), size_type(key)+1));
+          m_data.resize(size_type(key)+1);
+          for( ; n < m_data.size(); ++n ) m_data[n].first = -1;
+        }
+        value_type& slot = m_data[key];
+        if ( slot.first >= 0 )  {
+          return std::make_pair(make_iter(key), false);
+        }
+        slot.first  = key;
+        slot.second = mapped_type(std::forward<Args>(args)...);
+        ++m_size;
+        return std::make_pair(make_iter(key), true);
+      }
+      /// Insert entry if the key is not present
+      std::pair<iterator,bool> insert(const value_type& value)  {
+        return emplace(value.first, value.second);
+      }
+      /// Remove entry. Returns the iterator to the next entry
+      iterator erase(const_iterator pos)  {
+        size_type idx = pos.m_ptr - m_data.data();
+        value_type& slot = m_data[idx];
+        slot.first  = -1;
+        slot.second = mapped_type();
+        --m_size;
+        return make_iter(idx);
+      }
+      /// Remove entry by key. Returns the number of removed entries
+      size_type erase(key_type key)  {
+        if ( !used(key) ) return 0;
+        erase(const_iterator(make_iter(key)));
+        return 1;
+      }
+    };
+  }    // End namespace sim
+}      // End namespace dd4hep
+#endif // DDG4_GEANT4TRACKINDEXMAP_H
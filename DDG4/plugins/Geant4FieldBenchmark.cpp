@@ -0,0 +1,141 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include "DD4hep/Detector.h"
+#include "DD4hep/Printout.h"
+#include "DD4hep/Factories.h"
+#include "DD4hep/DD4hepUnits.h"
+#include "DDG4/Geant4Field.h"
+
+// Geant4 include files
+#include "CLHEP/Units/SystemOfUnits.h"
+
+// C/C++ include files
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cstring>
+#include <iostream>
+#include <algorithm>
+
+using namespace dd4hep;
+using namespace dd4hep::sim;
+
+/// Throughput benchmark of the magnetic field access by Geant4
+/**
+ *  Factory: DD4hep_Geant4FieldBenchmark
+ *
+ *  The field of the loaded detector description is evaluated at random
+ *  points through Geant4Field::GetFieldValue, which is the entry point
+ *  used by the Geant4 propagation. The result is compared to the sum
+ *  of all field components evaluated one by one, ie. without the
+ *  spatial index of the overlayed field.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ */
+static long geant4_field_benchmark(Detector& description, int argc, char** argv) {
+  std::size_t num_points = 1000000;
+  double      half[3]    = { 1e3, 1e3, 1e3 };   // Half lengths of the sampled box [mm]
+  bool        arg_error  = false;
+  for(int i = 0; i < argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-points",argv[i],4) && i+1 < argc )
+      num_points = std::stoul(argv[++i]);
+    else if ( 0 == ::strncmp("-box",argv[i],4) && i+3 < argc )  {
+      half[0] = _toDouble(argv[++i]) / dd4hep::mm;
+      half[1] = _toDouble(argv[++i]) / dd4hep::mm;
+      half[2] = _toDouble(argv[++i]) / dd4hep::mm;
+    }
+    else
+      arg_error = true;
+  }
+  if ( arg_error || num_points < 1 )  {
+    std::cout <<
+      "Usage: -plugin DD4hep_Geant4FieldBenchmark -arg [-arg]                 \n"
+      "     -points    <number>   Number of field evaluations.                \n"
+      "     -box  <dx> <dy> <dz>  Half lengths of the sampled volume.         \n"
+      "                           Default: 1*m 1*m 1*m                        \n"
+      "\tArguments given: " << arguments(argc,argv) << std::endl << std::flush;
+    ::exit(EINVAL);
+  }
+  OverlayedField field = description.field();
+  if ( !field.isValid() )  {
+    except("Geant4FieldBenchmark","+++ The detector description has no field.");
+  }
+  Geant4Field g4field(field);
+
+  // Random points in Geant4 units
+  std::mt19937 generator(12345);
+  std::uniform_real_distribution<double> flat(-1e0, 1e0);
+  std::vector<double> points(4*num_points, 0e0);
+  for( std::size_t i = 0; i < num_points; ++i )  {
+    for( int j = 0; j < 3; ++j )
+      points[4*i+j] = flat(generator) * half[j] * CLHEP::mm;
+  }
+  std::vector<double> g4values(3*num_points, 0e0);
+
+  // Warm-up: page in the field data
+  for( std::size_t i = 0; i < std::min(num_points, std::size_t(1000)); ++i )
+    g4field.GetFieldValue(&points[4*i], &g4values[3*i]);
+
+  auto start = std::chrono::high_resolution_clock::now();
+  for( std::size_t i = 0; i < num_points; ++i )
+    g4field.GetFieldValue(&points[4*i], &g4values[3*i]);
+  auto stop = std::chrono::high_resolution_clock::now();
+  double g4_ns = std::chrono::duration<double, std::nano>(stop - start).count();
+
+  // Reference: sum of all magnetic field components in dd4hep units
+  const auto& components = field.data<OverlayedField::Object>()->magnetic_components;
+  std::size_t num_errors = 0, num_nonzero = 0;
+  start = std::chrono::high_resolution_clock::now();
+  for( std::size_t i = 0; i < num_points; ++i )  {
+    const double* g = &g4values[3*i];
+    double pos[3] = { points[4*i]   / CLHEP::mm * dd4hep::mm,
+                      points[4*i+1] / CLHEP::mm * dd4hep::mm,
+                      points[4*i+2] / CLHEP::mm * dd4hep::mm };
+    double b[3]   = { 0e0, 0e0, 0e0 };
+    for( const auto& c : components ) c.value(pos, b);
+    for( int j = 0; j < 3; ++j )  {
+      double expected = b[j] / dd4hep::tesla * CLHEP::tesla;
+      if ( std::abs(g[j] - expected) > 1e-9 * std::max(std::abs(expected), CLHEP::tesla) )  {
+        if ( ++num_errors < 10 )  {
+          printout(ERROR,"Geant4FieldBenchmark","+++ Field mismatch at (%g, %g, %g) mm: B[%d] = %g expected %g tesla",
+                   points[4*i]/CLHEP::mm, points[4*i+1]/CLHEP::mm, points[4*i+2]/CLHEP::mm,
+                   j, g[j]/CLHEP::tesla, expected/CLHEP::tesla);
+        }
+        break;
+      }
+    }
+    if ( g[0] != 0e0 || g[1] != 0e0 || g[2] != 0e0 ) ++num_nonzero;
+  }
+  stop = std::chrono::high_resolution_clock::now();
+  double dd_ns = std::chrono::duration<double, std::nano>(stop - start).count();
+
+  double num = double(num_points);
+  printout(ALWAYS,"Geant4FieldBenchmark","+++ %ld field evaluations in [%g, %g, %g] mm. %ld with non-zero field.",
+           long(num_points), half[0], half[1], half[2], long(num_nonzero));
+  printout(ALWAYS,"Geant4FieldBenchmark","+++ Geant4Field::GetFieldValue:  %9.1f ns/call  %9.3f Mcalls/sec",
+           g4_ns/num, 1e3*num/g4_ns);
+  printout(ALWAYS,"Geant4FieldBenchmark","+++ Sum of %2ld components:       %9.1f ns/call",
+           long(components.size()), dd_ns/num);
+  if ( num_errors == 0 && num_nonzero > 0 )  {
+    printout(ALWAYS,"Geant4FieldBenchmark","+++ Field benchmark Test PASSED");
+    return 1;
+  }
+  printout(ERROR,"Geant4FieldBenchmark","+++ Field benchmark Test FAILED: %ld mismatches, %ld non-zero values.",
+           long(num_errors), long(num_nonzero));
+  return 0;
+}
+DECLARE_APPLY(DD4hep_Geant4FieldBenchmark,geant4_field_benchmark)
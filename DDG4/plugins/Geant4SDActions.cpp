@@ -18,6 +18,11 @@
 #include "G4OpticalPhoton.hh"
 #include "G4VProcess.hh"
 
+// C/C++ include files
+#include <cmath>
+#include <map>
+#include <algorithm>
+
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -205,6 +210,142 @@ namespace dd4hep {
     }
     typedef Geant4SensitiveAction<Geant4OpticalTracker> Geant4OpticalTrackerAction;
 
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    //               Compaction of calorimeter hit contributions
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    /// Policy to bound the number of monte carlo contributions of calorimeter hits
+    /**
+     *  Without compaction every step adds one contribution to the hit.
+     *  Dense showers then create hits with very many contributions.
+     *
+     *  Properties of the sensitive actions using the policy:
+     *  - ContributionCompaction:  "All"   Keep every contribution (default).
+     *                             "Track" Merge the contributions of the same track.
+     *                             "Time"  Merge the contributions within the same time bin.
+     *                             "TopN"  Keep the MaxContributions contributions with
+     *                                     the largest deposit. Smaller deposits are merged
+     *                                     into the largest contribution.
+     *  - ContributionTimeBin:     Width of the time bins for the "Time" mode.
+     *  - MaxContributions:        Maximal number of contributions for the "TopN" mode.
+     *
+     *  Merged contributions sum the deposit and the step length, keep the earliest
+     *  time and the deposit weighted position. The total energy of the contributions
+     *  is preserved. The track of the largest deposit is kept when merging time bins.
+     *  The contributions of a track or a time bin are located with an index,
+     *  which is reset at the beginning of each event.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    struct HitCompaction  {
+      typedef Geant4HitData::Contribution  Contribution;
+      typedef Geant4HitData::Contributions Contributions;
+      enum Mode  { KEEP_ALL, MERGE_TRACK, MERGE_TIME, KEEP_TOP_N };
+      /// Index key: hit truth and track identifier or time bin
+      typedef std::pair<const Contributions*, long long> IndexKey;
+
+      /// Property: compaction mode
+      std::string      modeName         { "All" };
+      /// Property: width of the time bins
+      double           timeBin          { 1e0*CLHEP::ns };
+      /// Property: maximal number of contributions per hit for the "TopN" mode
+      int              maxContributions { 10 };
+      /// Decoded compaction mode
+      Mode             mode             { KEEP_ALL };
+      /// Position of the contribution of a track or a time bin within the hit truth
+      std::map<IndexKey, std::size_t> index;
+
+      /// Declare the properties to the sensitive action
+      void declareProperties(Geant4Sensitive* sd)  {
+        sd->declareProperty("ContributionCompaction", modeName);
+        sd->declareProperty("ContributionTimeBin",    timeBin);
+        sd->declareProperty("MaxContributions",       maxContributions);
+      }
+      /// Decode the property values
+      void configure(Geant4Sensitive* sd)  {
+        index.clear();
+        if ( modeName.empty() || modeName == "All" )
+          mode = KEEP_ALL;
+        else if ( modeName == "Track" )
+          mode = MERGE_TRACK;
+        else if ( modeName == "Time" && timeBin > 0e0 )
+          mode = MERGE_TIME;
+        else if ( modeName == "TopN" && maxContributions > 0 )
+          mode = KEEP_TOP_N;
+        else
+          sd->except("+++ Invalid ContributionCompaction: '%s' [TimeBin:%g MaxContributions:%d]",
+                     modeName.c_str(), timeBin, maxContributions);
+      }
+      /// Merge the contribution c into the contribution into
+      static void merge(Contribution& into, const Contribution& c)  {
+        double depo = into.deposit + c.deposit;
+        if ( depo > 0e0 )  {
+          double w1 = into.deposit/depo, w2 = c.deposit/depo;
+          into.setPosition(w1*into.x + w2*c.x, w1*into.y + w2*c.y, w1*into.z + w2*c.z);
+        }
+        into.time     = std::min(into.time, c.time);
+        into.length  += c.length;
+        into.deposit  = depo;
+      }
+      /// Add a new contribution to the hit truth according to the compaction mode
+      void add(Contributions& truth, const Contribution& c)  {
+        switch(mode)  {
+        case MERGE_TRACK:  {
+          auto ret = index.emplace(IndexKey(&truth, c.trackID), truth.size());
+          if ( !ret.second )  {
+            merge(truth[ret.first->second], c);
+            return;
+          }
+          break;
+        }
+        case MERGE_TIME:  {
+          // Bin of the merged contribution does not change: time = min(time)
+          long long bin = (long long)std::floor(c.time/timeBin);
+          auto ret = index.emplace(IndexKey(&truth, bin), truth.size());
+          if ( !ret.second )  {
+            Contribution& i = truth[ret.first->second];
+            if ( c.deposit > i.deposit )  {
+              i.trackID = c.trackID;
+              i.pdgID   = c.pdgID;
+              i.setMomentum(c.px, c.py, c.pz);
+            }
+            merge(i, c);
+            return;
+          }
+          break;
+        }
+        case KEEP_TOP_N:
+          if ( truth.size() >= std::size_t(maxContributions) )  {
+            auto smallest = truth.begin(), largest = truth.begin();
+            for( auto i = truth.begin(); i != truth.end(); ++i )  {
+              if ( i->deposit < smallest->deposit ) smallest = i;
+              if ( i->deposit > largest->deposit  ) largest  = i;
+            }
+            if ( c.deposit <= smallest->deposit )  {
+              merge(*largest, c);
+            }
+            else if ( smallest == largest )  {
+              Contribution small = *smallest;
+              *smallest = c;
+              merge(*smallest, small);
+            }
+            else  {
+              merge(*largest, *smallest);
+              *smallest = c;
+            }
+            return;
+          }
+          break;
+        case KEEP_ALL:
+        default:
+          break;
+        }
+        truth.emplace_back(c);
+      }
+    };
+
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     //               Geant4SensitiveAction<Calorimeter>
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -218,14 +359,31 @@ namespace dd4hep {
      *
      * @}
      */
+    /// Helper class to define properties of calorimeters
+    struct Geant4StandardCalorimeter : public Geant4Calorimeter  {
+      /// Compaction policy of the hit contributions
+      HitCompaction compaction;
+    };
+
+    /// Initialization overload for specialization
+    template <> void Geant4SensitiveAction<Geant4StandardCalorimeter>::initialize() {
+      m_userData.compaction.declareProperties(this);
+    }
+
+    /// G4VSensitiveDetector interface: Method invoked at the begining of each event.
+    template <> void Geant4SensitiveAction<Geant4StandardCalorimeter>::begin(G4HCofThisEvent* hce)  {
+      Geant4Sensitive::begin(hce);
+      m_userData.compaction.configure(this);
+    }
+
     /// Define collections created by this sensitivie action object
-    template <> void Geant4SensitiveAction<Geant4Calorimeter>::defineCollections() {
+    template <> void Geant4SensitiveAction<Geant4StandardCalorimeter>::defineCollections() {
       m_collectionID = declareReadoutFilteredCollection<Geant4Calorimeter::Hit>();
     }
 
     /// Method for generating hit(s) using the information of G4Step object.
     template <> bool
-    Geant4SensitiveAction<Geant4Calorimeter>::process(const G4Step* step,G4TouchableHistory*) {
+    Geant4SensitiveAction<Geant4StandardCalorimeter>::process(const G4Step* step,G4TouchableHistory*) {
       typedef Geant4Calorimeter::Hit Hit;
       Geant4StepHandler    h(step);
       HitContribution      contrib = Hit::extractContribution(step);
@@ -267,15 +425,15 @@ namespace dd4hep {
           except("+++ Invalid CELL ID for hit!");
         }
       }
-      hit->truth.emplace_back(contrib);
+      m_userData.compaction.add(hit->truth, contrib);
       hit->energyDeposit += contrib.deposit;
       mark(h.track);
       return true;
     }
     /// GFlash/FastSim interface: Method for generating hit(s) using the information of Geant4FastSimSpot object.
     template <> bool
-    Geant4SensitiveAction<Geant4Calorimeter>::processFastSim(const Geant4FastSimSpot* spot,
-							     G4TouchableHistory* /* hist */)
+    Geant4SensitiveAction<Geant4StandardCalorimeter>::processFastSim(const Geant4FastSimSpot* spot,
+								     G4TouchableHistory* /* hist */)
     {
       typedef Geant4Calorimeter::Hit Hit;
       Geant4FastSimHandler h(spot);
@@ -310,13 +468,13 @@ namespace dd4hep {
           except("+++ Invalid CELL ID for hit!");
         }
       }
-      hit->truth.emplace_back(contrib);
+      m_userData.compaction.add(hit->truth, contrib);
       hit->energyDeposit += contrib.deposit;
       mark(h.track);
       return true;
     }
 
-    typedef Geant4SensitiveAction<Geant4Calorimeter> Geant4CalorimeterAction;
+    typedef Geant4SensitiveAction<Geant4StandardCalorimeter> Geant4CalorimeterAction;
 
     // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
     //               Geant4SensitiveAction<OpticalCalorimeter>
@@ -335,7 +493,21 @@ namespace dd4hep {
      * @}
      */
     /// Helper class to define properties of optical calorimeters. UNTESTED
-    struct Geant4OpticalCalorimeter {};
+    struct Geant4OpticalCalorimeter  {
+      /// Compaction policy of the hit contributions
+      HitCompaction compaction;
+    };
+
+    /// Initialization overload for specialization
+    template <> void Geant4SensitiveAction<Geant4OpticalCalorimeter>::initialize() {
+      m_userData.compaction.declareProperties(this);
+    }
+
+    /// G4VSensitiveDetector interface: Method invoked at the begining of each event.
+    template <> void Geant4SensitiveAction<Geant4OpticalCalorimeter>::begin(G4HCofThisEvent* hce)  {
+      Geant4Sensitive::begin(hce);
+      m_userData.compaction.configure(this);
+    }
 
     /// Define collections created by this sensitivie action object
     template <> void Geant4SensitiveAction<Geant4OpticalCalorimeter>::defineCollections() {
@@ -370,7 +542,7 @@ namespace dd4hep {
           }
         }
         hit->energyDeposit += contrib.deposit;
-        hit->truth.emplace_back(contrib);
+        m_userData.compaction.add(hit->truth, contrib);
         track->SetTrackStatus(fStopAndKill); // don't step photon any further
         mark(h.track);
         return true;
@@ -406,7 +578,7 @@ namespace dd4hep {
           }
         }
         hit->energyDeposit += contrib.deposit;
-        hit->truth.emplace_back(contrib);
+        m_userData.compaction.add(hit->truth, contrib);
         mark(h.track);
         return true;
       }
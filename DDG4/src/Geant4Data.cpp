@@ -28,6 +28,58 @@ using namespace std;
 using namespace dd4hep;
 using namespace dd4hep::sim;
 
+namespace {
+  /// Maximal number of memory blocks kept per thread and hit type for re-use
+  constexpr std::size_t HIT_POOL_MAX = 16384;
+
+  /// Thread local cache of memory blocks of deleted hits
+  /** Hits are created for every event and deleted in bulk at the end of
+   *  the event (or after the output). Re-using the memory blocks avoids the
+   *  heap traffic. Blocks released by another thread than the allocating
+   *  thread simply migrate to this thread.
+   */
+  template <typename HIT> struct HitPool  {
+    /// Flag to protect against hit deletion after the thread's pool is gone
+    static thread_local bool dead;
+    std::vector<void*> blocks;
+    HitPool()  {  blocks.reserve(1024);  }
+    ~HitPool()  {
+      dead = true;
+      for( void* b : blocks ) ::operator delete(b);
+    }
+    static std::vector<void*>& instance()  {
+      static thread_local HitPool pool;
+      return pool.blocks;
+    }
+    /// Pooled allocation. Sub-classes with a different size use the heap
+    static void* allocate(std::size_t size)  {
+      if ( size == sizeof(HIT) && !dead )  {
+        auto& b = instance();
+        if ( !b.empty() )  {
+          void* ptr = b.back();
+          b.pop_back();
+          return ptr;
+        }
+      }
+      return ::operator new(size);
+    }
+    /// Pooled deallocation
+    static void release(void* ptr, std::size_t size)  {
+      if ( ptr )  {
+        if ( size == sizeof(HIT) && !dead )  {
+          auto& b = instance();
+          if ( b.size() < HIT_POOL_MAX )  {
+            b.emplace_back(ptr);
+            return;
+          }
+        }
+        ::operator delete(ptr);
+      }
+    }
+  };
+  template <typename HIT> thread_local bool HitPool<HIT>::dead = false;
+}
+
 /// Default constructor
 SimpleRun::SimpleRun()
   : runID(-1), numEvents(0) {
@@ -135,6 +187,16 @@ Geant4Tracker::Hit::~Hit() {
   InstanceCount::decrement(this);
 }
 
+/// Pooled allocation: memory of deleted hits is recycled by the deleting thread
+void* Geant4Tracker::Hit::operator new(std::size_t size)   {
+  return HitPool<Geant4Tracker::Hit>::allocate(size);
+}
+
+/// Pooled deallocation: keep the memory block for the next hit
+void Geant4Tracker::Hit::operator delete(void* ptr, std::size_t size)   {
+  HitPool<Geant4Tracker::Hit>::release(ptr, size);
+}
+
 /// Explicit assignment operation
 void Geant4Tracker::Hit::copyFrom(const Hit& c) {
   if ( &c != this )  {
@@ -216,3 +278,13 @@ Geant4Calorimeter::Hit::Hit(const Position& pos)
 Geant4Calorimeter::Hit::~Hit() {
   InstanceCount::decrement(this);
 }
+
+/// Pooled allocation: memory of deleted hits is recycled by the deleting thread
+void* Geant4Calorimeter::Hit::operator new(std::size_t size)   {
+  return HitPool<Geant4Calorimeter::Hit>::allocate(size);
+}
+
+/// Pooled deallocation: keep the memory block for the next hit
+void Geant4Calorimeter::Hit::operator delete(void* ptr, std::size_t size)   {
+  HitPool<Geant4Calorimeter::Hit>::release(ptr, size);
+}
@@ -17,13 +17,144 @@
 
 // Geant4 include files
 #include "G4VPhysicalVolume.hh"
+#include "G4VTouchable.hh"
 
 // C/C++ include files
+#include <atomic>
 #include <stdexcept>
 
 using namespace std;
 using namespace dd4hep::sim;
 
+namespace {
+  typedef Geant4GeometryInfo::PlacementIndex PlacementIndex;
+  /// Per-thread cache of the last successful index lookup
+  struct LastPlacementHit  {
+    const PlacementIndex*        index { nullptr };
+    const PlacementIndex::Entry* entry { nullptr };
+    std::size_t                  generation { 0UL };
+  };
+  thread_local LastPlacementHit s_lastHit;
+  std::atomic<std::size_t>      s_indexGeneration { 0UL };
+
+  /// Final avalanche of the rolling hash (fmix64 of MurmurHash3)
+  inline std::size_t finalize_hash(std::size_t h, std::size_t depth)   {
+    h ^= depth;
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+    return h;
+  }
+
+  /// Check if the touchable history matches the placement path
+  inline bool match_path(const G4VTouchable* touchable, int depth, const Geant4GeometryInfo::Geant4PlacementPath& path)  {
+    if ( std::size_t(depth) != path.size() )
+      return false;
+    for ( int i = 0; i < depth; ++i )   {
+      if ( touchable->GetVolume(i) != path[i] )
+        return false;
+    }
+    return true;
+  }
+}
+
+/// Compute the path hash from a placement path
+std::size_t PlacementIndex::hash(const Geant4PlacementPath& path)   {
+  std::size_t h = hash_seed();
+  for ( const auto* pv : path )
+    h = hash_level(h, pv);
+  return finalize_hash(h, path.size());
+}
+
+/// Compute the path hash from a touchable object
+std::size_t PlacementIndex::hash(const G4VTouchable* touchable)   {
+  std::size_t h = hash_seed();
+  int depth = touchable->GetHistoryDepth();
+  for ( int i = 0; i < depth; ++i )
+    h = hash_level(h, touchable->GetVolume(i));
+  return finalize_hash(h, depth);
+}
+
+/// (Re-)build the index from the placement path map
+void PlacementIndex::build(const std::map<Geant4PlacementPath, Placement>& paths)   {
+  std::size_t capacity = 16;
+  while ( capacity < 2*paths.size() ) capacity <<= 1;
+  m_table.clear();
+  m_table.resize(capacity);
+  m_mask = capacity - 1;
+  m_generation = ++s_indexGeneration;
+  for ( const auto& p : paths )   {
+    std::size_t h = hash(p.first);
+    for ( std::size_t slot = h & m_mask; ; slot = (slot + 1) & m_mask )   {
+      Entry& e = m_table[slot];
+      if ( !e.path )  {
+        e.hash  = h;
+        e.path  = &p.first;
+        e.value = &p.second;
+        break;
+      }
+    }
+  }
+}
+
+/// Clear the index content
+void PlacementIndex::clear()   {
+  m_table.clear();
+  m_mask = 0;
+  m_generation = ++s_indexGeneration;
+}
+
+/// Number of occupied slots
+std::size_t PlacementIndex::size()  const   {
+  std::size_t count = 0;
+  for ( const auto& e : m_table )
+    count += e.path ? 1 : 0;
+  return count;
+}
+
+/// Lookup by placement path. Returns null if the path is not indexed
+const PlacementIndex::Entry* PlacementIndex::find(const Geant4PlacementPath& path)  const   {
+  if ( !m_table.empty() )   {
+    std::size_t h = hash(path);
+    for ( std::size_t slot = h & m_mask; ; slot = (slot + 1) & m_mask )   {
+      const Entry& e = m_table[slot];
+      if ( !e.path )
+        return nullptr;
+      else if ( e.hash == h && *e.path == path )
+        return &e;
+    }
+  }
+  return nullptr;
+}
+
+/// Lookup by touchable object. Returns null if the touchable history is not indexed
+const PlacementIndex::Entry* PlacementIndex::find(const G4VTouchable* touchable)  const   {
+  if ( !m_table.empty() )   {
+    int depth = touchable->GetHistoryDepth();
+    LastPlacementHit& last = s_lastHit;
+    /// Consecutive steps are mostly in the same cell: check the last hit first
+    if ( last.index == this && last.generation == m_generation &&
+         match_path(touchable, depth, *last.entry->path) )
+      return last.entry;
+
+    std::size_t h = hash(touchable);
+    for ( std::size_t slot = h & m_mask; ; slot = (slot + 1) & m_mask )   {
+      const Entry& e = m_table[slot];
+      if ( !e.path )
+        return nullptr;
+      else if ( e.hash == h && match_path(touchable, depth, *e.path) )  {
+        last.index = this;
+        last.entry = &e;
+        last.generation = m_generation;
+        return &e;
+      }
+    }
+  }
+  return nullptr;
+}
+
 
 string Geant4GeometryInfo::placementPath(const Geant4PlacementPath& path, bool reverse)   {
   string path_name;
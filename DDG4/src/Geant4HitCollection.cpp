@@ -22,6 +22,84 @@ using namespace dd4hep::sim;
 
 G4ThreadLocal G4Allocator<Geant4HitWrapper>* HitWrapperAllocator = 0;
 
+namespace {
+  /// Maximal number of recycled containers kept per thread
+  constexpr std::size_t HIT_STORAGE_POOL_MAX = 64;
+  /// Flag to protect against recycling after the thread's pool is gone
+  thread_local bool     hit_storage_pool_dead = false;
+
+  /// Thread local cache of the containers of deleted hit collections
+  /** Hit collections are created and deleted for every event.
+   *  Re-using the hit vectors and the key index tables of the previous
+   *  event avoids the heap traffic after the first events.
+   */
+  struct HitStoragePool  {
+    std::vector<Geant4HitCollection::WrappedHits> hits;
+    std::vector<Geant4HitCollection::Keys::Table> keys;
+    ~HitStoragePool()  {
+      hit_storage_pool_dead = true;
+    }
+  };
+  HitStoragePool& hit_storage_pool()  {
+    static thread_local HitStoragePool pool;
+    return pool;
+  }
+}
+
+constexpr size_t Geant4HitCollection::KeyIndex::npos;
+
+/// Remove all entries. The table is kept for re-use
+void Geant4HitCollection::KeyIndex::clear()   {
+  if ( m_size > 0 )  {
+    for( Entry& e : m_table ) e.index = npos;
+    m_size = 0;
+  }
+}
+
+/// Re-hash all entries into a table of the given size
+void Geant4HitCollection::KeyIndex::rehash(size_t new_size)   {
+  Table old(new_size, Entry{0, npos});
+  m_table.swap(old);
+  const size_t mask = new_size-1;
+  for( const Entry& e : old )  {
+    if ( e.index != npos )  {
+      size_t i = hash(e.key) & mask;
+      while ( m_table[i].index != npos ) i = (i+1) & mask;
+      m_table[i] = e;
+    }
+  }
+}
+
+/// Insert key if not present. Returns false if the key is already present
+bool Geant4HitCollection::KeyIndex::insert(VolumeID key, size_t index)   {
+  if ( 2*(m_size+1) > m_table.size() )  {
+    rehash(m_table.empty() ? 64 : 2*m_table.size());
+  }
+  const size_t mask = m_table.size()-1;
+  size_t i = hash(key) & mask;
+  for( ; m_table[i].index != npos; i = (i+1) & mask )  {
+    if ( m_table[i].key == key ) return false;
+  }
+  m_table[i] = Entry{key, index};
+  ++m_size;
+  return true;
+}
+
+/// Hand the table over to the caller. Used to recycle the memory
+Geant4HitCollection::KeyIndex::Table Geant4HitCollection::KeyIndex::detach()   {
+  clear();
+  Table table;
+  table.swap(m_table);
+  return table;
+}
+
+/// Adopt a recycled table
+void Geant4HitCollection::KeyIndex::adopt(Table&& table)   {
+  // Detached tables are cleared: no need to reset the slots
+  m_table = std::move(table);
+  m_size  = 0;
+}
+
 Geant4HitWrapper::InvalidHit::~InvalidHit() {
 }
 
@@ -81,6 +159,16 @@ Geant4HitCollection::Compare::~Compare()  {
 Geant4HitCollection::~Geant4HitCollection() {
   m_hits.clear();
   m_keys.clear();
+  // Bulk release: hand the containers to the next collection of this thread
+  if ( !hit_storage_pool_dead )  {
+    HitStoragePool& pool = hit_storage_pool();
+    if ( m_hits.capacity() > 0 && pool.hits.size() < HIT_STORAGE_POOL_MAX )
+      pool.hits.emplace_back(std::move(m_hits));
+    if ( pool.keys.size() < HIT_STORAGE_POOL_MAX )  {
+      Keys::Table table = m_keys.detach();
+      if ( !table.empty() ) pool.keys.emplace_back(std::move(table));
+    }
+  }
   InstanceCount::decrement(this);
 }
 
@@ -97,6 +185,18 @@ const ComponentCast& Geant4HitCollection::vector_type() const {
 /// Notification to increase the instance counter
 void Geant4HitCollection::newInstance() {
   InstanceCount::increment(this);
+  // Re-use the containers of the collections of previous events
+  if ( !hit_storage_pool_dead )  {
+    HitStoragePool& pool = hit_storage_pool();
+    if ( !pool.hits.empty() )  {
+      m_hits = std::move(pool.hits.back());
+      pool.hits.pop_back();
+    }
+    if ( !pool.keys.empty() )  {
+      m_keys.adopt(std::move(pool.keys.back()));
+      pool.keys.pop_back();
+    }
+  }
 }
 
 /// Clear the collection (Deletes all valid references to real hits)
@@ -124,10 +224,10 @@ void* Geant4HitCollection::findHit(const Compare& cmp)  {
 
 /// Find hit in a collection by comparison of the key
 Geant4HitWrapper* Geant4HitCollection::findHitByKey(VolumeID key)   {
-  Keys::const_iterator i=m_keys.find(key);
-  if ( i == m_keys.end() ) return 0;
-  m_lastHit = (*i).second;
-  return &m_hits.at(m_lastHit);
+  size_t idx = m_keys.find(key);
+  if ( idx == Keys::npos ) return 0;
+  m_lastHit = idx;
+  return &m_hits[idx];
 }
 
 /// Release all hits from the Geant4 container and pass ownership to the caller
@@ -92,6 +92,7 @@ void Geant4Output2ROOT::beginRun(const G4Run* run) {
     if ( idx != string::npos )
       fname += m_output.substr(idx);
   }
+  fname = threadOutputName(fname);
   if ( !m_file && !fname.empty() ) {
     TDirectory::TContext ctxt(TDirectory::CurrentDirectory());
     m_file = TFile::Open(fname.c_str(), "RECREATE", "dd4hep Simulation data");
@@ -104,6 +105,15 @@ void Geant4Output2ROOT::beginRun(const G4Run* run) {
   Geant4OutputAction::beginRun(run);
 }
 
+/// Callback to close the worker output files at the end of the run
+void Geant4Output2ROOT::endRun(const G4Run* run) {
+  Geant4OutputAction::endRun(run);
+  /// Worker files are merged by the master at terminate: they must be complete by then
+  if ( m_threadFilesUsed )  {
+    closeOutput();
+  }
+}
+
 /// Fill single EVENT branch entry (Geant4 collection data)
 int Geant4Output2ROOT::fill(const string& nam, const ComponentCast& type, void* ptr) {
   if (m_file) {
@@ -13,19 +13,88 @@
 
 // Framework include files
 #include "DD4hep/Printout.h"
+#include "DD4hep/Primitives.h"
 #include "DD4hep/InstanceCount.h"
+#include "DDG4/Geant4Kernel.h"
 #include "DDG4/Geant4Particle.h"
 #include "DDG4/Geant4RunAction.h"
 #include "DDG4/Geant4OutputAction.h"
 
 // Geant 4 includes
 #include "G4HCofThisEvent.hh"
+#include "G4Threading.hh"
 #include "G4Event.hh"
 
+// ROOT include files
+#include "TROOT.h"
+#include "TSystem.h"
+#include "TFileMerger.h"
+
+// C/C++ include files
+#include <map>
+#include <mutex>
+#include <utility>
+
 using namespace dd4hep::sim;
 using namespace dd4hep;
 using namespace std;
 
+namespace {
+
+  /// Registry of the output files written by the worker threads
+  class ThreadFileRegistry  {
+  public:
+    /// Worker files of one requested output file
+    struct Target  {
+      /// Merge the worker files at terminate
+      bool merge { true };
+      /// Worker files ordered by (file sequence number, thread identifier)
+      std::map<std::pair<int, int>, std::string> inputs;
+    };
+    /// Lock protecting the registry
+    std::mutex lock;
+    /// Worker files by requested output file name
+    std::map<std::string, Target> files;
+    /// Flag if the merge callback is registered to the master kernel
+    bool registered { false };
+
+    /// Access singleton
+    static ThreadFileRegistry& instance()  {
+      static ThreadFileRegistry reg;
+      return reg;
+    }
+    /// Terminate callback of the master kernel: merge the worker files of all targets
+    void terminate()  {
+      std::lock_guard<std::mutex> guard(lock);
+      for( const auto& f : files )  {
+        if ( f.second.merge ) merge(f.first, f.second.inputs);
+      }
+      files.clear();
+    }
+    /// Merge all worker files of one target in the order of the file sequence and the thread identifiers
+    static void merge(const std::string& target, const std::map<std::pair<int, int>, std::string>& inputs)  {
+      TFileMerger merger(kFALSE, kFALSE);
+      merger.SetFastMethod(kTRUE);
+      merger.SetPrintLevel(0);
+      if ( !merger.OutputFile(target.c_str(), "RECREATE") )  {
+        printout(ERROR, "Geant4OutputAction", "+++ Failed to open merge target %s", target.c_str());
+        return;
+      }
+      for( const auto& i : inputs )
+        merger.AddFile(i.second.c_str(), kFALSE);
+      if ( !merger.Merge() )  {
+        printout(ERROR, "Geant4OutputAction", "+++ Failed to merge %ld worker files into %s",
+                 inputs.size(), target.c_str());
+        return;
+      }
+      for( const auto& i : inputs )
+        gSystem->Unlink(i.second.c_str());
+      printout(INFO, "Geant4OutputAction", "+++ Merged %ld worker files into %s",
+               inputs.size(), target.c_str());
+    }
+  };
+}
+
 /// Standard constructor
 Geant4OutputAction::Geant4OutputAction(Geant4Context* ctxt, const string& nam)
   : Geant4EventAction(ctxt, nam), m_truth(0)
@@ -33,6 +102,8 @@ Geant4OutputAction::Geant4OutputAction(Geant4Context* ctxt, const string& nam)
   InstanceCount::increment(this);
   declareProperty("Output", m_output);
   declareProperty("HandleErrorsAsFatal", m_errorFatal=true);
+  declareProperty("FilesByThread",       m_filesByThread);
+  declareProperty("MergeThreadFiles",    m_mergeThreadFiles);
   // Need to instantiate run action to configure fibers
   ctxt->runAction();
 }
@@ -42,6 +113,40 @@ Geant4OutputAction::~Geant4OutputAction() {
   InstanceCount::decrement(this);
 }
 
+/// Access the output file name for the calling thread
+std::string Geant4OutputAction::threadOutputName(const std::string& fname)   {
+  if ( !m_filesByThread || fname.empty() || !G4Threading::IsWorkerThread() )  {
+    return fname;
+  }
+  int    tid = G4Threading::G4GetThreadId();
+  size_t idx = fname.rfind(".");
+  auto&  reg = ThreadFileRegistry::instance();
+  std::lock_guard<std::mutex> lock(reg.lock);
+  auto&  target = reg.files[fname];
+  /// Worker files of previous runs are closed: a new file gets the next sequence number
+  int    seq = 0;
+  while( target.inputs.find(std::make_pair(seq, tid)) != target.inputs.end() ) ++seq;
+  string out = fname.substr(0, idx) + _toString(tid, ".t%03d");
+  if ( seq > 0 )
+    out += _toString(seq, ".%03d");
+  if ( idx != string::npos )
+    out += fname.substr(idx);
+
+  if ( !m_threadFilesUsed )  {
+    /// Writers in several threads: ROOT must be prepared
+    ROOT::EnableThreadSafety();
+    m_threadFilesUsed = true;
+  }
+  if ( !reg.registered )  {
+    /// The worker files are merged once all runs are done and the workers closed their files
+    context()->kernel().master().register_terminate([&reg] { reg.terminate(); });
+    reg.registered = true;
+  }
+  target.merge = target.merge && m_mergeThreadFiles;
+  target.inputs.emplace(std::make_pair(seq, tid), out);
+  return out;
+}
+
 /// Set or update client for the use in a new thread fiber with seperate action sequences
 void Geant4OutputAction::configureFiber(Geant4Context* thread_ctxt)  {
   Geant4EventAction::configureFiber(thread_ctxt);
@@ -35,10 +35,62 @@ using namespace dd4hep;
 using namespace dd4hep::sim;
 typedef detail::ReferenceBitMask<int> PropertyMask;
 
+namespace {
+  /// Maximal number of memory blocks kept per thread for re-use
+  constexpr std::size_t PARTICLE_POOL_MAX = 16384;
+  /// Flag to protect against particle deletion after the thread's pool is gone
+  thread_local bool     particle_pool_dead = false;
+
+  /// Thread local cache of memory blocks of released particles
+  /** Particles are created and released in large numbers during every event.
+   *  Re-using the memory blocks avoids the heap traffic. Blocks released by
+   *  another thread than the allocating thread simply migrate to this thread.
+   */
+  struct ParticlePool  {
+    std::vector<void*> blocks;
+    ParticlePool()  {  blocks.reserve(1024);  }
+    ~ParticlePool()  {
+      particle_pool_dead = true;
+      for( void* b : blocks ) ::operator delete(b);
+    }
+  };
+  ParticlePool& particle_pool()  {
+    static thread_local ParticlePool pool;
+    return pool;
+  }
+}
+
 /// Default destructor
 ParticleExtension::~ParticleExtension() {
 }
 
+/// Pooled allocation: memory of released particles is recycled by the deleting thread
+void* Geant4Particle::operator new(std::size_t size)   {
+  if ( size == sizeof(Geant4Particle) && !particle_pool_dead )  {
+    auto& blocks = particle_pool().blocks;
+    if ( !blocks.empty() )  {
+      void* ptr = blocks.back();
+      blocks.pop_back();
+      return ptr;
+    }
+  }
+  return ::operator new(size);
+}
+
+/// Pooled deallocation: keep the memory block for the next particle
+void Geant4Particle::operator delete(void* ptr, std::size_t size)   {
+  if ( ptr )  {
+    if ( size == sizeof(Geant4Particle) && !particle_pool_dead )  {
+      auto& blocks = particle_pool().blocks;
+      if ( blocks.size() < PARTICLE_POOL_MAX )  {
+        blocks.emplace_back(ptr);
+        return;
+      }
+    }
+    ::operator delete(ptr);
+  }
+}
+
 /// Default constructor
 Geant4Particle::Geant4Particle() : ref(1)
 {
@@ -37,6 +37,7 @@
 
 // C/C++ include files
 #include <set>
+#include <chrono>
 #include <stdexcept>
 #include <algorithm>
 
@@ -46,6 +47,14 @@ using namespace dd4hep::sim;
 
 typedef detail::ReferenceBitMask<int> PropertyMask;
 
+namespace {
+  typedef std::chrono::high_resolution_clock pass_clock;
+  /// Seconds elapsed since start
+  inline double elapsed(pass_clock::time_point start)   {
+    return std::chrono::duration<double>(pass_clock::now() - start).count();
+  }
+}
+
 /// Standard constructor
 Geant4ParticleHandler::Geant4ParticleHandler(Geant4Context* ctxt, const string& nam)
   : Geant4GeneratorAction(ctxt,nam), Geant4MonteCarloTruth(),
@@ -65,6 +74,11 @@ Geant4ParticleHandler::Geant4ParticleHandler(Geant4Context* ctxt, const string&
   declareProperty("SaveProcesses",         m_processNames);
   declareProperty("MinimalKineticEnergy",  m_kinEnergyCut = 100e0*CLHEP::MeV);
   declareProperty("MinDistToParentVertex", m_minDistToParentVertex = 2.2e-14*CLHEP::mm);//default tolerance for g4ThreeVector isNear
+  declareProperty("TimeRecombineParents",  m_timeRecombine = 0e0);
+  declareProperty("TimeRebaseTracks",      m_timeRebase = 0e0);
+  declareProperty("TimeConsistencyCheck",  m_timeConsistency = 0e0);
+  declareProperty("TimeVertexEndpoint",    m_timeVertexBits = 0e0);
+  declareProperty("TimedEvents",           m_numTimedEvents = 0);
   m_needsControl = true;
 }
 
@@ -80,11 +94,23 @@ Geant4ParticleHandler::Geant4ParticleHandler()
   declareProperty("SaveProcesses",         m_processNames);
   declareProperty("MinimalKineticEnergy",  m_kinEnergyCut = 100e0*CLHEP::MeV);
   declareProperty("MinDistToParentVertex", m_minDistToParentVertex = 2.2e-14*CLHEP::mm);//default tolerance for g4ThreeVector isNear
+  declareProperty("TimeRecombineParents",  m_timeRecombine = 0e0);
+  declareProperty("TimeRebaseTracks",      m_timeRebase = 0e0);
+  declareProperty("TimeConsistencyCheck",  m_timeConsistency = 0e0);
+  declareProperty("TimeVertexEndpoint",    m_timeVertexBits = 0e0);
+  declareProperty("TimedEvents",           m_numTimedEvents = 0);
   m_needsControl = true;
 }
 
 /// Default destructor
 Geant4ParticleHandler::~Geant4ParticleHandler()  {
+  if ( m_numTimedEvents > 0 )  {
+    double num = double(m_numTimedEvents);
+    info("+++ End-of-event timing for %ld events [ms/event]: recombine:%.3f rebase:%.3f "
+         "consistency:%.3f vertex-bits:%.3f", m_numTimedEvents,
+         1e3*m_timeRecombine/num, 1e3*m_timeRebase/num,
+         1e3*m_timeConsistency/num, 1e3*m_timeVertexBits/num);
+  }
   clear();
   detail::releasePtr(m_userHandler);
   InstanceCount::decrement(this);
@@ -439,22 +465,31 @@ void Geant4ParticleHandler::dumpMap(const char* tag)  const  {
 void Geant4ParticleHandler::endEvent(const G4Event* event)  {
   int count = 0;
   int level = outputLevel();
+  auto start = pass_clock::now();
   do {
     if ( level <= VERBOSE ) dumpMap("Particle  ");
     debug("+++ Iteration:%d Tracks:%d Equivalents:%d",++count,m_particleMap.size(),m_equivalentTracks.size());
   } while( recombineParents() > 0 );
+  m_timeRecombine += elapsed(start);
 
   if ( level <= VERBOSE ) dumpMap(  "Recombined");
   // Rebase the simulated tracks, so that they fit to the generator particles
+  start = pass_clock::now();
   rebaseSimulatedTracks(0);
+  m_timeRebase += elapsed(start);
   if ( level <= VERBOSE ) dumpMap(  "Rebased   ");
   // Consistency check....
+  start = pass_clock::now();
   checkConsistency();
+  m_timeConsistency += elapsed(start);
   /// Call the user particle handler
   if ( m_userHandler )  {
     m_userHandler->end(event);
   }
+  start = pass_clock::now();
   setVertexEndpointBit();
+  m_timeVertexBits += elapsed(start);
+  ++m_numTimedEvents;
 
   // Now export the data to the final record.
   Geant4ParticleMap* part_map = context()->event().extension<Geant4ParticleMap>();
@@ -472,12 +507,14 @@ void Geant4ParticleHandler::rebaseSimulatedTracks(int )   {
   int count;
 
   Geant4PrimaryInteraction* interaction = context()->event().extension<Geant4PrimaryInteraction>();
-  ParticleMap& pm = interaction->particles;
+  Geant4PrimaryInteraction::ParticleMap& pm = interaction->particles;
 
   // (1.0) Copy the pre-defined particle mapping for the simulated tracks
   //       It is assumed the mapping is ZERO based without holes.
-  for(count = 0, iend=pm.end(), i=pm.begin(); i!=iend; ++i)  {
-    Particle* p = (*i).second;
+  count = 0;
+  finalParticles.reserve(pm.size() + m_particleMap.size());
+  for( const auto& primary : pm )  {
+    Particle* p = primary.second;
     orgParticles[p->id] = p->id;
     finalParticles[p->id] = p;
     if ( p->id > count ) count = p->id;
@@ -497,17 +534,26 @@ void Geant4ParticleHandler::rebaseSimulatedTracks(int )   {
     }
   }
   // (2) Re-evaluate the corresponding geant4 track equivalents using the new mapping
+  //     Geant4 numbers the tracks in creation order: the equivalent (parent) track
+  //     has a smaller identifier and is resolved first in this ascending sweep.
+  //     Every chain of removed tracks is hence followed only once.
+  m_resolvedTracks.assign(m_equivalentTracks.empty() ? 0 : m_equivalentTracks.rbegin()->first+1, -1);
   for(TrackEquivalents::iterator ie=m_equivalentTracks.begin(),ie_end=m_equivalentTracks.end(); ie!=ie_end; ++ie)  {
     int g4_equiv = (*ie).first;
     while( (ipar=m_particleMap.find(g4_equiv)) == m_particleMap.end() )  {
+      if ( g4_equiv >= 0 && g4_equiv < (*ie).first && m_resolvedTracks[g4_equiv] >= 0 )  {
+        ipar = m_particleMap.find(g4_equiv = m_resolvedTracks[g4_equiv]);
+        break;
+      }
       TrackEquivalents::const_iterator iequiv = m_equivalentTracks.find(g4_equiv);
-      if ( iequiv == ie_end )  {
+      if ( iequiv == ie_end || (*iequiv).second == g4_equiv )  {
         break;  // ERROR !! Will be handled by printout below because ipar==end()
       }
       g4_equiv = (*iequiv).second;
     }
     TrackEquivalents::mapped_type equiv = (*ie).second;
     if ( ipar != m_particleMap.end() )   {
+      m_resolvedTracks[(*ie).first] = g4_equiv;
       Geant4ParticleHandle p = (*ipar).second;
       equivalents[(*ie).first] = p->id;  // requires (1) to be filled properly!
       const G4ParticleDefinition* def = p.definition();
@@ -621,7 +667,8 @@ bool Geant4ParticleHandler::defaultKeepParticle(Particle& particle)   {
 /// Clean the monte carlo record. Remove all unwanted stuff.
 /// This is the core of the object executed at the end of each event action.
 int Geant4ParticleHandler::recombineParents()  {
-  set<int> remove;
+  vector<int>& remove = m_removedTracks;
+  remove.clear();
 
   /// Need to start from BACK, to clean first the latest produced stuff.
   for(ParticleMap::reverse_iterator i=m_particleMap.rbegin(); i!=m_particleMap.rend(); ++i)  {
@@ -672,7 +719,7 @@ int Geant4ParticleHandler::recombineParents()  {
     /// Remove this track from the list and also do the cleanup in the parent's children list
     if ( remove_me )  {
       int g4_id = (*i).first;
-      remove.insert(g4_id);
+      remove.emplace_back(g4_id);
       m_equivalentTracks[g4_id] = p->g4Parent;
       if(ParticleMap::iterator ip = m_particleMap.find(p->g4Parent); ip != m_particleMap.end() )   {
         Particle* parent_part = (*ip).second;
@@ -686,6 +733,8 @@ int Geant4ParticleHandler::recombineParents()  {
       }
     }
   }
+  /// Erase after the sweep: the reverse iterators must not see removed slots.
+  /// Every track is visited once per sweep, hence the list has no duplicates.
   for( int r : remove )  {
     if( auto ir = m_particleMap.find(r); ir != m_particleMap.end() )  {
       (*ir).second->release();
@@ -746,7 +795,10 @@ void Geant4ParticleHandler::setVertexEndpointBit() {
   for( auto& part : m_particleMap )   {
     auto* p = part.second;
     if( !p->parents.empty() )   {
-      Geant4Particle *parent(m_particleMap[ *p->parents.begin() ]);
+      // Do not use operator[]: inserting would invalidate the loop iterators
+      auto ipar = m_particleMap.find(*p->parents.begin());
+      if( ipar == m_particleMap.end() ) continue;
+      Geant4Particle *parent = (*ipar).second;
       const double X( parent->vex - p->vsx );
       const double Y( parent->vey - p->vsy );
       const double Z( parent->vez - p->vsz );
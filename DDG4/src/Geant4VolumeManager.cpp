@@ -79,6 +79,44 @@ namespace {
 	if ( pv.second->IsReplicated() )
 	  m_geo.g4Replicated[pv.second] = pv.first;
       }
+      add_copy_encoders();
+    }
+
+    /// Pre-compute the copy number encoders of parameterised and replicated path levels
+    void add_copy_encoders()   {
+      for( auto& entry : m_geo.g4Paths )   {
+        const auto& path = entry.first;
+        auto& placement  = entry.second;
+        placement.copyEncoders.clear();
+        if ( placement.flags == 0 )
+          continue;
+        for( std::size_t j=0; j < path.size(); ++j )   {
+          const G4VPhysicalVolume* phys = path[j];
+          const Geant4GeometryMaps::G4PlacementMap* placements = nullptr;
+          if ( phys->IsParameterised() )
+            placements = &m_geo.g4Parameterised;
+          else if ( phys->IsReplicated() )
+            placements = &m_geo.g4Replicated;
+          else
+            continue;
+          Geant4GeometryInfo::PlacementCopyEncoder enc { int(j), -1, 0ULL };
+          auto it = placements->find(phys);
+          if ( it != placements->end() )   {
+            const auto* params = (*it).second.data()->params;
+            const auto* field  = params ? params->field : nullptr;
+            if ( field )   {
+              enc.offset = field->offset();
+              enc.mask   = field->mask();
+            }
+          }
+          if ( enc.offset < 0 )   {
+            printout(m_geo.printLevel, "Geant4VolumeManager",
+                     "+++ No volume ID field for copy number of %s in path %s",
+                     phys->GetName().c_str(), Geant4GeometryInfo::placementPath(path).c_str());
+          }
+          placement.copyEncoders.emplace_back(enc);
+        }
+      }
     }
 
     /// Scan a single physical volume and look for sensitive elements below
@@ -173,8 +211,8 @@ namespace {
           if ( m_geo.g4Paths.find(path) == m_geo.g4Paths.end() ) {
 	    Geant4GeometryInfo::PlacementFlags opt;
 	    for(const auto* phys : path)   {
-	      opt.flags.path_has_parametrised = phys->IsParameterised() ? 1 : 0;
-	      opt.flags.path_has_replicated   = phys->IsReplicated()    ? 1 : 0;
+	      opt.flags.path_has_parametrised |= phys->IsParameterised() ? 1 : 0;
+	      opt.flags.path_has_replicated   |= phys->IsReplicated()    ? 1 : 0;
 	    }
 	    opt.flags.parametrised = path.front()->IsParameterised() ? 1 : 0;
 	    opt.flags.replicated   = path.front()->IsReplicated()    ? 1 : 0;
@@ -222,6 +260,7 @@ Geant4VolumeManager::Geant4VolumeManager(const Detector& description, Geant4Geom
   if (info && info->valid && info->g4Paths.empty()) {
     Populator p(description, *info);
     p.populate(description.world());
+    info->g4PathIndex.build(info->g4Paths);
     return;
   }
   throw runtime_error(format("Geant4VolumeManager", "Attempt populate from invalid Geant4 geometry info [Invalid-Info]"));
@@ -267,55 +306,37 @@ VolumeID Geant4VolumeManager::volumeID(const vector<const G4VPhysicalVolume*>& p
 
 /// Access CELLID by Geant4 touchable object
 VolumeID Geant4VolumeManager::volumeID(const G4VTouchable* touchable) const {
-  Geant4TouchableHandler handler(touchable);
-  vector<const G4VPhysicalVolume*> path = handler.placementPath();
-  if (!path.empty() && checkValidity()) {
-    const auto& mapping = ptr()->g4Paths;
-    auto i = mapping.find(path);
-    if ( i != mapping.end() )   {
-      const auto& e = (*i).second;
+  if ( !touchable )   {
+    except("Geant4VolumeManager","Attempt to access invalid G4 touchable object.");
+  }
+  int depth = touchable->GetHistoryDepth();
+  if ( depth > 0 && checkValidity() ) {
+    const auto* entry = ptr()->g4PathIndex.find(touchable);
+    if ( entry )   {
+      const auto& e = *entry->value;
       /// No parametrization or replication.
-      if ( e.flags == 0 )  {
+      if ( e.copyEncoders.empty() )  {
 	return e.volumeID;
       }
+      /// Add the copy numbers of the parameterised/replicated levels with the pre-computed encoders
       VolumeID volid = e.volumeID;
-      const auto& paramterised = ptr()->g4Parameterised;
-      const auto& replicated   = ptr()->g4Replicated;
-      /// This is incredibly slow .... but what can I do ? Need a better idea.
-      for ( std::size_t j=0; j < path.size(); ++j )   {
-	const auto* phys = path[j];
-	if ( phys->IsParameterised() )   {
-	  int copy_no = touchable->GetCopyNumber(j);
-	  const auto it = paramterised.find(phys);
-	  if ( it != paramterised.end() )   {
-	    //printout(INFO,"Geant4VolumeManager",
-	    //         "Copy number:   %ld  <--> %ld", copy_no, long(phys->GetCopyNo()));
-	    const auto* field = (*it).second.data()->params->field;
-	    volid |= IDDescriptor::encode(field, copy_no);
-	    continue;
-	  }
-	  except("Geant4VolumeManager","Error  Geant4VolumeManager::volumeID(const G4VTouchable* touchable)");
-	}
-	else if ( phys->IsReplicated() )    {
-	  int copy_no = touchable->GetCopyNumber(j);
-	  const auto it = replicated.find(phys);
-	  if ( it != replicated.end() )   {
-	    const auto* field = (*it).second.data()->params->field;
-	    volid |= IDDescriptor::encode(field, copy_no);
-	    continue;
-	  }
+      for ( const auto& enc : e.copyEncoders )   {
+	if ( enc.offset < 0 )   {
 	  except("Geant4VolumeManager","Error  Geant4VolumeManager::volumeID(const G4VTouchable* touchable)");
 	}
+	VolumeID copy_no = touchable->GetCopyNumber(enc.depth);
+	volid |= (copy_no << enc.offset) & enc.mask;
       }
       return volid;
     }
-    if (!path[0])
+    const G4VPhysicalVolume* phys = touchable->GetVolume(0);
+    if ( !phys )
       return InvalidPath;
-    else if (!path[0]->GetLogicalVolume()->GetSensitiveDetector())
+    else if ( !phys->GetLogicalVolume()->GetSensitiveDetector() )
       return Insensitive;
   }
   printout(INFO, "Geant4VolumeManager","+++   Bad volume Geant4 Path: %s",
-           Geant4GeometryInfo::placementPath(path).c_str());
+           Geant4GeometryInfo::placementPath(placementPath(touchable)).c_str());
   return NonExisting;
 }
 
@@ -261,6 +261,15 @@ namespace dd4hep  {
        */
       bool findFunction(const std::string& name, int npar)   const;
 
+      /**
+       * Dictionary generation. The counter is incremented with every change
+       * of the dictionary. Clients caching evaluation results use it to
+       * detect that a cached value may be stale.
+       *
+       * @return current generation of the dictionary.
+       */
+      unsigned long generation()  const;
+
       class Object;
 
     private:
@@ -269,6 +269,11 @@ namespace dd4hep  {
        */
       void clear();
 
+      /**
+       * Access the dictionary generation: incremented with every modification.
+       */
+      unsigned long generation() const;
+
       struct Struct;
       
     private:
@@ -9,14 +9,16 @@
 #include <cmath>        // for pow()
 #include <sstream>
 #include <mutex>
-#include <condition_variable>
+#include <atomic>
 #include <cctype>
 #include <cerrno>
 #include <cstring>
 #include <cstdlib>     // for strtod()
 #include <stack>
 #include <string>
-#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <algorithm>
 
 // Disable some diagnostics, which we know, but need to ignore
 #if defined(__GNUC__) && !defined(__APPLE__) && !defined(__llvm__)
@@ -78,50 +80,144 @@ namespace  {
 }
 
 //typedef char * pchar;
-typedef std::unordered_map<std::string,Item> dic_type;
 
-/// Internal expression evaluator helper class
-struct EVAL::Object::Struct {
-  // based on https://stackoverflow.com/a/58018604
-  struct ReadLock {
-    ReadLock(Struct* s): theStruct(s), theLg(s->theLock) { 
-      while(theStruct->theWriterWaiting)
-        theStruct->theCond.wait(theLg);
-      ++theStruct->theReadersWaiting;
+/// Dictionary of variables and functions with a lock-free read path
+/**
+ *  The dictionary is a hash table of immutable buckets. Readers never lock:
+ *  they load the current bucket array and bucket with acquire semantics
+ *  and search the few entries of the bucket.
+ *
+ *  Writers are serialized by the caller. A modification copies the affected
+ *  bucket, applies the change and publishes the new bucket version with a
+ *  release store. When the table grows, a complete new bucket array is
+ *  published. Replaced versions may still be accessed by concurrent readers:
+ *  they are retired and only released together with the dictionary.
+ *  The dictionary is only modified when defining constants and functions,
+ *  hence the retired memory stays small.
+ *
+ *  An evaluation concurrent to a modification sees each dictionary entry
+ *  either before or after the modification.
+ */
+class dic_type  {
+public:
+  typedef std::pair<const std::string, Item> value_type;
+
+private:
+  /// Immutable bucket: entries with the same hash slot
+  struct Bucket  {
+    std::vector<value_type> entries;
+  };
+  /// Bucket array. The array is replaced when the table grows
+  struct Table  {
+    std::size_t mask;
+    std::unique_ptr<std::atomic<const Bucket*>[]> buckets;
+    explicit Table(std::size_t num_buckets)
+      : mask(num_buckets-1), buckets(new std::atomic<const Bucket*>[num_buckets])  {
+      for(std::size_t i=0; i<num_buckets; ++i) buckets[i].store(nullptr, std::memory_order_relaxed);
     }
+  };
 
-    ReadLock(const ReadLock&) = delete;
-    ~ReadLock() {
-      --theStruct->theReadersWaiting;
-      while(theStruct->theReadersWaiting > 0)
-        theStruct->theCond.wait(theLg);
-      theStruct->theCond.notify_one();
+  std::atomic<const Table*>           m_table  { nullptr };
+  /// All bucket versions ever published. Released with the dictionary
+  std::vector<std::unique_ptr<Bucket> > m_buckets;
+  /// All bucket arrays ever published. Released with the dictionary
+  std::vector<std::unique_ptr<Table> >  m_tables;
+  /// Number of entries (writer side only)
+  std::size_t                         m_size   { 0 };
+
+  const Bucket* publish(std::unique_ptr<Bucket>&& bucket)  {
+    m_buckets.emplace_back(std::move(bucket));
+    return m_buckets.back().get();
+  }
+  const Table* grow(const Table* table)  {
+    std::size_t num_buckets = table ? 2*(table->mask+1) : 64;
+    std::unique_ptr<Table> new_table(new Table(num_buckets));
+    if ( table )  {
+      std::vector<std::unique_ptr<Bucket> > slots(num_buckets);
+      for(std::size_t i=0; i<=table->mask; ++i)  {
+        if ( const Bucket* b = table->buckets[i].load(std::memory_order_relaxed) )  {
+          for( const auto& e : b->entries )  {
+            auto& slot = slots[std::hash<std::string>()(e.first) & new_table->mask];
+            if ( !slot ) slot.reset(new Bucket());
+            slot->entries.emplace_back(e);
+          }
+        }
+      }
+      for(std::size_t i=0; i<num_buckets; ++i)  {
+        if ( slots[i] ) new_table->buckets[i].store(publish(std::move(slots[i])), std::memory_order_relaxed);
+      }
     }
-    Struct* theStruct;
-    std::unique_lock<std::mutex> theLg;
+    m_tables.emplace_back(std::move(new_table));
+    m_table.store(m_tables.back().get(), std::memory_order_release);
+    return m_tables.back().get();
+  }
 
-  };
-  struct WriteLock {
-    WriteLock(Struct* s): theStruct(s), theLg(s->theLock) {
-      while(theStruct->theWriterWaiting)
-        theStruct->theCond.wait(theLg);
+public:
+  /// Default constructor
+  dic_type()  {
+    grow(nullptr);
+  }
+  /// Lock-free lookup. The returned item stays valid until the dictionary is destroyed
+  const Item* find(const std::string& name)  const  {
+    const Table*  table  = m_table.load(std::memory_order_acquire);
+    const Bucket* bucket = table->buckets[std::hash<std::string>()(name) & table->mask].load(std::memory_order_acquire);
+    if ( bucket )  {
+      for( const auto& e : bucket->entries )
+        if ( e.first == name ) return &e.second;
+    }
+    return nullptr;
+  }
+  /// Add or replace an entry. Returns true if an existing entry was replaced. Writers only
+  bool set(const std::string& name, const Item& item)  {
+    const Table* table = m_table.load(std::memory_order_relaxed);
+    if ( m_size+1 > table->mask+1 )  {
+      table = grow(table);
     }
-    WriteLock(const WriteLock&) = delete;
-    ~WriteLock() {
-      theStruct->theWriterWaiting = true;
-      while(theStruct->theReadersWaiting > 0)
-        theStruct->theCond.wait(theLg);
-      theStruct->theWriterWaiting = false;
-      theStruct->theCond.notify_all();
+    auto& slot = table->buckets[std::hash<std::string>()(name) & table->mask];
+    const Bucket* old = slot.load(std::memory_order_relaxed);
+    std::unique_ptr<Bucket> bucket(new Bucket());
+    bool replaced = false;
+    if ( old )  {
+      bucket->entries.reserve(old->entries.size()+1);
+      for( const auto& e : old->entries )  {
+        if ( e.first == name )  {
+          bucket->entries.emplace_back(name, item);
+          replaced = true;
+          continue;
+        }
+        bucket->entries.emplace_back(e);
+      }
     }
-    Struct* theStruct;
-    std::unique_lock<std::mutex> theLg;
-  };
+    if ( !replaced )  {
+      bucket->entries.emplace_back(name, item);
+      ++m_size;
+    }
+    slot.store(publish(std::move(bucket)), std::memory_order_release);
+    return replaced;
+  }
+  /// Remove an entry. Writers only
+  void erase(const std::string& name)  {
+    const Table* table = m_table.load(std::memory_order_relaxed);
+    auto& slot = table->buckets[std::hash<std::string>()(name) & table->mask];
+    const Bucket* old = slot.load(std::memory_order_relaxed);
+    if ( old && std::any_of(old->entries.begin(), old->entries.end(),
+                            [&name](const value_type& e) { return e.first == name; }) )  {
+      std::unique_ptr<Bucket> bucket(new Bucket());
+      for( const auto& e : old->entries )
+        if ( e.first != name ) bucket->entries.emplace_back(e);
+      slot.store(publish(std::move(bucket)), std::memory_order_release);
+      --m_size;
+    }
+  }
+};
 
+/// Internal expression evaluator helper class
+struct EVAL::Object::Struct {
+  /// Dictionary of variables and functions. Lock-free for readers
   dic_type    theDictionary;
-  int theReadersWaiting = 0;
-  bool theWriterWaiting = false;
-  std::condition_variable theCond;
+  /// Incremented after every modification of the dictionary
+  std::atomic<unsigned long> theGeneration {0};
+  /// Serializes the writers of the dictionary
   std::mutex  theLock;
 };
 
@@ -163,11 +259,11 @@ static int variable(const std::string & name, double & result,
  *                                                                     *
  ***********************************************************************/
 {
-  dic_type::const_iterator iter = dictionary.find(name);
-  if (iter == dictionary.end())
+  Item const* found = dictionary.find(name);
+  if (found == nullptr)
     return EVAL::ERROR_UNKNOWN_VARIABLE;
   //NOTE: copying ::string not thread safe so must use ref
-  Item const& item = iter->second;
+  Item const& item = *found;
   switch (item.what) {
   case Item::VARIABLE:
     result = item.variable;
@@ -205,10 +301,10 @@ static int execute_function(const std::string & name, std::stack<double> & par,
   int npar = par.size();
   if (npar > MAX_N_PAR) return EVAL::ERROR_UNKNOWN_FUNCTION;
 
-  dic_type::const_iterator iter = dictionary.find(sss[npar]+name);
-  if (iter == dictionary.end()) return EVAL::ERROR_UNKNOWN_FUNCTION;
+  Item const* found = dictionary.find(sss[npar]+name);
+  if (found == nullptr) return EVAL::ERROR_UNKNOWN_FUNCTION;
   //NOTE: copying ::string not thread safe so must use ref
-  Item const& item = iter->second;
+  Item const& item = *found;
 
   double pp[MAX_N_PAR];
   for(int i=0; i<npar; i++) { pp[i] = par.top(); par.pop(); }
@@ -627,17 +723,16 @@ static int setItem(const char * prefix, const char * name,
   //   A D D   I T E M   T O   T H E   D I C T I O N A R Y
 
   std::string item_name = prefix + std::string(pointer,n);
-  EVAL::Object::Struct::WriteLock guard(imp);
-  dic_type::iterator iter = imp->theDictionary.find(item_name);
-  if (iter != imp->theDictionary.end()) {
-    iter->second = item;
+  std::lock_guard<std::mutex> guard(imp->theLock);
+  bool replaced = imp->theDictionary.set(item_name, item);
+  ++imp->theGeneration;
+  if (replaced) {
     if (item_name == name) {
       return EVAL::WARNING_EXISTING_VARIABLE;
     }else{
       return EVAL::WARNING_EXISTING_FUNCTION;
     }
   }
-  imp->theDictionary[item_name] = item;
   return EVAL::OK;
 }
 
@@ -704,7 +799,6 @@ Evaluator::Object::~Object() {
 Evaluator::Object::EvalStatus Evaluator::Object::evaluate(const char * expression) const {
   EvalStatus s;
   if (expression != 0) {
-    Struct::ReadLock guard(imp);
     s.theStatus = engine(expression,
                          expression+strlen(expression)-1,
                          s.theResult,
@@ -747,35 +841,30 @@ int Evaluator::Object::setEnviron(const char* name, const char* value)  {
   std::string prefix = "${";
   std::string item_name = prefix + std::string(name) + std::string("}");
 
-  //Need to take lock before creating Item since since Item to be destroyed
-  // before the lock in order avoid ::string ref count thread problem
-  Struct::WriteLock guard(imp);
   Item item;
   item.what = Item::STRING;
   item.expression = value;
   item.function = 0;
   item.variable = 0;
-  dic_type::iterator iter = imp->theDictionary.find(item_name);
-  if (iter != imp->theDictionary.end()) {
-    iter->second = item;
+  std::lock_guard<std::mutex> guard(imp->theLock);
+  bool replaced = imp->theDictionary.set(item_name, item);
+  ++imp->theGeneration;
+  if (replaced) {
     if (item_name == name) {
       return EVAL::WARNING_EXISTING_VARIABLE;
     }else{
       return EVAL::WARNING_EXISTING_FUNCTION;
     }
-  }else{
-    imp->theDictionary[item_name] = item;
-    return EVAL::OK;
   }
+  return EVAL::OK;
 }
 
 //---------------------------------------------------------------------------
 std::pair<const char*,int> Evaluator::Object::getEnviron(const char* name)  const {
-  Struct::ReadLock guard(imp);
   Struct const* cImp = imp;
-  dic_type::const_iterator iter = cImp->theDictionary.find(name);
-  if (iter != cImp->theDictionary.end()) {
-    return std::make_pair(iter->second.expression.c_str(), EVAL::OK);
+  // The dictionary keeps all item versions alive: the string pointer stays valid
+  if (Item const* item = cImp->theDictionary.find(name)) {
+    return std::make_pair(item->expression.c_str(), EVAL::OK);
   }
   if ( ::strlen(name) > 3 )  {
     // Need to remove braces from ${xxxx} for call to getenv()
@@ -794,21 +883,14 @@ int Evaluator::Object::setVariable(const char * name, double value)  {
 }
 
 int Evaluator::Object::setVariable(const char * name, const char * expression)  {
-  Item item(expression);
-  auto returnValue = setItem("", name, item, imp);
-  {
-    //We need to decrement the ref count on the item.expression while holding
-    // the lock since the ::string was copied into the dictionary
-    Struct::WriteLock guard(imp);
-    item.expression = "";
-  }
-  return returnValue;
+  return setItem("", name, Item(expression), imp);
 }
 
 void Evaluator::Object::setVariableNoLock(const char * name, double value)  {
   std::string item_name = name;
   Item item(value);
-  imp->theDictionary[item_name] = item;
+  imp->theDictionary.set(item_name, item);
+  ++imp->theGeneration;
 }
 
 int Evaluator::Object::setFunction(const char * name,double (*fun)())   {
@@ -838,13 +920,15 @@ int Evaluator::Object::setFunction(const char * name, double (*fun)(double,doubl
 void Evaluator::Object::setFunctionNoLock(const char * name,double (*fun)(double))   {
   std::string item_name = "1"+std::string(name);
   Item item(FCN(fun).ptr);
-  imp->theDictionary[item_name] = item;
+  imp->theDictionary.set(item_name, item);
+  ++imp->theGeneration;
 }
 
 void Evaluator::Object::setFunctionNoLock(const char * name, double (*fun)(double,double))  {
   std::string item_name = "2"+std::string(name);
   Item item(FCN(fun).ptr);
-  imp->theDictionary[item_name] = item;
+  imp->theDictionary.set(item_name, item);
+  ++imp->theGeneration;
 }
 
 
@@ -853,10 +937,7 @@ bool Evaluator::Object::findVariable(const char * name) const {
   if (name == 0 || *name == '\0') return false;
   const char * pointer; int n; REMOVE_BLANKS;
   if (n == 0) return false;
-  Struct::ReadLock guard(imp);
-  return
-    (imp->theDictionary.find(std::string(pointer,n)) == imp->theDictionary.end()) ?
-    false : true;
+  return imp->theDictionary.find(std::string(pointer,n)) != nullptr;
 }
 
 //---------------------------------------------------------------------------
@@ -865,9 +946,7 @@ bool Evaluator::Object::findFunction(const char * name, int npar) const {
   if (npar < 0  || npar > MAX_N_PAR) return false;
   const char * pointer; int n; REMOVE_BLANKS;
   if (n == 0) return false;
-  Struct::ReadLock guard(imp);
-  return (imp->theDictionary.find(sss[npar]+std::string(pointer,n)) ==
-	  imp->theDictionary.end()) ? false : true;
+  return imp->theDictionary.find(sss[npar]+std::string(pointer,n)) != nullptr;
 }
 
 //---------------------------------------------------------------------------
@@ -875,8 +954,9 @@ void Evaluator::Object::removeVariable(const char * name) {
   if (name == 0 || *name == '\0') return;
   const char * pointer; int n; REMOVE_BLANKS;
   if (n == 0) return;
-  Struct::WriteLock guard(imp);
+  std::lock_guard<std::mutex> guard(imp->theLock);
   imp->theDictionary.erase(std::string(pointer,n));
+  ++imp->theGeneration;
 }
 
 //---------------------------------------------------------------------------
@@ -885,8 +965,14 @@ void Evaluator::Object::removeFunction(const char * name, int npar) {
   if (npar < 0  || npar > MAX_N_PAR) return;
   const char * pointer; int n; REMOVE_BLANKS;
   if (n == 0) return;
-  Struct::WriteLock guard(imp);
+  std::lock_guard<std::mutex> guard(imp->theLock);
   imp->theDictionary.erase(sss[npar]+std::string(pointer,n));
+  ++imp->theGeneration;
+}
+
+//---------------------------------------------------------------------------
+unsigned long Evaluator::Object::generation() const {
+  return imp->theGeneration.load(std::memory_order_acquire);
 }
 
 //---------------------------------------------------------------------------
@@ -1029,3 +1115,8 @@ bool Evaluator::findFunction(const std::string& name, int npar) const    {
   ret = object->findFunction(name.c_str(), npar);
   return ret;
 }
+
+//---------------------------------------------------------------------------
+unsigned long Evaluator::generation() const    {
+  return object->generation();
+}
@@ -48,12 +48,10 @@ namespace dd4hep {
     public:
       
       /// The constructor - takes the main description object.
-      CellIDPositionConverter( Detector& description ) : _description( &description )  {
-        _volumeManager = VolumeManager::getVolumeManager(description);
-      }
+      CellIDPositionConverter( Detector& description ) ;
 
       /// Destructor
-      virtual ~CellIDPositionConverter(){} ;
+      virtual ~CellIDPositionConverter() ;
       
       /** Return the nominal global position for a given cellID of a sensitive volume.
        *  No Alignment corrections are applied.
@@ -74,6 +72,14 @@ namespace dd4hep {
        */
       CellID cellID(const Position& global) const;
 
+      /** Return the global cellID for the given global position starting the search
+       *  from the volume of the hint, e.g. the cellID of the previous hit of a track.
+       *  A hint of 0 starts the search at the last volume found by the calling thread.
+       *  Thread-safe: the geometry is navigated with the TGeoNavigator of the calling
+       *  thread. For multi-threaded use TGeoManager::SetMaxThreads must be called before.
+       */
+      CellID cellID(const Position& global, const CellID& hint) const;
+
 
 
       /** Find the context with DetElement, placements etc for a given cellID of a sensitive volume.
@@ -117,8 +123,12 @@ namespace dd4hep {
     std::vector<double> cellDimensions(const CellID& cell) const ;
 
     protected:
+      /// Volume IDs of the placements encoded per readout. Filled on first use
+      struct NodeEncodings ;
+
       VolumeManager _volumeManager{} ;
       const Detector* _description ;
+      NodeEncodings* _encodings{nullptr} ;  //! not persistent
 
     };
 
@@ -14,15 +14,95 @@
 #include "DDRec/CellIDPositionConverter.h"
 
 #include "DD4hep/Detector.h"
+#include "DD4hep/Printout.h"
 #include "DD4hep/detail/VolumeManagerInterna.h"
 
 #include "TGeoManager.h"
+#include "TGeoNavigator.h"
+
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+
+  /// Fill the placement path caches of a detector element tree
+  /** DetElement::placementPath() fills its cache on first access, which
+   *  is not thread safe. The paths used by cellID(global, hint) are
+   *  therefore computed once when the converter is built.
+   */
+  void cachePlacementPaths( const dd4hep::DetElement& de ){
+    if( de.placement().isValid() )
+      de.placementPath() ;
+    for( const auto& c : de.children() )
+      cachePlacementPaths( c.second ) ;
+  }
+}
 
 namespace dd4hep {
   namespace rec {
 
     using std::set;
 
+    /// Volume IDs of the placements encoded per readout
+    /** The encodings are computed once for all placements below the
+     *  subdetectors with a readout, which avoids string paths and
+     *  field lookups by name when computing a cellID from a position.
+     */
+    struct CellIDPositionConverter::NodeEncodings {
+      typedef std::unordered_map<const TGeoNode*, VolumeID> Encodings ;
+      std::once_flag once ;
+      std::map<const IDDescriptorObject*, Encodings> readouts ;
+
+      /// Encode the volIDs of all placements in the volume hierarchy
+      void scan( const IDDescriptor& id, const PlacedVolume& pv, Encodings& enc,
+                 std::unordered_set<const TGeoVolume*>& done ) {
+        const auto& ids = pv.volIDs() ;
+        if( !ids.empty() && enc.find( pv.ptr() ) == enc.end() ){
+          try {
+            enc.emplace( pv.ptr(), id.encode( ids ) ) ;
+          } catch( const std::exception& e ){
+            // Not part of this readout: encoded on the fly
+            printout( DEBUG, "CellIDPositionConverter", "+++ No encoding for %s: %s", pv.name(), e.what() ) ;
+          }
+        }
+        if( done.insert( pv.volume().ptr() ).second ){
+          for( Int_t idau = 0, ndau = pv->GetNdaughters(); idau < ndau; ++idau )
+            scan( id, pv->GetDaughter( idau ), enc, done ) ;
+        }
+      }
+
+      /// Encode the volIDs of all subdetectors with a readout
+      void build( const Detector& description ) {
+        for( const auto& d : description.detectors() ){
+          DetElement det = d.second ;
+          SensitiveDetector sd = description.sensitiveDetector( det.name() ) ;
+          if( !sd.isValid() || !sd.readout().isValid() || !det.placement().isValid() )
+            continue ;
+          IDDescriptor id = sd.readout().idSpec() ;
+          std::unordered_set<const TGeoVolume*> done ;
+          scan( id, det.placement(), readouts[ id.ptr() ], done ) ;
+        }
+      }
+
+      /// Access the encoding table of a readout. Null if not known
+      const Encodings* encodings( const IDDescriptor& id ) const {
+        auto i = readouts.find( id.ptr() ) ;
+        return i == readouts.end() ? nullptr : &i->second ;
+      }
+    };
+
+    CellIDPositionConverter::CellIDPositionConverter( Detector& description )
+      : _description( &description ), _encodings( new NodeEncodings )  {
+      _volumeManager = VolumeManager::getVolumeManager(description);
+      cachePlacementPaths( description.world() ) ;
+    }
+
+    CellIDPositionConverter::~CellIDPositionConverter()  {
+      detail::deletePtr( _encodings ) ;
+    }
+
     const VolumeManagerContext*
     CellIDPositionConverter::findContext(const CellID& cellID) const {
       return _volumeManager.lookupContext( cellID ) ;
@@ -38,90 +118,92 @@ namespace dd4hep {
 
     Position CellIDPositionConverter::positionNominal(const CellID& cell) const {
 
-      double l[3], e[3], g[3];
-
       const VolumeManagerContext* context = findContext( cell ) ;
 
       if( context == NULL)
 	return Position() ;
 
-      DetElement det = context->element ;
-      
-
-#if 0  // this uses the deprecated VolumeManagerContext::placement
-      
-      PlacedVolume pv = context->placement ;
-
-      if( ! pv.volume().isSensitive() )
-	return Position() ;
-	
-      SensitiveDetector sd = pv.volume().sensitiveDetector();
-      Readout r = sd.readout() ;
-
-#else
+      // the segmentation and the volume to world transformation are cached in the context
+      Segmentation seg = context->segmentation ;
 
-      // use a recursive search for the Readout
-      
-      Readout r = findReadout( det ) ;
+      // not cached (e.g. geometry read from file): use a recursive search for the Readout
+      if( !seg.isValid() )
+	seg = findReadout( context->element ).segmentation() ;
 
-#endif
-
-      Segmentation seg = r.segmentation() ;
       Position local = seg.position(cell);
       
-      local.GetCoordinates(l);
+      return context->localToWorld( local ) ;
+    }
 
-      const TGeoMatrix& volToElement = context->toElement();
-      volToElement.LocalToMaster(l, e);
 
-      const TGeoMatrix& elementToGlobal = det.nominal().worldTransformation();
-      elementToGlobal.LocalToMaster(e, g);
 
 
-      return Position(g[0], g[1], g[2]);
+    CellID CellIDPositionConverter::cellID(const Position& global) const {
+      return cellID( global, 0 ) ;
     }
 
+    CellID CellIDPositionConverter::cellID(const Position& global, const CellID& hint) const {
 
-
-
-    CellID CellIDPositionConverter::cellID(const Position& global) const {
+      /// Cell found by the last call of this thread: the navigator is still positioned there
+      static thread_local std::pair<const TGeoNavigator*, CellID> lastCell { nullptr, 0 } ;
 
       CellID result(0) ;
-      
+
       TGeoManager *geoManager = _description->world().volume()->GetGeoManager() ;
-      
-      PlacedVolume pv = geoManager->FindNode( global.x() , global.y() , global.z() ) ;
-      
+      TGeoNavigator* nav = geoManager->GetCurrentNavigator() ;
+      if( !nav )
+        nav = geoManager->AddNavigator() ;
+
+      // position the navigator at the volume of the hint unless it is still there
+      if( hint != 0 && ( lastCell.first != nav || lastCell.second != hint ) ){
+        const VolumeManagerContext* context = nullptr ;
+        try {
+          context = findContext( hint ) ;
+        } catch( const std::exception& ) {
+          // Unknown hint: search from the current navigator state
+        }
+        if( !context || !nav->cd( context->element.placementPath().c_str() ) )
+          nav->CdTop() ;
+      }
+      lastCell.first = nullptr ;
+
+      // the search starts at the current state of the navigator and moves up as required
+      PlacedVolume pv = nav->FindNode( global.x() , global.y() , global.z() ) ;
+
       if(  pv.isValid() && pv.volume().isSensitive() ) {
 
-	TGeoHMatrix*  m = geoManager->GetCurrentMatrix() ;
-      
 	double g[3], l[3] ;
 	global.GetCoordinates( g ) ;
-	m->MasterToLocal( g, l );
+	nav->GetCurrentMatrix()->MasterToLocal( g, l );
 
 	SensitiveDetector sd = pv.volume().sensitiveDetector();
 	Readout r = sd.readout() ;
-	
-	// collect all volIDs for the current path
-	PlacedVolume::VolIDs volIDs ;
-	volIDs.insert( std::end(volIDs), std::begin(pv.volIDs()), std::end(pv.volIDs())) ;
-
-	TGeoPhysicalNode pN( geoManager->GetPath() ) ; 
-	
-	unsigned motherCount = 0 ;
-
-	while( pN.GetMother( motherCount ) != NULL   ){
-
-	    PlacedVolume mPv = pN.GetMother( motherCount++ ) ;
-	    
-	    if( mPv.isValid() &&  pN.GetMother( motherCount ) != NULL )  // world has no volIDs
-	      volIDs.insert( std::end(volIDs), std::begin(mPv.volIDs()), std::end(mPv.volIDs())) ;
+	IDDescriptor idSpec = r.idSpec() ;
+
+	if( _encodings )
+	  std::call_once( _encodings->once, [this]() { _encodings->build( *_description ) ; } ) ;
+	const NodeEncodings::Encodings* enc = _encodings ? _encodings->encodings( idSpec ) : nullptr ;
+
+	// collect the volIDs of all placements in the current branch. The world has no volIDs
+	VolumeID volIDPVs = 0 ;
+	for( Int_t level = nav->GetLevel(), up = 0 ; up < level ; ++up ){
+	  PlacedVolume mPv = nav->GetMother( up ) ;
+	  const auto& ids = mPv.volIDs() ;
+	  if( ids.empty() )
+	    continue ;
+	  if( enc ){
+	    auto i = enc->find( mPv.ptr() ) ;
+	    if( i != enc->end() ){
+	      volIDPVs |= i->second ;
+	      continue ;
+	    }
+	  }
+	  volIDPVs |= idSpec.encode( ids ) ;
 	}
-	
-	VolumeID volIDPVs = r.idSpec().encode( volIDs ) ;
-	
+
 	result = r.segmentation().cellID( Position( l[0], l[1], l[2] ) , global, volIDPVs  );
+	lastCell.first  = nav ;
+	lastCell.second = result ;
       }
 	
       return result ;
@@ -342,8 +424,9 @@ namespace dd4hep {
     std::vector<double> CellIDPositionConverter::cellDimensions(const CellID& cell) const {
       auto context = findContext( cell ) ;
       if( context == nullptr ) return { };
-      dd4hep::Readout r  = findReadout( context->element ) ;
-      dd4hep::Segmentation seg = r.segmentation() ;
+      dd4hep::Segmentation seg = context->segmentation ;
+      if( !seg.isValid() )
+	seg = findReadout( context->element ).segmentation() ;
       return seg.cellDimensions( cell );
     }
 
@@ -0,0 +1,180 @@
+#include "DD4hep/DDTest.h"
+
+#include "DDG4/Geant4Data.h"
+#include "DDG4/Geant4HitCollection.h"
+
+#include <exception>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <set>
+
+using namespace dd4hep;
+using namespace dd4hep::sim;
+
+// this should be the first line in your test
+static DDTest test( "Geant4HitStorage" ) ;
+
+namespace {
+
+  typedef Geant4HitCollection::KeyIndex KeyIndex;
+  typedef Geant4Tracker::Hit            TrackerHit;
+
+  /// Key index with access to the size of the slot table
+  class TestKeys : public KeyIndex  {
+  public:
+    size_t capacity()  const  {  return m_table.size();  }
+  };
+
+  /// Hit collection with access to the recycled containers
+  class TestCollection : public Geant4HitCollection  {
+  public:
+    TestCollection(const std::string& det, const std::string& coll)
+      : Geant4HitCollection(det, coll, nullptr, (const TrackerHit*)nullptr)  {}
+    /// Address of the key table. Detaching clears the key index
+    const void* keyTable()  {
+      Keys::Table table = m_keys.detach();
+      const void* ptr = table.data();
+      m_keys.adopt(std::move(table));
+      return ptr;
+    }
+    /// Address of the hit vector storage
+    const void* hitStorage()  const  {  return m_hits.data();  }
+  };
+
+  /// Sparse keys: cell identifiers differ mostly in the high bits
+  VolumeID make_key(size_t i)  {
+    return (VolumeID(i) << 40) ^ (VolumeID(i % 7) << 3) ^ 0x5;
+  }
+}
+
+//=============================================================================
+
+int main(int /* argc */, char** /* argv */ ){
+
+  test.log( "test the key index and the hit pools of the DDG4 hit collections" );
+
+  try{
+    // ======= KeyIndex: insert and find, growth and rehash
+    {
+      const size_t num_keys = 5000;
+      TestKeys keys;
+      test( keys.empty(), " KeyIndex: initially empty" );
+      test( keys.find(make_key(1)) == KeyIndex::npos, " KeyIndex: find in empty index" );
+      size_t num_rehash = 0, last_capacity = keys.capacity();
+      bool all_inserted = true, load_ok = true;
+      for( size_t i = 0; i < num_keys; ++i )  {
+        all_inserted &= keys.insert(make_key(i), i);
+        if ( keys.capacity() != last_capacity )  {
+          last_capacity = keys.capacity();
+          ++num_rehash;
+        }
+        load_ok &= 2*keys.size() <= keys.capacity();
+      }
+      test( all_inserted, " KeyIndex: all keys inserted" );
+      test( keys.size(), num_keys, " KeyIndex: number of keys" );
+      test( num_rehash > 1, " KeyIndex: table grew several times" );
+      test( load_ok, " KeyIndex: load factor stays below 1/2" );
+      test( (keys.capacity() & (keys.capacity()-1)) == 0, " KeyIndex: table size is a power of two" );
+
+      bool all_found = true, none_found = false;
+      for( size_t i = 0; i < num_keys; ++i )  {
+        all_found  &= keys.find(make_key(i)) == i;
+        none_found |= keys.find(make_key(i+num_keys)) != KeyIndex::npos;
+      }
+      test( all_found, " KeyIndex: all keys found after rehash" );
+      test( !none_found, " KeyIndex: missing keys not found" );
+      test( !keys.insert(make_key(17), 99), " KeyIndex: duplicate key rejected" );
+      test( keys.find(make_key(17)), size_t(17), " KeyIndex: duplicate insert keeps the index" );
+
+      // clear() keeps the table for re-use
+      size_t capacity = keys.capacity();
+      keys.clear();
+      test( keys.empty(), " KeyIndex: empty after clear" );
+      test( keys.capacity(), capacity, " KeyIndex: table kept after clear" );
+      test( keys.find(make_key(3)) == KeyIndex::npos, " KeyIndex: no keys found after clear" );
+      test( keys.insert(make_key(3), 0), " KeyIndex: insert after clear" );
+      test( keys.find(make_key(3)), size_t(0), " KeyIndex: find after clear" );
+
+      // detach/adopt hands the cleared table to another index
+      KeyIndex::Table table = keys.detach();
+      test( keys.empty() && keys.capacity() == 0, " KeyIndex: empty after detach" );
+      test( table.size(), capacity, " KeyIndex: detached table size" );
+      TestKeys other;
+      other.adopt(std::move(table));
+      test( other.empty() && other.capacity() == capacity, " KeyIndex: adopted table" );
+      test( other.find(make_key(3)) == KeyIndex::npos, " KeyIndex: adopted table has no keys" );
+      all_found = true;
+      for( size_t i = 0; i < 100; ++i )  {
+        other.insert(make_key(i+1000), i);
+      }
+      for( size_t i = 0; i < 100; ++i )
+        all_found &= other.find(make_key(i+1000)) == i;
+      test( all_found, " KeyIndex: keys found in adopted table" );
+      test( other.capacity(), capacity, " KeyIndex: no rehash of the adopted table" );
+    }
+
+    // ======= HitPool: memory blocks of deleted hits are re-used
+    {
+      TrackerHit* hit = new TrackerHit();
+      void* block = hit;
+      delete hit;
+      hit = new TrackerHit();
+      test( (void*)hit == block, " HitPool: block re-used by the next hit" );
+      delete hit;
+
+      // Hits deleted by another thread migrate to the pool of that thread
+      void* moved = nullptr;
+      hit = new TrackerHit();
+      std::thread worker([&moved, hit]  {
+        delete hit;
+        TrackerHit* h = new TrackerHit();
+        moved = h;
+        delete h;
+      });
+      worker.join();
+      test( moved == (void*)hit, " HitPool: block released by another thread is re-used there" );
+    }
+
+    // ======= Bulk release of hit collections and re-use across collections
+    {
+      const size_t num_hits = 500;
+      std::set<const void*> blocks;
+      const void* key_table = nullptr;
+      const void* hit_storage = nullptr;
+      {
+        TestCollection coll("det", "first");
+        for( size_t i = 0; i < num_hits; ++i )  {
+          TrackerHit* hit = new TrackerHit();
+          blocks.insert(hit);
+          coll.add(make_key(i), hit);
+        }
+        bool all_found = true;
+        for( size_t i = 0; i < num_hits; ++i )
+          all_found &= coll.findByKey<TrackerHit>(make_key(i)) != nullptr;
+        test( all_found, " Collection: hits found by key" );
+        hit_storage = coll.hitStorage();
+        key_table   = coll.keyTable();
+      }
+      TestCollection coll("det", "second");
+      test( coll.hitStorage() == hit_storage, " Collection: hit vector re-used by the next collection" );
+      test( coll.findByKey<TrackerHit>(make_key(1)) == nullptr, " Collection: no keys of the previous collection" );
+      size_t num_reused = 0;
+      for( size_t i = 0; i < num_hits; ++i )  {
+        TrackerHit* hit = new TrackerHit();
+        num_reused += blocks.count(hit);
+        coll.add(make_key(i+num_hits), hit);
+      }
+      test( num_reused, num_hits, " Collection: hit blocks re-used by the next collection" );
+      test( coll.findByKey<TrackerHit>(make_key(num_hits+3)) != nullptr, " Collection: new hits found by key" );
+      test( coll.keyTable() == key_table, " Collection: key table re-used by the next collection" );
+    }
+
+  } catch( std::exception &e ){
+    test.log( e.what() );
+    test.error( "exception occurred" );
+  }
+  return 0;
+}
+
+//=============================================================================
@@ -0,0 +1,168 @@
+#include "DD4hep/DDTest.h"
+
+#include "DDG4/Geant4Particle.h"
+#include "DDG4/Geant4TrackIndexMap.h"
+
+#include <exception>
+#include <stdexcept>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+using namespace dd4hep;
+using namespace dd4hep::sim;
+
+// this should be the first line in your test
+static DDTest test( "Geant4TrackIndexMap" ) ;
+
+namespace {
+  typedef Geant4TrackIndexMap<int> IndexMap;
+
+  /// Compare the content and the iteration order with the reference std::map
+  bool same(const IndexMap& m, const std::map<int,int>& ref)  {
+    if ( m.size() != ref.size() ) return false;
+    auto r = ref.begin();
+    for( const auto& e : m )  {
+      if ( r == ref.end() || e.first != r->first || e.second != r->second ) return false;
+      ++r;
+    }
+    return r == ref.end();
+  }
+  /// Compare the reverse iteration order with the reference std::map
+  bool same_reverse(const IndexMap& m, const std::map<int,int>& ref)  {
+    auto r = ref.rbegin();
+    for( auto i = m.rbegin(); i != m.rend(); ++i, ++r )  {
+      if ( r == ref.rend() || i->first != r->first ) return false;
+    }
+    return r == ref.rend();
+  }
+}
+
+//=============================================================================
+
+int main(int /* argc */, char** /* argv */ ){
+
+  test.log( "test the track index map and the particle pool of DDG4" );
+
+  try{
+    // ======= Sparse keys: iteration in ascending key order like std::map
+    {
+      IndexMap m;
+      std::map<int,int> ref;
+      const int keys[] = { 1000, 3, 77, 0, 4096, 5, 78, 999 };
+      for( int k : keys )  {
+        auto r = m.emplace(k, 10*k);
+        ref.emplace(k, 10*k);
+        test( r.second && r.first->first == k, " TrackIndexMap: insert of sparse key" );
+      }
+      test( m.size(), ref.size(), " TrackIndexMap: size with sparse keys" );
+      test( same(m, ref), " TrackIndexMap: ascending iteration order" );
+      test( same_reverse(m, ref), " TrackIndexMap: descending iteration order" );
+      test( m.begin()->first, 0, " TrackIndexMap: first entry" );
+      test( (--m.end())->first, 4096, " TrackIndexMap: last entry" );
+
+      auto r = m.emplace(77, -1);
+      test( !r.second && r.first->second == 770, " TrackIndexMap: duplicate insert keeps the entry" );
+      test( m.find(4) == m.end(), " TrackIndexMap: unused slot not found" );
+      test( m.find(5000) == m.end(), " TrackIndexMap: key beyond the slots not found" );
+      test( m.count(999), size_t(1), " TrackIndexMap: count of present key" );
+      test( m.count(998), size_t(0), " TrackIndexMap: count of absent key" );
+      test( m.at(1000), 10000, " TrackIndexMap: checked access" );
+      m[6] = 60;
+      ref[6] = 60;
+      test( same(m, ref), " TrackIndexMap: insert by operator[]" );
+
+      // ======= Negative keys are never present and cannot be inserted
+      test( m.find(-1) == m.end(), " TrackIndexMap: negative key not found" );
+      test( m.count(-7), size_t(0), " TrackIndexMap: count of negative key" );
+      test( m.erase(-1), size_t(0), " TrackIndexMap: erase of negative key" );
+      bool thrown = false;
+      try  {  m.emplace(-3, 1);  }  catch(const std::out_of_range&)  {  thrown = true;  }
+      test( thrown, " TrackIndexMap: insert of negative key rejected" );
+      thrown = false;
+      try  {  m.at(-3);  }  catch(const std::out_of_range&)  {  thrown = true;  }
+      test( thrown, " TrackIndexMap: checked access of negative key rejected" );
+      test( same(m, ref), " TrackIndexMap: unchanged by negative keys" );
+
+      // ======= Erase: by key and by iterator. Other iterators stay valid
+      auto keep = m.find(999);
+      test( m.erase(77), size_t(1), " TrackIndexMap: erase by key" );
+      ref.erase(77);
+      test( m.erase(77), size_t(0), " TrackIndexMap: erase of erased key" );
+      auto next = m.erase(m.find(5));
+      ref.erase(5);
+      test( next != m.end() && next->first == 6, " TrackIndexMap: erase returns the next entry" );
+      test( keep->first == 999 && keep->second == 9990, " TrackIndexMap: iterator valid after erase" );
+      test( same(m, ref), " TrackIndexMap: content after erase" );
+      test( same_reverse(m, ref), " TrackIndexMap: reverse order after erase" );
+      for( auto i = m.begin(); i != m.end(); )  {
+        if ( i->first % 2 == 0 ) i = m.erase(i);
+        else ++i;
+      }
+      for( auto i = ref.begin(); i != ref.end(); )  {
+        if ( i->first % 2 == 0 ) i = ref.erase(i);
+        else ++i;
+      }
+      test( same(m, ref), " TrackIndexMap: erase while iterating" );
+      m.erase(m.begin());
+      ref.erase(ref.begin());
+      test( same(m, ref), " TrackIndexMap: erase of the first entry" );
+
+      // ======= clear() and re-use
+      m.clear();
+      test( m.empty() && m.begin() == m.end(), " TrackIndexMap: empty after clear" );
+      test( m.find(999) == m.end(), " TrackIndexMap: no entries after clear" );
+      m.emplace(2, 20);
+      test( m.size() == 1 && m.begin()->first == 2, " TrackIndexMap: insert after clear" );
+    }
+
+    // ======= Particle pool: memory of released particles is recycled
+    {
+      Geant4Particle* p = new Geant4Particle(1);
+      void* block = p;
+      p->release();
+      p = new Geant4Particle(2);
+      test( (void*)p == block, " ParticlePool: block re-used by the next particle" );
+      test( p->id, 2, " ParticlePool: re-used particle initialized" );
+      test( p->ref, 1, " ParticlePool: reference count of the re-used particle" );
+
+      // Particles shared by reference are only recycled after the last release
+      p->addRef();
+      p->release();
+      Geant4Particle* q = new Geant4Particle(3);
+      test( (void*)q != block, " ParticlePool: referenced particle not recycled" );
+      q->release();
+      p->release();
+
+      // Particles released by another thread are recycled by that thread
+      std::vector<Geant4Particle*> parts;
+      for( int i = 0; i < 10; ++i ) parts.emplace_back(new Geant4Particle(i));
+      std::vector<void*> blocks(parts.begin(), parts.end());
+      size_t num_reused = 0;
+      std::thread worker([&parts, &blocks, &num_reused]  {
+        for( Geant4Particle* part : parts ) part->release();
+        for( size_t i = 0; i < parts.size(); ++i )  {
+          Geant4Particle* part = new Geant4Particle(int(i));
+          num_reused += std::count(blocks.begin(), blocks.end(), (void*)part);
+          part->release();
+        }
+      });
+      worker.join();
+      test( num_reused, parts.size(), " ParticlePool: blocks released by another thread re-used there" );
+
+      // After the worker thread is gone its pool is released: allocation still works
+      Geant4Particle* last = new Geant4Particle(4);
+      test( last->id, 4, " ParticlePool: allocation after thread exit" );
+      last->release();
+    }
+
+  } catch( std::exception &e ){
+    test.log( e.what() );
+    test.error( "exception occurred" );
+  }
+  return 0;
+}
+
+//=============================================================================
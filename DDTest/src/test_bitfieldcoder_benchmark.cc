@@ -0,0 +1,162 @@
+#include "DD4hep/DDTest.h"
+#include <exception>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "DDSegmentation/BitFieldCoder.h"
+#include "DDSegmentation/CartesianGridXY.h"
+
+using namespace std;
+using namespace dd4hep;
+using namespace DDSegmentation;
+
+namespace {
+  typedef chrono::high_resolution_clock Clock;
+
+  /// Print the throughput of one benchmark loop
+  void report( DDTest& test, const string& tag, Clock::time_point start, Clock::time_point stop, size_t calls ){
+    double ns = chrono::duration<double, nano>( stop - start ).count() ;
+    stringstream s ;
+    s << setw(44) << left << tag << ": " << setw(8) << right << fixed << setprecision(2)
+      << ns/double(calls) << " ns/call  " << setw(8) << setprecision(1)
+      << 1e3*double(calls)/ns << " Mcalls/s" ;
+    test.log( s.str() ) ;
+  }
+}
+
+//=============================================================================
+int main(int /* argc */, char** /* argv */ ){
+  // this should be the first line in your test
+  DDTest test( "bitfieldcoder_benchmark" );
+
+  try{
+
+    // ----- write your tests in here -------------------------------------
+
+    test.log( "benchmark bitfieldcoder: field access by name, index and resolved handle" );
+
+    const BitFieldCoder bf("system:5,side:-2,layer:9,module:8,sensor:8,x:32:-16,y:-16" ) ;
+    const size_t num_calls = 2000000 ;
+    const BitFieldHandle hx = bf.handle( "x" ) ;
+    const BitFieldHandle hy = bf.handle( "y" ) ;
+    const size_t ix = bf.index( "x" ) ;
+    const size_t iy = bf.index( "y" ) ;
+    long64 sum_name = 0, sum_index = 0, sum_handle = 0 ;
+
+    // Consistency checks of the handle against the named access
+    long64 field = long64(0xbebafecacafebabeUL) ;
+    test( hx.value( field ),  bf.get( field, "x" ), " handle access field value: x" ) ;
+    test( hy.value( field ),  bf.get( field, "y" ), " handle access field value: y" ) ;
+    long64 f1 = field, f2 = field ;
+    bf.set( f1, "x", -4711 ) ;
+    hx.set( f2, -4711 ) ;
+    test( f1, f2, " handle set field value: x" ) ;
+    bool caught = false ;
+    try { hy.set( f2, 1L << 20 ) ; } catch( const exception& ) { caught = true ; }
+    test( caught, true, " handle set detects out of range value" ) ;
+
+    // Encode/decode throughput
+    auto start = Clock::now() ;
+    for( size_t i = 0 ; i < num_calls ; ++i ){
+      long64 cell = 0 ;
+      bf.set( cell, "x", long64(i & 0x3FFF) - 0x2000 ) ;
+      bf.set( cell, "y", long64(i & 0x1FFF) ) ;
+      sum_name += bf.get( cell, "x" ) + bf.get( cell, "y" ) ;
+    }
+    auto stop = Clock::now() ;
+    report( test, "set/get by field name   (2 x set + 2 x get)", start, stop, num_calls ) ;
+
+    start = Clock::now() ;
+    for( size_t i = 0 ; i < num_calls ; ++i ){
+      long64 cell = 0 ;
+      bf.set( cell, ix, long64(i & 0x3FFF) - 0x2000 ) ;
+      bf.set( cell, iy, long64(i & 0x1FFF) ) ;
+      sum_index += bf.get( cell, ix ) + bf.get( cell, iy ) ;
+    }
+    stop = Clock::now() ;
+    report( test, "set/get by field index  (2 x set + 2 x get)", start, stop, num_calls ) ;
+
+    start = Clock::now() ;
+    for( size_t i = 0 ; i < num_calls ; ++i ){
+      long64 cell = 0 ;
+      hx.set( cell, long64(i & 0x3FFF) - 0x2000 ) ;
+      hy.set( cell, long64(i & 0x1FFF) ) ;
+      sum_handle += hx.value( cell ) + hy.value( cell ) ;
+    }
+    stop = Clock::now() ;
+    report( test, "set/get by field handle (2 x set + 2 x get)", start, stop, num_calls ) ;
+
+    test( sum_index,  sum_name, " identical results: name and index access" ) ;
+    test( sum_handle, sum_name, " identical results: name and handle access" ) ;
+
+    // Segmentation throughput: cellID and position
+    CartesianGridXY seg( "system:8,barrel:3,layer:8,slice:5,x:32:-16,y:-16" ) ;
+    seg.setGridSizeX( 0.5 ) ;
+    seg.setGridSizeY( 0.5 ) ;
+    vector<CellID> cells( 1024 ) ;
+    vector<Vector3D> locals( 1024 ) ;
+    for( size_t i = 0 ; i < locals.size() ; ++i )
+      locals[i] = Vector3D( double(i)*0.37 - 150., double(i%977)*0.29 - 120., 0. ) ;
+    start = Clock::now() ;
+    for( size_t i = 0 ; i < num_calls ; ++i ){
+      const Vector3D& local = locals[i%1024] ;
+      cells[i%1024] = seg.cellID( local, local, 0 ) ;
+    }
+    stop = Clock::now() ;
+    report( test, "CartesianGridXY::cellID", start, stop, num_calls ) ;
+
+    vector<Vector3D> scalar_pos( cells.size() ) ;
+    start = Clock::now() ;
+    for( size_t i = 0 ; i < num_calls ; ++i ){
+      scalar_pos[i%1024] = seg.position( cells[i%1024] ) ;
+    }
+    stop = Clock::now() ;
+    report( test, "CartesianGridXY::position", start, stop, num_calls ) ;
+
+    // The batch calls must reproduce the scalar results exactly
+    vector<VolumeID> vols( cells.size(), 0 ) ;
+    vector<CellID>   batch_cells( cells.size() ) ;
+    vector<Vector3D> batch_pos( cells.size() ) ;
+    seg.cellIDs( locals.data(), locals.data(), vols.data(), batch_cells.data(), cells.size() ) ;
+    seg.positions( batch_cells.data(), batch_pos.data(), batch_cells.size() ) ;
+    size_t num_diff = 0 ;
+    for( size_t i = 0 ; i < cells.size() ; ++i ){
+      if( batch_cells[i] != cells[i] || batch_pos[i].X != scalar_pos[i].X || batch_pos[i].Y != scalar_pos[i].Y )
+        ++num_diff ;
+    }
+    test( num_diff, size_t(0), " CartesianGridXY: batch and scalar cellID/position agree" ) ;
+
+    Vector3D local( 12.3, -45.6, 0. ) ;
+    Vector3D pos = seg.position( seg.cellID( local, local, 0 ) ) ;
+    test( fabs( pos.X - 12.5 ) < 1e-9 && fabs( pos.Y + 45.5 ) < 1e-9, true,
+          " CartesianGridXY: cellID/position round trip" ) ;
+
+    // Changing an identifier must re-resolve the field handles
+    CartesianGridXY renamed( "system:8,u:32:-16,v:-16" ) ;
+    renamed.setGridSizeX( 0.5 ) ;
+    renamed.setGridSizeY( 0.5 ) ;
+    renamed.parameter( "identifier_x" )->setValue( "u" ) ;
+    renamed.setFieldNameY( "v" ) ;
+    CellID renamed_cell = renamed.cellID( local, local, 0 ) ;
+    pos = renamed.position( renamed_cell ) ;
+    test( renamed.decoder()->get( renamed_cell, "u" ), long64(25), " identifier_x renamed: u field encoded" ) ;
+    test( fabs( pos.X - 12.5 ) < 1e-9 && fabs( pos.Y + 45.5 ) < 1e-9, true,
+          " CartesianGridXY: round trip with renamed identifiers" ) ;
+
+    // --------------------------------------------------------------------
+
+
+  } catch( exception &e ){
+    //} catch( ... ){
+
+    test.log( e.what() );
+    test.error( "exception occurred" );
+  }
+
+  return 0;
+}
+
+//=============================================================================
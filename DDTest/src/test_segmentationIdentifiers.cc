@@ -0,0 +1,108 @@
+#include "DD4hep/DDTest.h"
+
+#include "DD4hep/Detector.h"
+#include "DD4hep/Readout.h"
+#include "DD4hep/Segmentations.h"
+#include "DD4hep/DD4hepUnits.h"
+#include "DDSegmentation/WaferGridXY.h"
+#include "DDSegmentation/MegatileLayerGridXY.h"
+
+#include <exception>
+#include <iostream>
+#include <cmath>
+
+using namespace dd4hep;
+
+// this should be the first line in your test
+static DDTest test( "segmentation_identifiers" ) ;
+
+namespace {
+  bool same(double a, double b)  {
+    return std::fabs(a-b) < 1e-9*dd4hep::mm;
+  }
+}
+
+//=============================================================================
+
+int main(int argc, char** argv ){
+
+  test.log( "test cell identifiers overridden in the compact description" );
+
+  if( argc < 2 ) {
+    std::cout << " usage:  test_segmentationIdentifiers segmentation_identifiers.xml " << std::endl ;
+    exit(1) ;
+  }
+
+  try{
+    Detector& description = Detector::getInstance();
+    description.fromCompact( argv[1] );
+
+    // ======= WaferGridXY: group and wafer fields taken from the compact description
+    {
+      Readout      ro  = description.readout("WaferHits");
+      Segmentation seg = ro.segmentation();
+      const BitFieldCoder* dec = ro.idSpec().decoder();
+      auto* wafer = dynamic_cast<DDSegmentation::WaferGridXY*>(seg.segmentation());
+      test( wafer != 0, " WaferGridXY: segmentation type" );
+      wafer->setWaferOffsetX(1, 2, 1*dd4hep::mm);
+
+      CellID vid = 0;
+      dec->set(vid, "grp", 1);
+      dec->set(vid, "waf", 2);
+      dec->set(vid, "alt", 3);
+      Position local(3.1*dd4hep::mm, -4.9*dd4hep::mm, 0);
+      CellID   id  = seg.cellID(local, local, vid);
+      Position pos = seg.position(id);
+      test( dec->get(id, "x"), 1, " WaferGridXY: x bin with wafer offset" );
+      test( dec->get(id, "y"), -2, " WaferGridXY: y bin" );
+      test( same(pos.x(), 3*dd4hep::mm), " WaferGridXY: x position with wafer offset" );
+      test( same(pos.y(), -4*dd4hep::mm), " WaferGridXY: y position" );
+
+      // Overriding the identifier afterwards must re-bind the field
+      seg.segmentation()->parameter("identifier_wafer")->setValue("alt");
+      id  = seg.cellID(local, local, vid);
+      pos = seg.position(id);
+      test( dec->get(id, "x"), 2, " WaferGridXY: x bin after identifier change" );
+      test( same(pos.x(), 4*dd4hep::mm), " WaferGridXY: x position after identifier change" );
+    }
+
+    // ======= MegatileLayerGridXY: layer, wafer and cell fields taken from the compact description
+    {
+      Readout      ro  = description.readout("MegatileHits");
+      Segmentation seg = ro.segmentation();
+      const BitFieldCoder* dec = ro.idSpec().decoder();
+      auto* tile = dynamic_cast<DDSegmentation::MegatileLayerGridXY*>(seg.segmentation());
+      test( tile != 0, " MegatileLayerGridXY: segmentation type" );
+      tile->setMegaTileSizeXY(20*dd4hep::mm, 20*dd4hep::mm);
+      tile->setMegaTileCellsXY(2, 4, 4);
+      tile->setSpecialMegaTile(2, 3, 10*dd4hep::mm, 10*dd4hep::mm, 0, 0, 5, 5);
+
+      CellID vid = 0;
+      dec->set(vid, "lay", 2);
+      dec->set(vid, "tile", 3);
+      dec->set(vid, "alt", 4);
+      Position local(3.1*dd4hep::mm, 5.5*dd4hep::mm, 0);
+      CellID   id  = seg.cellID(local, local, vid);
+      Position pos = seg.position(id);
+      test( dec->get(id, "ix"), 1, " MegatileLayerGridXY: x cell of special tile" );
+      test( dec->get(id, "iy"), 2, " MegatileLayerGridXY: y cell of special tile" );
+      test( same(pos.x(), 3*dd4hep::mm), " MegatileLayerGridXY: x position of special tile" );
+      test( same(pos.y(), 5*dd4hep::mm), " MegatileLayerGridXY: y position of special tile" );
+
+      seg.segmentation()->parameter("identifier_wafer")->setValue("alt");
+      id  = seg.cellID(local, local, vid);
+      pos = seg.position(id);
+      test( dec->get(id, "ix"), 0, " MegatileLayerGridXY: x cell after identifier change" );
+      test( dec->get(id, "iy"), 1, " MegatileLayerGridXY: y cell after identifier change" );
+      test( same(pos.x(), 2.5*dd4hep::mm), " MegatileLayerGridXY: x position after identifier change" );
+      test( same(pos.y(), 7.5*dd4hep::mm), " MegatileLayerGridXY: y position after identifier change" );
+    }
+
+  } catch( std::exception &e ){
+    test.log( e.what() );
+    test.error( "exception occurred" );
+  }
+  return 0;
+}
+
+//=============================================================================
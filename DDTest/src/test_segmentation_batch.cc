@@ -0,0 +1,177 @@
+#include "DD4hep/DDTest.h"
+#include <exception>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "DDSegmentation/CartesianGridXY.h"
+#include "DDSegmentation/CartesianGridXYZ.h"
+#include "DDSegmentation/CartesianGridXZ.h"
+#include "DDSegmentation/CartesianGridYZ.h"
+#include "DDSegmentation/PolarGridRPhi.h"
+#include "DDSegmentation/GridPhiEta.h"
+#include "DDSegmentation/GridRPhiEta.h"
+#include "DDSegmentation/CartesianStripX.h"
+
+using namespace std;
+using namespace dd4hep;
+using namespace DDSegmentation;
+
+namespace {
+  typedef chrono::high_resolution_clock Clock;
+
+  /// User segmentation overriding the scalar calls of a segmentation with batch implementation
+  class ShiftedGridXY : public CartesianGridXY {
+  public:
+    ShiftedGridXY( const string& encoding ) : CartesianGridXY( encoding ) {}
+    virtual Vector3D position( const CellID& cID ) const override {
+      Vector3D p = CartesianGridXY::position( cID ) ;
+      p.Z = 42. ;
+      return p ;
+    }
+    virtual CellID cellID( const Vector3D& local, const Vector3D& global, const VolumeID& vID ) const override {
+      return CartesianGridXY::cellID( Vector3D( local.X + 1., local.Y, local.Z ), global, vID ) ;
+    }
+  } ;
+
+  /// Compare the batch calls against the scalar calls for a set of positions
+  void checkBatch( DDTest& test, const Segmentation& seg, const vector<Vector3D>& points ){
+    const size_t num = points.size() ;
+    vector<VolumeID> volIDs( num, 0 ) ;
+    vector<CellID>   cells( num ), batch_cells( num ) ;
+    vector<Vector3D> pos( num ), batch_pos( num ) ;
+    for( size_t i = 0 ; i < num ; ++i ){
+      volIDs[i] = VolumeID( i % 7 ) ;
+    }
+
+    auto start = Clock::now() ;
+    for( size_t i = 0 ; i < num ; ++i ){
+      cells[i] = seg.cellID( points[i], points[i], volIDs[i] ) ;
+    }
+    auto middle = Clock::now() ;
+    seg.cellIDs( points.data(), points.data(), volIDs.data(), batch_cells.data(), num ) ;
+    auto stop = Clock::now() ;
+    double scalar_ns = chrono::duration<double, nano>( middle - start ).count() ;
+    double batch_ns  = chrono::duration<double, nano>( stop - middle ).count() ;
+
+    size_t cell_diff = 0, pos_diff = 0 ;
+    for( size_t i = 0 ; i < num ; ++i ){
+      cell_diff += cells[i] != batch_cells[i] ? 1 : 0 ;
+    }
+
+    start = Clock::now() ;
+    for( size_t i = 0 ; i < num ; ++i ){
+      pos[i] = seg.position( cells[i] ) ;
+    }
+    middle = Clock::now() ;
+    seg.positions( cells.data(), batch_pos.data(), num ) ;
+    stop = Clock::now() ;
+    for( size_t i = 0 ; i < num ; ++i ){
+      pos_diff += ( pos[i].X != batch_pos[i].X || pos[i].Y != batch_pos[i].Y || pos[i].Z != batch_pos[i].Z ) ? 1 : 0 ;
+    }
+
+    stringstream s ;
+    s << setw(18) << left << seg.type() << fixed << setprecision(2)
+      << " cellID: "   << setw(7) << right << scalar_ns/double(num) << " ns scalar "
+      << setw(7) << batch_ns/double(num) << " ns batch"
+      << "   position: " << setw(7) << chrono::duration<double, nano>( middle - start ).count()/double(num)
+      << " ns scalar " << setw(7) << chrono::duration<double, nano>( stop - middle ).count()/double(num) << " ns batch" ;
+    test.log( s.str() ) ;
+    test( cell_diff, size_t(0), " " + seg.type() + ": identical cell IDs from batch and scalar call" ) ;
+    test( pos_diff,  size_t(0), " " + seg.type() + ": identical positions from batch and scalar call" ) ;
+  }
+}
+
+//=============================================================================
+int main(int /* argc */, char** /* argv */ ){
+  // this should be the first line in your test
+  DDTest test( "segmentation_batch" );
+
+  try{
+
+    // ----- write your tests in here -------------------------------------
+
+    test.log( "test segmentation batch calls: cellIDs and positions" );
+
+    // Points with a size not being a multiple of the chunk size
+    vector<Vector3D> points ;
+    for( size_t i = 0 ; i < 10000 ; ++i ){
+      points.push_back( Vector3D( double(i%1024)*0.37 - 150.3, double(i%977)*0.29 - 120.1, double(i%311)*1.3 - 190.7 ) ) ;
+    }
+    const string encoding = "system:8,barrel:3,layer:8,slice:5,x:32:-16,y:-16" ;
+
+    CartesianGridXY xy( encoding ) ;
+    xy.setGridSizeX( 0.5 ) ;
+    xy.setGridSizeY( 0.7 ) ;
+    xy.setOffsetX( 0.1 ) ;
+    checkBatch( test, xy, points ) ;
+
+    CartesianGridXYZ xyz( "system:8,barrel:3,x:-16,y:-16,z:-16" ) ;
+    xyz.setGridSizeX( 1.5 ) ;
+    xyz.setGridSizeY( 2.5 ) ;
+    xyz.setGridSizeZ( 3.5 ) ;
+    checkBatch( test, xyz, points ) ;
+
+    CartesianGridXZ xz( "system:8,barrel:3,layer:8,slice:5,x:32:-16,z:-16" ) ;
+    xz.setGridSizeX( 0.5 ) ;
+    xz.setGridSizeZ( 1.1 ) ;
+    checkBatch( test, xz, points ) ;
+
+    CartesianGridYZ yz( "system:8,barrel:3,layer:8,slice:5,y:32:-16,z:-16" ) ;
+    yz.setGridSizeY( 0.5 ) ;
+    yz.setGridSizeZ( 1.1 ) ;
+    checkBatch( test, yz, points ) ;
+
+    PolarGridRPhi rphi( "system:8,barrel:3,layer:8,slice:5,r:32:-16,phi:-16" ) ;
+    rphi.setGridSizeR( 0.5 ) ;
+    rphi.setGridSizePhi( 0.01 ) ;
+    checkBatch( test, rphi, points ) ;
+
+    GridPhiEta phieta( "system:8,barrel:3,layer:8,slice:5,eta:32:-16,phi:-16" ) ;
+    phieta.setGridSizeEta( 0.01 ) ;
+    phieta.setPhiBins( 628 ) ;
+    checkBatch( test, phieta, points ) ;
+
+    GridRPhiEta rphieta( "system:8,barrel:3,layer:8,eta:-12,phi:-12,r:-16" ) ;
+    rphieta.setGridSizeEta( 0.01 ) ;
+    rphieta.setPhiBins( 628 ) ;
+    rphieta.setGridSizeR( 0.5 ) ;
+    checkBatch( test, rphieta, points ) ;
+
+    // Segmentation without dedicated batch implementation: default loop over the scalar call
+    CartesianStripX strip( "system:8,barrel:3,layer:8,slice:5,strip:-16" ) ;
+    strip.setStripSizeX( 0.5 ) ;
+    checkBatch( test, strip, points ) ;
+
+    // Derived classes overriding the scalar calls must not take the fast path of the base class
+    ShiftedGridXY shifted( encoding ) ;
+    shifted.setGridSizeX( 0.5 ) ;
+    shifted.setGridSizeY( 0.7 ) ;
+    checkBatch( test, shifted, points ) ;
+
+    // Out of range bins must be reported by the batch call like by the scalar call
+    vector<Vector3D> far( 300, Vector3D( 0., 0., 0. ) ) ;
+    far[299] = Vector3D( 1e6, 0., 0. ) ;
+    vector<VolumeID> volIDs( far.size(), 0 ) ;
+    vector<CellID>   cells( far.size() ) ;
+    bool caught = false ;
+    try { xyz.cellIDs( far.data(), far.data(), volIDs.data(), cells.data(), far.size() ) ; }
+    catch( const exception& ) { caught = true ; }
+    test( caught, true, " CartesianGridXYZ: batch call detects out of range bins" ) ;
+
+    // --------------------------------------------------------------------
+
+
+  } catch( exception &e ){
+    //} catch( ... ){
+
+    test.log( e.what() );
+    test.error( "exception occurred" );
+  }
+
+  return 0;
+}
+
+//=============================================================================
@@ -128,6 +128,7 @@ int main_wrapper(int argc, char** argv ){
       dd4hep::BitFieldCoder idDecoder1( cellIDEcoding ) ;
 
       int nHit = std::min( col->getNumberOfElements(), maxHit )  ;
+      CellID lastID = 0 ;
      
       
       for(int i=0 ; i< nHit ; ++i){
@@ -156,6 +157,11 @@ int main_wrapper(int argc, char** argv ){
 	  tMap[ colNames[icol] ].cellid.passed++ ;
 	else
 	  tMap[ colNames[icol] ].cellid.failed++ ;
+
+	// the search starting from the previous hit must give the same result
+	CellID idFromHint = idposConv.cellID( point, lastID ) ;
+	test( idFromDecoder, idFromHint, " compare ids with hint: " + idDecoder1.valueString(idFromHint) ) ;
+	lastID = idFromDecoder ;
 	  
 	Position pointFromDecoder = idposConv.position( id ) ;
 
@@ -0,0 +1,191 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+/*
+   Plugin invocation:
+   ==================
+   This plugin behaves like a main program.
+   Invoke the plugin with something like this:
+
+   geoPluginRun -volmgr -destroy -plugin DD4hep_AlignmentExample_incremental \
+   -input file:${DD4hep_DIR}/examples/AlignDet/compact/Telescope.xml -runs 20
+
+   Populate the conditions store by hand for one IOV.
+   Then change one delta at a time and compute the alignments in
+   incremental mode. Only the subtree of the changed detector element
+   may be recomputed. The result is compared to a full computation.
+
+*/
+// Framework include files
+#include "AlignmentExampleObjects.h"
+#include "DD4hep/Factories.h"
+#include "TTimeStamp.h"
+
+using namespace std;
+using namespace dd4hep;
+using namespace dd4hep::AlignmentExamples;
+
+namespace {
+
+  /// Compare the world transformations of two alignment sets
+  class AlignmentCompare  {
+  public:
+    ConditionsMap& full;
+    ConditionsMap& incremental;
+    /// Constructor
+    AlignmentCompare(ConditionsMap& f, ConditionsMap& i) : full(f), incremental(i) {}
+    /// Callback to process a single detector element. Returns 1 on mismatch
+    int operator()(DetElement de, int)  const  {
+      Alignment a = full.get(de, align::Keys::alignmentKey);
+      Alignment b = incremental.get(de, align::Keys::alignmentKey);
+      if ( a.isValid() != b.isValid() )  {
+        printout(ERROR,"Compare","Alignment of %s: present in full:%s incremental:%s",
+                 de.path().c_str(), yes_no(a.isValid()), yes_no(b.isValid()));
+        return 1;
+      }
+      if ( a.isValid() )  {
+        const TGeoHMatrix& ma = a.worldTransformation();
+        const TGeoHMatrix& mb = b.worldTransformation();
+        for( int i=0; i<3; ++i )  {
+          if ( ma.GetTranslation()[i] != mb.GetTranslation()[i] )  {
+            printout(ERROR,"Compare","World transformation of %s differs.",de.path().c_str());
+            return 1;
+          }
+        }
+        for( int i=0; i<9; ++i )  {
+          if ( ma.GetRotationMatrix()[i] != mb.GetRotationMatrix()[i] )  {
+            printout(ERROR,"Compare","World rotation of %s differs.",de.path().c_str());
+            return 1;
+          }
+        }
+      }
+      return 0;
+    }
+  };
+}
+
+/// Plugin function: Alignment program example
+/**
+ *  Factory: DD4hep_AlignmentExample_incremental
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \date    01/12/2016
+ */
+static int alignment_example (Detector& description, int argc, char** argv)  {
+
+  string input;
+  int    num_runs = 20;
+  bool   arg_error = false;
+  for(int i=0; i<argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-input",argv[i],4) )
+      input = argv[++i];
+    else if ( 0 == ::strncmp("-runs",argv[i],4) )
+      num_runs = ::atol(argv[++i]);
+    else
+      arg_error = true;
+  }
+  if ( arg_error || input.empty() )   {
+    /// Help printout describing the basic command line interface
+    cout <<
+      "Usage: -plugin <name> -arg [-arg]                                             \n"
+      "     name:   factory name     DD4hep_AlignmentExample_incremental             \n"
+      "     -input   <string>        Geometry file                                   \n"
+      "     -runs    <number>        Number of delta changes to be processed.        \n"
+      "\tArguments given: " << arguments(argc,argv) << endl << flush;
+    ::exit(EINVAL);
+  }
+
+  // First we load the geometry
+  description.fromXML(input);
+
+  /******************** Initialize the conditions manager *****************/
+  ConditionsManager manager = installManager(description);
+  const IOVType*    iov_typ = manager.registerIOVType(0,"run").second;
+  if ( 0 == iov_typ )
+    except("ConditionsPrepare","++ Unknown IOV type supplied.");
+
+  /******************** Populate the conditions store *********************/
+  IOV iov(iov_typ, IOV::Key(1,10));
+  ConditionsPool* iov_pool = manager.registerIOV(*iov.iovType, iov.key());
+  size_t total_created = Scanner().scan(AlignmentCreator(manager, *iov_pool),description.world());
+
+  /******************** Now as usual: create the slice ********************/
+  shared_ptr<ConditionsContent> content(new ConditionsContent());
+  shared_ptr<ConditionsSlice>   slice(new ConditionsSlice(manager,content));
+  cond::fill_content(manager,*content,*iov_typ);
+  IOV req_iov(iov_typ,5);
+  manager.prepare(req_iov,*slice);
+
+  // Collect all the delta conditions and make proper alignment conditions out of them
+  map<DetElement, Delta>  deltas;
+  Scanner(deltaCollector(*slice,deltas),description.world());
+  printout(INFO,"Prepare","Got a total of %ld deltas for processing alignments.",deltas.size());
+  if ( deltas.empty() )
+    except("Incremental","++ No alignment deltas found.");
+
+  /******************** Compute alignments ********************************/
+  AlignmentsCalculator         incremental;
+  AlignmentsCalculator::Result total_full, total_incr;
+  double time_full = 0e0, time_incr = 0e0;
+  long   num_errors = 0;
+  for(int i=0; i<=num_runs; ++i)  {
+    long expected = 0;
+    if ( i > 0 )  {
+      // Change one delta: only the subtree of this detector element is affected
+      auto d = deltas.begin();
+      std::advance(d, i%deltas.size());
+      d->second.translation.SetX(d->second.translation.X() + 1e-3*dd4hep::mm);
+      d->second.flags |= Delta::HAVE_TRANSLATION;
+      expected = Scanner().scan([](DetElement, int) { return 1; }, d->first);
+    }
+    shared_ptr<ConditionsSlice> sl_full(new ConditionsSlice(manager,content));
+    shared_ptr<ConditionsSlice> sl_incr(new ConditionsSlice(manager,content));
+    manager.prepare(req_iov,*sl_full);
+    manager.prepare(req_iov,*sl_incr);
+
+    TTimeStamp start;
+    AlignmentsCalculator::Result full = AlignmentsCalculator().compute(deltas,*sl_full);
+    TTimeStamp middle;
+    AlignmentsCalculator::Result incr = incremental.compute_incremental(deltas,*sl_incr);
+    TTimeStamp stop;
+    time_full += middle.AsDouble()-start.AsDouble();
+    time_incr += stop.AsDouble()-middle.AsDouble();
+    total_full += full;
+    total_incr += incr;
+
+    long mismatch = Scanner().scan(AlignmentCompare(*sl_full,*sl_incr),description.world());
+    printout(INFO,"Incremental","Run %3d: Full: (A:%ld,R:%ld) Incremental: (A:%ld,R:%ld) expected R:%ld",
+             i, full.computed, full.recomputed, incr.computed, incr.recomputed,
+             i == 0 ? long(full.computed) : expected);
+    if ( mismatch != 0 || incr.computed != full.computed ||
+         (i == 0 && incr.recomputed != full.computed)   ||
+         (i >  0 && long(incr.recomputed) != expected) )  {
+      printout(ERROR,"Incremental","Run %3d: Inconsistent incremental result: %ld mismatches.",i,mismatch);
+      ++num_errors;
+    }
+  }
+  bool success = num_errors == 0;
+  printout(INFO,"Statistics","+======= Summary: # of Runs: %3d ============================================", num_runs);
+  printout(INFO,"Statistics","+  Created %ld conditions. %ld deltas.", total_created, deltas.size());
+  printout(INFO,"Statistics","+  Full computation:        (A:%6ld,R:%6ld) %8.4f sec",
+           total_full.computed, total_full.recomputed, time_full);
+  printout(INFO,"Statistics","+  Incremental computation: (A:%6ld,R:%6ld) %8.4f sec",
+           total_incr.computed, total_incr.recomputed, time_incr);
+  printout(INFO,"Statistics","+==========================================================================");
+  printout(success ? ALWAYS : ERROR,"Incremental","Test %s", success ? "PASSED" : "FAILED");
+  // All done.
+  return 1;
+}
+
+// first argument is the type from the xml file
+DECLARE_APPLY(DD4hep_AlignmentExample_incremental,alignment_example)
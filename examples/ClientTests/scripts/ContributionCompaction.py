@@ -0,0 +1,144 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import, unicode_literals
+import os
+import sys
+import logging
+import DDG4
+from g4units import GeV, MeV, ns
+#
+#
+"""
+
+   dd4hep example setup using the python configuration
+
+   Test of the compaction of calorimeter hit contributions.
+   The same calorimeter is read out by 4 sensitive actions,
+   one for each value of the property ContributionCompaction.
+   The hit energies and the energy of the contributions must
+   agree with the ones of the collection keeping all contributions.
+
+   Simulation:   python ContributionCompaction.py -batch
+   Check output: python ContributionCompaction.py -check
+
+   \author  M.Frank
+   \version 1.0
+
+"""
+logging.basicConfig(format='%(levelname)s: %(message)s', level=logging.INFO)
+logger = logging.getLogger(__name__)
+
+modes = [('All', 'CompactionAllHits'),
+         ('Track', 'CompactionTrackHits'),
+         ('Time', 'CompactionTimeHits'),
+         ('TopN', 'CompactionTopNHits')]
+max_contributions = 3
+output = 'ContributionCompaction.root'
+
+
+def summarize(hits):
+  energy = 0.0
+  truth = 0.0
+  contributions = 0
+  largest = 0
+  for h in hits:
+    energy = energy + h.energyDeposit
+    for c in h.truth:
+      truth = truth + c.deposit
+    contributions = contributions + h.truth.size()
+    largest = max(largest, h.truth.size())
+  return (energy, truth, contributions, largest)
+
+
+def check():
+  import ROOT
+  f = ROOT.TFile.Open(output)
+  if not f or f.IsZombie():
+    logger.error('+++ Cannot open output file %s', output)
+    return False
+  tree = f.Get('EVENT')
+  errors = 0
+  for i in range(tree.GetEntries()):
+    tree.GetEntry(i)
+    ref = summarize(getattr(tree, modes[0][1]))
+    for mode, coll in modes:
+      energy, truth, contributions, largest = summarize(getattr(tree, coll))
+      tolerance = 1e-9 * max(abs(ref[0]), 1.0)
+      ok = abs(energy - ref[0]) < tolerance and abs(truth - ref[0]) < tolerance
+      ok = ok and contributions <= ref[2]
+      if mode == 'TopN':
+        ok = ok and largest <= max_contributions
+      logger.info('+++ Event %3d %-6s hit energy: %12.6f MeV contribution energy: %12.6f MeV %6d contributions',
+                  i, mode, energy / MeV, truth / MeV, contributions)
+      if not ok:
+        logger.error('+++ Event %3d %-6s compaction differs from All: %12.6f MeV [%d contributions]',
+                     i, mode, ref[0] / MeV, ref[2])
+        errors = errors + 1
+  f.Close()
+  if errors == 0 and tree.GetEntries() > 0:
+    logger.info('+++ Contribution compaction Test PASSED')
+    return True
+  logger.error('+++ Contribution compaction Test FAILED: %d errors', errors)
+  return False
+
+
+def run():
+  batch = False
+  kernel = DDG4.Kernel()
+  install_dir = os.environ['DD4hepExamplesINSTALL']
+  geometry = "file:" + install_dir + "/examples/ClientTests/compact/ContributionCompaction.xml"
+  for i in range(len(sys.argv)):
+    if sys.argv[i] == '-compact':
+      geometry = sys.argv[i + 1]
+    elif sys.argv[i] == '-check':
+      if not check():
+        sys.exit(1)
+      return
+    elif sys.argv[i] == '-batch':
+      batch = True
+    elif sys.argv[i] == 'batch':
+      batch = True
+
+  kernel.loadGeometry(str(geometry))
+  geant4 = DDG4.Geant4(kernel)
+  geant4.setupCshUI()
+  if batch:
+    kernel.UI = ''
+  kernel.NumEvents = 5
+
+  # Configure I/O
+  geant4.setupROOTOutput('RootOutput', output, mc_truth=True)
+  # Setup particle gun: electrons into the endcap
+  geant4.setupGun("Gun", particle='e-', energy=5 * GeV, isotrop=False,
+                  direction=(0.1, 0.1, 1.0), multiplicity=1)
+
+  # Now the test calorimeter with one collection per compaction mode
+  seq, acts = geant4.setupCalorimeter('TestCal', collections=[coll for mode, coll in modes])
+  for act, (mode, coll) in zip(acts, modes):
+    act.ContributionCompaction = mode
+    act.ContributionTimeBin = 0.1 * ns
+    act.MaxContributions = max_contributions
+
+  # And handle the simulation particles.
+  part = DDG4.GeneratorAction(kernel, "Geant4ParticleHandler/ParticleHandler")
+  kernel.generatorAction().adopt(part)
+  part.MinimalKineticEnergy = 1 * MeV
+
+  # Now build the physics list:
+  phys = kernel.physicsList()
+  phys.extends = 'QGSP_BERT'
+  phys.enableUI()
+  # and run
+  geant4.execute()
+
+
+if __name__ == "__main__":
+  run()
@@ -0,0 +1,165 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import, unicode_literals
+import os
+import sys
+import glob
+import logging
+import DDG4
+from g4units import GeV, MeV
+#
+#
+"""
+
+   dd4hep example setup using the python configuration
+
+   Test of the output files written by the worker threads.
+   Every worker thread writes its own ROOT (and EDM4hep) output file
+   using the property FilesByThread. When the master kernel terminates
+   the worker files are merged into the requested output file.
+   The merged files must contain all events and the worker files
+   must be gone.
+
+   Simulation:   python ThreadOutputFiles.py -batch [-edm4hep]
+   Check output: python ThreadOutputFiles.py -check [-edm4hep]
+
+   \author  M.Frank
+   \version 1.0
+
+"""
+logging.basicConfig(format='%(levelname)s: %(message)s', level=logging.INFO)
+logger = logging.getLogger(__name__)
+
+num_events = 12
+num_threads = 3
+outputs = {'ROOT': ('ThreadOutputFiles.root', 'EVENT'),
+           'EDM4hep': ('ThreadOutputFiles.edm4hep.root', 'events')}
+
+
+def check(formats):
+  import ROOT
+  errors = 0
+  for fmt in formats:
+    output, tree_name = outputs[fmt]
+    stem = output[:output.rfind('.')]
+    workers = glob.glob(stem + '.t[0-9][0-9][0-9]*')
+    if workers:
+      logger.error('+++ %-8s Worker files were not merged: %s', fmt, str(workers))
+      errors = errors + 1
+    f = ROOT.TFile.Open(output)
+    if not f or f.IsZombie():
+      logger.error('+++ %-8s Cannot open merged output file %s', fmt, output)
+      errors = errors + 1
+      continue
+    tree = f.Get(tree_name)
+    entries = tree.GetEntries() if tree else 0
+    logger.info('+++ %-8s %s: %d events in tree %s', fmt, output, entries, tree_name)
+    if entries != num_events:
+      logger.error('+++ %-8s %s: %d events found. Expected %d', fmt, output, entries, num_events)
+      errors = errors + 1
+    f.Close()
+  if errors == 0:
+    logger.info('+++ Thread output files Test PASSED')
+    return True
+  logger.error('+++ Thread output files Test FAILED: %d errors', errors)
+  return False
+
+
+def setupWorker(geant4, formats):
+  kernel = geant4.kernel()
+  logger.info('#PYTHON: +++ Creating Geant4 worker thread ....')
+  # Configure I/O: one output action instance and one file per worker thread
+  for fmt in formats:
+    output = outputs[fmt][0]
+    if fmt == 'ROOT':
+      evt = DDG4.EventAction(kernel, 'Geant4Output2ROOT/RootOutput', False)
+      evt.HandleMCTruth = True
+    else:
+      evt = DDG4.EventAction(kernel, 'Geant4Output2EDM4hep/Edm4hepOutput', False)
+    evt.Control = True
+    evt.Output = output
+    evt.FilesByThread = True
+    evt.MergeThreadFiles = True
+    kernel.eventAction().add(evt)
+  # Setup particle gun
+  gen = DDG4.GeneratorAction(kernel, "Geant4GeneratorActionInit/GenerationInit")
+  kernel.generatorAction().adopt(gen)
+  gun = DDG4.GeneratorAction(kernel, "Geant4ParticleGun/Gun")
+  gun.Energy = 10 * GeV
+  gun.particle = 'pi-'
+  gun.multiplicity = 1
+  gun.isotrop = True
+  kernel.generatorAction().adopt(gun)
+  # And handle the simulation particles.
+  part = DDG4.GeneratorAction(kernel, "Geant4ParticleHandler/ParticleHandler")
+  kernel.generatorAction().adopt(part)
+  part.MinimalKineticEnergy = 1 * MeV
+  logger.info('#PYTHON: +++ Geant4 worker thread configured successfully....')
+  return 1
+
+
+def setupMaster(geant4):
+  kernel = geant4.master()
+  logger.info('#PYTHON: +++ Setting up master thread for %d workers', int(kernel.NumberOfThreads))
+  return 1
+
+
+def setupSensitives(geant4):
+  from dd4hep import DetElement
+  for i in geant4.description.detectors():
+    det = DetElement(i.second.ptr())
+    sd = geant4.description.sensitiveDetector(str(det.name()))
+    if sd.isValid():
+      geant4.setupTracker(det.name())
+  return 1
+
+
+def run():
+  formats = ['ROOT']
+  batch = False
+  kernel = DDG4.Kernel()
+  install_dir = os.environ['DD4hepExamplesINSTALL']
+  geometry = "file:" + install_dir + "/examples/ClientTests/compact/MiniTel.xml"
+  for i in range(len(sys.argv)):
+    if sys.argv[i] == '-compact':
+      geometry = sys.argv[i + 1]
+    elif sys.argv[i] == '-edm4hep':
+      formats.append('EDM4hep')
+    elif sys.argv[i] == '-batch':
+      batch = True
+  if '-check' in sys.argv:
+    if not check(formats):
+      sys.exit(1)
+    return
+
+  kernel.loadGeometry(str(geometry))
+  kernel.NumberOfThreads = num_threads
+  kernel.RunManagerType = 'G4MTRunManager'
+  geant4 = DDG4.Geant4(kernel)
+  geant4.setupCshUI()
+  if batch:
+    kernel.UI = ''
+  kernel.NumEvents = num_events
+
+  geant4.addUserInitialization(worker=setupWorker, worker_args=(geant4, formats),
+                               master=setupMaster, master_args=(geant4,))
+  geant4.addDetectorConstruction("Geant4DetectorGeometryConstruction/ConstructGeo")
+  geant4.addDetectorConstruction("Geant4PythonDetectorConstruction/SetupSD",
+                                 sensitives=setupSensitives, sensitives_args=(geant4,))
+  geant4.addDetectorConstruction("Geant4DetectorSensitivesConstruction/ConstructSD")
+  geant4.setupTrackingFieldMT()
+  geant4.setupPhysics('QGSP_BERT')
+  # and run: the worker files are merged when the kernel terminates
+  geant4.run()
+
+
+if __name__ == "__main__":
+  run()
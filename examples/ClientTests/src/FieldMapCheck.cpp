@@ -0,0 +1,145 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+/*
+ Plugin invocation:
+ ==================
+ This plugin behaves like a main program.
+ Invoke the plugin with something like this:
+
+ geoPluginRun -destroy -plugin DD4hep_FieldMapCheck \
+   -map FieldMapCylindrical.bin -type cylindrical -points 100000
+
+*/
+// Framework include files
+#include "DD4hep/Printout.h"
+#include "DD4hep/Factories.h"
+#include "DD4hep/Detector.h"
+#include "DD4hep/FieldTypes.h"
+#include "DD4hep/DD4hepUnits.h"
+
+// C/C++ include files
+#include <cmath>
+#include <random>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <algorithm>
+
+using namespace dd4hep;
+
+namespace {
+
+  /// Analytic field of FieldMap.txt in tesla at (x,y,z) in mm
+  void linear_field(const double* p, double* b)  {
+    b[0] = 2e-4 * (p[0] + 500e0);
+    b[1] = -1e-4 * p[1];
+    b[2] = 2e0 + 1e-4 * p[2];
+  }
+
+  /// Analytic field of FieldMapCylindrical.txt in tesla at (x,y,z) in mm
+  void cylindrical_field(const double* p, double* b)  {
+    double r   = std::sqrt(p[0]*p[0] + p[1]*p[1]);
+    double phi = std::atan2(p[1], p[0]);
+    double br  = 1e-4 * r, bphi = 2e-4 * r;
+    b[0] = br * std::cos(phi) - bphi * std::sin(phi);
+    b[1] = br * std::sin(phi) + bphi * std::cos(phi);
+    b[2] = 1e0 + 1e-4 * p[2] + 1e-4 * r * std::abs(phi);
+  }
+}
+
+/// Plugin function: Compare the interpolated field of the test field maps to the analytic field
+/**
+ *  Factory: DD4hep_FieldMapCheck
+ *
+ *  The field values of the test maps FieldMap.txt and FieldMapCylindrical.txt
+ *  are linear within each grid cell. Hence the trilinear interpolation must
+ *  reproduce the analytic field at arbitrary positions between the grid points.
+ *  The cylindrical map covers the full circle: a quarter of the random points
+ *  is placed in the grid cell closing the circle at phi = +-pi.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ */
+static int fieldmap_check (Detector& /* description */, int argc, char** argv)  {
+  std::string map, type = "linear";
+  long num_points = 100000;
+  bool help = false;
+  for(int i=0; i<argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-map",argv[i],4) && i+1 < argc )
+      map = argv[++i];
+    else if ( 0 == ::strncmp("-type",argv[i],4) && i+1 < argc )
+      type = argv[++i];
+    else if ( 0 == ::strncmp("-points",argv[i],4) && i+1 < argc )
+      num_points = ::atol(argv[++i]);
+    else
+      help = true;
+  }
+  bool cylindrical = type == "cylindrical";
+  if ( help || map.empty() || num_points < 1 || (!cylindrical && type != "linear") )   {
+    /// Help printout describing the basic command line interface
+    std::cout <<
+      "Usage: -plugin <name> -arg [-arg]                                     \n"
+      "     name:   factory name     DD4hep_FieldMapCheck                    \n"
+      "     -map    <file>           Binary field map of a test field.       \n"
+      "     -type   <string>         Test field: linear or cylindrical.      \n"
+      "     -points <number>         Number of random positions to check.    \n"
+      "\tArguments given: " << arguments(argc,argv) << std::endl << std::flush;
+    ::exit(EINVAL);
+  }
+  FieldMap fmap;
+  fmap.load(map);
+  if ( fmap.coordinateSystem() != (cylindrical ? FieldMap::CYLINDRICAL : FieldMap::CARTESIAN) )  {
+    except("FieldMapCheck","+++ %s: The grid is not %s.", map.c_str(), cylindrical ? "cylindrical" : "Cartesian");
+  }
+  std::mt19937 generator(12345);
+  std::uniform_real_distribution<double> flat(0e0, 1e0);
+  const double cell = M_PI / 6e0;
+  long num_errors = 0;
+  for( long n = 0; n < num_points; ++n )  {
+    double p[3], b[3] = { 0e0, 0e0, 0e0 }, expected[3];
+    if ( cylindrical )  {
+      double r   = 500e0 * flat(generator);
+      double phi = (n%4 == 0) ? M_PI + cell * (flat(generator) - 0.5) : M_PI * (2e0*flat(generator) - 1e0);
+      p[0] = r * std::cos(phi);
+      p[1] = r * std::sin(phi);
+      p[2] = 1000e0 * (2e0*flat(generator) - 1e0);
+      cylindrical_field(p, expected);
+    }
+    else  {
+      p[0] = 500e0  * (2e0*flat(generator) - 1e0);
+      p[1] = 500e0  * (2e0*flat(generator) - 1e0);
+      p[2] = 1000e0 * (2e0*flat(generator) - 1e0);
+      linear_field(p, expected);
+    }
+    double pos[3] = { p[0] * dd4hep::mm, p[1] * dd4hep::mm, p[2] * dd4hep::mm };
+    fmap.fieldComponents(pos, b);
+    for( int i = 0; i < 3; ++i )  {
+      double diff = b[i] / dd4hep::tesla - expected[i];
+      if ( std::abs(diff) > 1e-5 * std::max(std::abs(expected[i]), 1e0) )  {
+        printout(ERROR,"FieldMapCheck","+++ Field mismatch at (%g, %g, %g): B[%d] = %g expected %g",
+                 p[0], p[1], p[2], i, b[i] / dd4hep::tesla, expected[i]);
+        ++num_errors;
+        break;
+      }
+    }
+  }
+  if ( num_errors == 0 )  {
+    printout(ALWAYS,"FieldMapCheck","+++ Checked %ld random positions of the %s field. Test PASSED",
+             num_points, type.c_str());
+    return 1;
+  }
+  printout(ERROR,"FieldMapCheck","+++ %ld of %ld random positions differ. Test FAILED",
+           num_errors, num_points);
+  return 0;
+}
+DECLARE_APPLY(DD4hep_FieldMapCheck,fieldmap_check)
@@ -0,0 +1,144 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+/*
+   Plugin invocation:
+   ==================
+   This plugin behaves like a main program.
+   Invoke the plugin with something like this:
+
+   geoPluginRun -destroy -plugin DD4hep_ConditionExample_benchmark \
+   -input file:${DD4hep_DIR}/examples/AlignDet/compact/Telescope.xml -iovs 10000 -runs 1000
+
+   Populate the conditions store with a large number of run-IOVs.
+   Then measure the latency of the IOV pool selection and of the
+   slice preparation for random IOVs.
+
+*/
+// Framework include files
+#include "ConditionExampleObjects.h"
+#include "DDCond/ConditionsIOVPool.h"
+#include "DD4hep/Factories.h"
+#include "TStatistic.h"
+#include "TTimeStamp.h"
+#include "TRandom3.h"
+
+using namespace std;
+using namespace dd4hep;
+using namespace dd4hep::ConditionExamples;
+
+/// Plugin function: Condition program example
+/**
+ *  Factory: DD4hep_ConditionExample_benchmark
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \date    01/12/2016
+ */
+static int condition_example (Detector& description, int argc, char** argv)  {
+  string input;
+  int    num_iov = 10000, num_runs = 1000;
+  bool   arg_error = false;
+  for(int i=0; i<argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-input",argv[i],4) )
+      input = argv[++i];
+    else if ( 0 == ::strncmp("-iovs",argv[i],4) )
+      num_iov = ::atol(argv[++i]);
+    else if ( 0 == ::strncmp("-runs",argv[i],4) )
+      num_runs = ::atol(argv[++i]);
+    else
+      arg_error = true;
+  }
+  if ( arg_error || input.empty() || num_iov < 1 )   {
+    /// Help printout describing the basic command line interface
+    cout <<
+      "Usage: -plugin <name> -arg [-arg]                                             \n"
+      "     name:   factory name     DD4hep_ConditionExample_benchmark               \n"
+      "     -input   <string>        Geometry file                                   \n"
+      "     -iovs    <number>        Number of IOVs in the conditions store.         \n"
+      "     -runs    <number>        Number of slice preparations to be measured.    \n"
+      "\tArguments given: " << arguments(argc,argv) << endl << flush;
+    ::exit(EINVAL);
+  }
+
+  // First we load the geometry
+  description.fromXML(input);
+
+  /******************** Initialize the conditions manager *****************/
+  ConditionsManager manager = installManager(description);
+  const IOVType*    iov_typ = manager.registerIOVType(0,"run").second;
+  if ( 0 == iov_typ )  {
+    except("ConditionsPrepare","++ Unknown IOV type supplied.");
+  }
+
+  /******************** Now as usual: create the slice ********************/
+  shared_ptr<ConditionsContent> content(new ConditionsContent());
+  shared_ptr<ConditionsSlice>   slice(new ConditionsSlice(manager,content));
+  Scanner(ConditionsKeys(*content,DEBUG),description.world());
+  Scanner(ConditionsDependencyCreator(*content,DEBUG),description.world());
+
+  /******************** Populate the conditions store *********************/
+  // Have num_iov run-slices [1,10] .... [n*10+1,(n+1)*10]
+  TTimeStamp start_create;
+  size_t total_created = 0;
+  for(int i=0; i<num_iov; ++i)  {
+    IOV iov(iov_typ, IOV::Key(1+i*10,(i+1)*10));
+    ConditionsPool* iov_pool = manager.registerIOV(*iov.iovType, iov.key());
+    total_created += Scanner().scan(ConditionsCreator(*slice, *iov_pool, DEBUG), description.world());
+  }
+  TTimeStamp stop_create;
+  printout(INFO,"Benchmark","Created %ld conditions in %d IOVs [%8.3f sec]",
+           total_created, num_iov, stop_create.AsDouble()-start_create.AsDouble());
+
+  // ++++++++++++++++++++++++ Measure the IOV pool selection and the slice preparation
+  cond::ConditionsIOVPool* iov_pool = manager.iovPool(*iov_typ);
+  TStatistic sel_stat("Selection"), prep_stat("Prepare");
+  TRandom3   random;
+  size_t     expected = content->conditions().size() + content->derived().size();
+  long       num_errors = 0;
+  ConditionsManager::Result total;
+  for(int i=0; i<num_runs; ++i)  {
+    unsigned int rndm = 1+random.Integer(num_iov*10);
+    IOV req_iov(iov_typ,rndm);
+    vector<cond::ConditionsIOVPool::Element> pools;
+    TTimeStamp start;
+    iov_pool->select(req_iov, pools);
+    TTimeStamp middle;
+    ConditionsManager::Result res = manager.prepare(req_iov,*slice);
+    TTimeStamp stop;
+    sel_stat.Fill(middle.AsDouble()-start.AsDouble());
+    prep_stat.Fill(stop.AsDouble()-middle.AsDouble());
+    total += res;
+    if ( pools.size() != 1 || res.missing != 0 || res.total() != expected )  {
+      printout(ERROR,"Benchmark","Run %d: %ld pools selected. Incomplete slice for IOV:%s "
+               "(S:%6ld,L:%6ld,C:%6ld,M:%ld) expected %ld conditions.",
+               i, pools.size(), req_iov.str().c_str(), res.selected, res.loaded,
+               res.computed, res.missing, expected);
+      ++num_errors;
+    }
+  }
+  bool success = num_errors == 0;
+  printout(INFO,"Statistics","+======= Summary: # of IOV: %6d  # of Runs: %6d =====================", num_iov, num_runs);
+  printout(INFO,"Statistics","+  %-12s:  %11.5g +- %11.4g  RMS = %11.5g  N = %lld",
+           sel_stat.GetName(), sel_stat.GetMean(), sel_stat.GetMeanErr(), sel_stat.GetRMS(), sel_stat.GetN());
+  printout(INFO,"Statistics","+  %-12s:  %11.5g +- %11.4g  RMS = %11.5g  N = %lld",
+           prep_stat.GetName(), prep_stat.GetMean(), prep_stat.GetMeanErr(), prep_stat.GetRMS(), prep_stat.GetN());
+  printout(INFO,"Statistics","+  Accessed a total of %ld conditions (S:%6ld,L:%6ld,C:%6ld,M:%ld). Created:%ld",
+           total.total(), total.selected, total.loaded, total.computed, total.missing, total_created);
+  printout(INFO,"Statistics","+=========================================================================");
+  printout(success ? ALWAYS : ERROR,"Benchmark","Test %s", success ? "PASSED" : "FAILED");
+  // All done.
+  return 1;
+}
+
+// first argument is the type from the xml file
+DECLARE_APPLY(DD4hep_ConditionExample_benchmark,condition_example)
@@ -0,0 +1,228 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+/*
+   Plugin invocation:
+   ==================
+   This plugin behaves like a main program.
+   Invoke the plugin with something like this:
+
+   geoPluginRun -volmgr -destroy -plugin DD4hep_ConditionExample_computeMT \
+   -input file:${DD4hep_DIR}/examples/AlignDet/compact/Telescope.xml -compute 4
+
+   Populate the conditions store by hand. The conditions of the detector
+   elements are distributed to pools with different, overlapping IOVs.
+   Every detector element gets a derived condition, which depends on the
+   one of its parent: the derived conditions form chains along the
+   hierarchy and their IOVs are intersections of several pools.
+   The same conditions are registered for two IOV types. The derived
+   conditions of the first type are computed sequentially, the ones of the
+   second type with several threads. Values and IOVs must be identical.
+
+*/
+// Framework include files
+#include "ConditionExampleObjects.h"
+#include "DD4hep/Factories.h"
+
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+using namespace dd4hep;
+using namespace dd4hep::ConditionExamples;
+
+namespace {
+
+  /// Derived condition: sum of the own derived_1 value and the chain value of the parent
+  class ConditionUpdateChain : public ConditionUpdateCall, public OutputLevel  {
+  public:
+    /// Initializing constructor
+    ConditionUpdateChain(PrintLevel p) : OutputLevel(p) {    }
+    /// Interface to client Callback in order to update the condition
+    virtual Condition operator()(const ConditionKey& key, ConditionUpdateContext&) override  final  {
+#ifdef DD4HEP_CONDITIONS_DEBUG
+      printout(printLevel,"ConditionUpdateChain","++ Building dependent condition: %016llX  [%s]",key.hash, key.name.c_str());
+      Condition    target(key.name,"derived");
+#else
+      printout(printLevel,"ConditionUpdateChain","++ Building dependent condition: %016llX",key.hash);
+      Condition    target(key.hash);
+#endif
+      target.bind<int>() = 0;
+      return target;
+    }
+    /// Interface to client Callback in order to update the condition
+    virtual void resolve(Condition target, ConditionUpdateContext& context) override  final  {
+      int& data = target.get<int>();
+      data = context.condition(context.key(0)).get<vector<int> >().at(1) + 1;
+      if ( context.dependency->dependencies.size() > 1 )
+        data += context.condition(context.key(1)).get<int>();
+      // Bulk accesses must be possible while resolving: sequentially and in parallel
+      if ( context.resolver->get(context.dependency->detector).empty() )
+        except("ConditionUpdateChain","++ No conditions found for %s",
+               context.dependency->detector.path().c_str());
+    }
+  };
+
+  /// Intersection of two IOV ranges
+  IOV::Key intersection(const IOV::Key& a, const IOV::Key& b)  {
+    return IOV::Key(max(a.first, b.first), min(a.second, b.second));
+  }
+
+  /// Collect all detector elements of the hierarchy
+  void collect(DetElement de, vector<DetElement>& elements)  {
+    elements.emplace_back(de);
+    for( const auto& c : de.children() )
+      collect(c.second, elements);
+  }
+}
+
+/// Plugin function: Condition program example
+/**
+ *  Factory: DD4hep_ConditionExample_computeMT
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \date    01/12/2016
+ */
+static int condition_example (Detector& description, int argc, char** argv)  {
+  string input;
+  int    num_iov = 5, num_compute = 4;
+  bool   arg_error = false;
+  for(int i=0; i<argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-input",argv[i],4) )
+      input = argv[++i];
+    else if ( 0 == ::strncmp("-iovs",argv[i],4) )
+      num_iov = ::atol(argv[++i]);
+    else if ( 0 == ::strncmp("-compute",argv[i],4) )
+      num_compute = ::atol(argv[++i]);
+    else
+      arg_error = true;
+  }
+  if ( arg_error || input.empty() || num_iov < 1 || num_compute < 2 )   {
+    /// Help printout describing the basic command line interface
+    cout <<
+      "Usage: -plugin <name> -arg [-arg]                                             \n"
+      "     name:   factory name     DD4hep_ConditionExample_computeMT               \n"
+      "     -input   <string>        Geometry file                                   \n"
+      "     -iovs    <number>        Number of IOVs to be prepared.                  \n"
+      "     -compute <number>        Number of threads computing derived conditions. \n"
+      "\tArguments given: " << arguments(argc,argv) << endl << flush;
+    ::exit(EINVAL);
+  }
+
+  // First we load the geometry
+  description.fromXML(input);
+
+  /******************** Initialize the conditions manager *****************/
+  ConditionsManager manager = installManager(description);
+  const IOVType* iov_types[2] = { manager.registerIOVType(0,"run").second,
+                                  manager.registerIOVType(1,"epoch").second };
+  if ( 0 == iov_types[0] || 0 == iov_types[1] )
+    except("ConditionsComputeMT","++ Unknown IOV type supplied.");
+
+  /******************** Now as usual: create the slice ********************/
+  vector<DetElement> elements;
+  collect(description.world(), elements);
+  shared_ptr<ConditionsContent> content(new ConditionsContent());
+  shared_ptr<ConditionsSlice>   slices[2] = { make_shared<ConditionsSlice>(manager,content),
+                                              make_shared<ConditionsSlice>(manager,content) };
+  Scanner(ConditionsKeys(*content,INFO),description.world());
+  Scanner(ConditionsDependencyCreator(*content,DEBUG,false,3),description.world());
+  shared_ptr<ConditionUpdateCall> chain_call(new ConditionUpdateChain(DEBUG));
+  vector<Condition::key_type> chain_keys;
+  for( const auto& de : elements )  {
+    ConditionKey      target(de,"derived_data/chain");
+    DependencyBuilder build(de, target.item_key(), chain_call);
+    build.add(ConditionKey(de,"derived_data/derived_1"));
+    if ( de.parent().isValid() )
+      build.add(ConditionKey(de.parent(),"derived_data/chain"));
+    content->addDependency(build.release());
+    chain_keys.emplace_back(target.hash);
+  }
+
+  /******************** Populate the conditions store *********************/
+  // The detector elements are distributed over 3 pools with different IOVs,
+  // which all contain the requested event time i*10+5.
+  for( int i=0; i<num_iov; ++i )  {
+    const IOV::Key ranges[3] = { IOV::Key(1+i*10, 10+i*10),
+                                 IOV::Key(1+i*10,  6+i*10),
+                                 IOV::Key(4+i*10, 10+i*10) };
+    for( const IOVType* typ : iov_types )  {
+      for( size_t j=0; j < elements.size(); ++j )  {
+        ConditionsPool* pool = manager.registerIOV(*typ, ranges[j%3]);
+        ConditionsCreator(*slices[0], *pool, DEBUG)(elements[j], 0);
+      }
+    }
+  }
+
+  // ++++++++++++++++++++++++ Now compute the derived conditions sequentially and in parallel
+  size_t num_errors = 0, num_checked = 0;
+  for( int i=0; i<num_iov; ++i )  {
+    const IOV::Key ranges[3] = { IOV::Key(1+i*10, 10+i*10),
+                                 IOV::Key(1+i*10,  6+i*10),
+                                 IOV::Key(4+i*10, 10+i*10) };
+    ConditionsManager::Result res[2];
+    for( int t=0; t<2; ++t )  {
+      manager["ComputeThreads"] = t == 0 ? 1 : num_compute;
+      res[t] = manager.prepare(IOV(iov_types[t], i*10+5), *slices[t]);
+    }
+    if ( res[0].computed != content->derived().size() || res[1].computed != res[0].computed )  {
+      printout(ERROR,"ComputeMT","IOV %d: Computed %ld conditions sequentially and %ld in parallel. Expected %ld",
+               i, res[0].computed, res[1].computed, content->derived().size());
+      ++num_errors;
+    }
+    // All derived conditions must have identical IOVs
+    for( const auto& d : content->derived() )  {
+      Condition c0 = slices[0]->get(d.first);
+      Condition c1 = slices[1]->get(d.first);
+      if ( !c0.isValid() || !c1.isValid() || c0.iov().keyData != c1.iov().keyData )  {
+        printout(ERROR,"ComputeMT","IOV %d: Derived condition %016llX differs: sequential: %s parallel: %s",
+                 i, d.first, c0.isValid() ? c0.iov().str().c_str() : "----",
+                 c1.isValid() ? c1.iov().str().c_str() : "----");
+        ++num_errors;
+      }
+      ++num_checked;
+    }
+    // The chain conditions must have the intersection of the IOVs of all ancestors
+    for( size_t j=0; j < elements.size(); ++j )  {
+      IOV::Key expected = ranges[j%3];
+      for( DetElement p = elements[j].parent(); p.isValid(); p = p.parent() )  {
+        size_t k = find_if(elements.begin(), elements.end(),
+                           [&p](const DetElement& e) { return e.ptr() == p.ptr(); }) - elements.begin();
+        expected = intersection(expected, ranges[k%3]);
+      }
+      for( int t=0; t<2; ++t )  {
+        Condition c = slices[t]->get(chain_keys[j]);
+        Condition r = slices[0]->get(chain_keys[j]);
+        if ( !c.isValid() || c.iov().keyData != expected || c.get<int>() != r.get<int>() )  {
+          printout(ERROR,"ComputeMT","IOV %d: Chain condition of %s [%s]: IOV %s value %d expected [%ld,%ld] value %d",
+                   i, elements[j].path().c_str(), t == 0 ? "sequential" : "parallel",
+                   c.isValid() ? c.iov().str().c_str() : "----", c.isValid() ? c.get<int>() : 0,
+                   long(expected.first), long(expected.second), r.isValid() ? r.get<int>() : 0);
+          ++num_errors;
+        }
+      }
+    }
+  }
+  bool success = num_errors == 0 && num_checked > 0;
+  printout(INFO,"Statistics",
+           "+======= Summary: # of IOV: %3d  # of compute threads: %3d ================",
+           num_iov, num_compute);
+  printout(INFO,"Statistics","+  Compared %ld derived conditions: %ld errors", num_checked, num_errors);
+  printout(INFO,"Statistics","+=========================================================================");
+  printout(success ? ALWAYS : ERROR,"ComputeMT","Test %s", success ? "PASSED" : "FAILED");
+  // All done.
+  return 1;
+}
+
+// first argument is the type from the xml file
+DECLARE_APPLY(DD4hep_ConditionExample_computeMT,condition_example)
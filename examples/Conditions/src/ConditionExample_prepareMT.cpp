@@ -0,0 +1,193 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+/*
+   Plugin invocation:
+   ==================
+   This plugin behaves like a main program.
+   Invoke the plugin with something like this:
+
+   geoPluginRun -volmgr -destroy -plugin DD4hep_ConditionExample_prepareMT \
+   -input file:${DD4hep_DIR}/examples/AlignDet/compact/Telescope.xml -threads 8
+
+   Populate the conditions store by hand for a set of IOVs.
+   Then prepare conditions slices for all IOVs concurrently from
+   several threads, each thread owning its own slice. None of the
+   derived conditions are computed before: the threads compete for
+   the selection, the computation and the registration.
+   With -compute <number> the derived conditions of each slice are
+   in addition computed by several threads.
+
+*/
+// Framework include files
+#include "ConditionExampleObjects.h"
+#include "DD4hep/Factories.h"
+#include "TTimeStamp.h"
+
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <functional>
+
+using namespace std;
+using namespace dd4hep;
+using namespace dd4hep::ConditionExamples;
+
+namespace {
+
+  /// Shared test bookkeeping
+  struct Bookkeeping  {
+    mutex                     guard;
+    ConditionsManager::Result totals;
+    /// Number of accessed conditions per IOV. Must be identical for all threads
+    vector<long>              accessed;
+    atomic<long>              num_prepared {0};
+    atomic<long>              num_errors   {0};
+  };
+
+  /// Prepare slices for all IOVs in a thread specific order
+  void prepare_slices(ConditionsManager       manager,
+                      const IOVType*          iov_typ,
+                      const ConditionsSlice&  prototype,
+                      Bookkeeping&            book,
+                      int                     identifier,
+                      int                     num_iov,
+                      int                     num_run)
+  {
+    unique_ptr<ConditionsSlice> slice(new ConditionsSlice(prototype));
+    size_t expected = slice->content->conditions().size() + slice->content->derived().size();
+    for( int run = 0; run < num_run; ++run )  {
+      for( int i = 0; i < num_iov; ++i )  {
+        int  which = (i + identifier) % num_iov;
+        IOV  iov(iov_typ, which*10 + 1 + (identifier+run)%10);
+        ConditionsManager::Result res = manager.prepare(iov, *slice);
+        long count = Scanner().scan(ConditionsDataAccess(iov, *slice), manager->detectorDescription().world());
+        ++book.num_prepared;
+        if ( res.missing != 0 || res.total() != expected )  {
+          printout(ERROR,"PrepareMT","Thread:%3d Incomplete slice for IOV:%s "
+                   "(S:%6ld,L:%6ld,C:%6ld,M:%ld) expected %ld conditions.",
+                   identifier, iov.str().c_str(), res.selected, res.loaded,
+                   res.computed, res.missing, expected);
+          ++book.num_errors;
+        }
+        lock_guard<mutex> lock(book.guard);
+        book.totals += res;
+        if ( book.accessed[which] < 0 )  {
+          book.accessed[which] = count;
+        }
+        else if ( book.accessed[which] != count )   {
+          printout(ERROR,"PrepareMT","Thread:%3d Accessed %ld conditions for IOV:%s. Other threads: %ld",
+                   identifier, count, iov.str().c_str(), book.accessed[which]);
+          ++book.num_errors;
+        }
+      }
+    }
+  }
+}
+
+/// Plugin function: Condition program example
+/**
+ *  Factory: DD4hep_ConditionExample_prepareMT
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \date    01/12/2016
+ */
+static int condition_example (Detector& description, int argc, char** argv)  {
+  string input;
+  int    num_iov = 10, num_threads = 4, num_run = 3, num_compute = 1;
+  bool   arg_error = false;
+  for(int i=0; i<argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-input",argv[i],4) )
+      input = argv[++i];
+    else if ( 0 == ::strncmp("-iovs",argv[i],4) )
+      num_iov = ::atol(argv[++i]);
+    else if ( 0 == ::strncmp("-runs",argv[i],4) )
+      num_run = ::atol(argv[++i]);
+    else if ( 0 == ::strncmp("-threads",argv[i],4) )
+      num_threads = ::atol(argv[++i]);
+    else if ( 0 == ::strncmp("-compute",argv[i],4) )
+      num_compute = ::atol(argv[++i]);
+    else
+      arg_error = true;
+  }
+  if ( arg_error || input.empty() || num_iov < 1 || num_threads < 1 )   {
+    /// Help printout describing the basic command line interface
+    cout <<
+      "Usage: -plugin <name> -arg [-arg]                                             \n"
+      "     name:   factory name     DD4hep_ConditionExample_prepareMT               \n"
+      "     -input   <string>        Geometry file                                   \n"
+      "     -iovs    <number>        Number of IOVs to be prepared by each thread.   \n"
+      "     -runs    <number>        Number of passes over all IOVs.                 \n"
+      "     -threads <number>        Number of execution threads.                    \n"
+      "     -compute <number>        Number of threads computing derived conditions. \n"
+      "\tArguments given: " << arguments(argc,argv) << endl << flush;
+    ::exit(EINVAL);
+  }
+
+  // First we load the geometry
+  description.fromXML(input);
+
+  /******************** Initialize the conditions manager *****************/
+  ConditionsManager manager = installManager(description);
+  manager["ComputeThreads"] = num_compute;
+  const IOVType*    iov_typ = manager.registerIOVType(0,"run").second;
+  if ( 0 == iov_typ )
+    except("ConditionsPrepare","++ Unknown IOV type supplied.");
+
+  /******************** Now as usual: create the slice ********************/
+  shared_ptr<ConditionsContent> content(new ConditionsContent());
+  shared_ptr<ConditionsSlice>   slice(new ConditionsSlice(manager,content));
+  Scanner(ConditionsKeys(*content,INFO),description.world());
+  Scanner(ConditionsDependencyCreator(*content,DEBUG),description.world());
+
+  /******************** Populate the conditions store *********************/
+  long total_created = 0;
+  for(int i=0; i<num_iov; ++i)  {
+    IOV iov(iov_typ, IOV::Key(1+i*10,(i+1)*10));
+    ConditionsPool* pool = manager.registerIOV(*iov.iovType, iov.key());
+    total_created += Scanner().scan(ConditionsCreator(*slice, *pool, DEBUG),description.world());
+  }
+
+  // ++++++++++++++++++++++++ Now prepare the slices concurrently
+  Bookkeeping book;
+  book.accessed.resize(num_iov, -1);
+  TTimeStamp start;
+  vector<thread> threads;
+  for(int i=0; i<num_threads; ++i)  {
+    threads.emplace_back(prepare_slices, manager, iov_typ, cref(*slice),
+                         ref(book), i, num_iov, num_run);
+  }
+  for(auto& t : threads) t.join();
+  TTimeStamp stop;
+
+  // Every derived condition must have been computed exactly once per IOV
+  size_t num_derived = content->derived().size();
+  bool   success = book.num_errors == 0 && book.totals.computed == num_iov*num_derived;
+  printout(INFO,"Statistics",
+           "+======= Summary: # of IOV: %3d  # of Threads: %3d/%3d ====================",
+           num_iov, num_threads, num_compute);
+  printout(INFO,"Statistics","+  Created %ld conditions. Prepared %ld slices in %8.3f sec.",
+           total_created, book.num_prepared.load(), stop.AsDouble()-start.AsDouble());
+  printout(INFO,"Statistics","+  Accessed a total of %ld conditions (S:%6ld,L:%6ld,C:%6ld,M:%ld)",
+           book.totals.total(), book.totals.selected, book.totals.loaded,
+           book.totals.computed, book.totals.missing);
+  printout(INFO,"Statistics","+  Derived conditions computed: %ld expected: %ld",
+           book.totals.computed, num_iov*num_derived);
+  printout(INFO,"Statistics","+=========================================================================");
+  printout(success ? ALWAYS : ERROR,"PrepareMT","Test %s", success ? "PASSED" : "FAILED");
+  // All done.
+  return 1;
+}
+
+// first argument is the type from the xml file
+DECLARE_APPLY(DD4hep_ConditionExample_prepareMT,condition_example)
@@ -0,0 +1,52 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import
+
+
+def run():
+  import DigiTest
+  from dd4hep import units
+  digi = DigiTest.Test(geometry=None)
+
+  event = DigiTest.test_setup_1(digi)
+  # Copy the deposits to the structure-of-arrays layout
+  proc = event.adopt_action('DigiContainerSequenceAction/Arrays',
+                            parallel=True,
+                            input_mask=0xEEE5,
+                            input_segment='deposits',
+                            output_mask=0xEEE6,
+                            output_segment='deposits')
+  create = digi.create_action('DigiDepositArraysCreator/ArraysCreator')
+  proc.adopt_container_processor(create, digi.containers())
+  # Apply the same energy cut to the default containers and to the arrays
+  for mask in [0xEEE5, 0xEEE6]:
+    proc = event.adopt_action('DigiContainerSequenceAction/Cut-%04X' % (mask, ),
+                              parallel=True,
+                              input_mask=mask,
+                              input_segment='deposits',
+                              output_mask=mask,
+                              output_segment='deposits')
+    cut = digi.create_action('DigiDepositEnergyCut/EnergyCut-%04X' % (mask, ))
+    cut.deposit_cutoff = 5 * units.keV
+    proc.adopt_container_processor(cut, digi.containers())
+  # The arrays handler must kill the same deposits as the default handler
+  event.adopt_action('DigiTestDepositCompare/Compare',
+                     input_segment='deposits',
+                     reference_mask=0xEEE5,
+                     compare_mask=0xEEE6)
+  event.adopt_action('DigiStoreDump/HeaderDump')
+  # ========================================================================================================
+  digi.info('Starting digitization core')
+  digi.run_checked(num_events=5, num_threads=7, parallel=5)
+
+
+if __name__ == '__main__':
+  run()
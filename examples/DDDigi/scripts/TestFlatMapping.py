@@ -0,0 +1,61 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import
+
+
+def run():
+  import DigiTest
+  from dd4hep import units
+  digi = DigiTest.Test(geometry=None)
+
+  input = digi.input_action('DigiParallelActionSequence/READER')  # noqa: A001
+  input.adopt_action('DigiDDG4ROOT/SignalReader', mask=0xCBAA, input=[digi.next_input()], keep_raw=False)
+  input.adopt_action('DigiDDG4ROOT/Read-1', mask=0xCBEE, input=[digi.next_input()], keep_raw=False)
+  # ========================================================================================================
+  event = digi.event_action('DigiSequentialActionSequence/EventAction')
+  # Combine the same inputs once to deposit vectors (default) and once to flat mappings
+  event.adopt_action('DigiContainerCombine/Combine',
+                     parallel=True,
+                     input_masks=[0xCBAA, 0xCBEE],
+                     output_mask=0xAAA0,
+                     output_segment='deposits',
+                     erase_combined=False)
+  event.adopt_action('DigiContainerCombine/CombineFlat',
+                     parallel=True,
+                     input_masks=[0xCBAA, 0xCBEE],
+                     output_mask=0xAAA1,
+                     output_segment='deposits',
+                     erase_combined=False,
+                     flat_mapping=True)
+  # Apply the same energy cut to both outputs
+  for mask in [0xAAA0, 0xAAA1]:
+    proc = event.adopt_action('DigiContainerSequenceAction/Cut-%04X' % (mask, ),
+                              parallel=True,
+                              input_mask=mask,
+                              input_segment='deposits',
+                              output_mask=mask,
+                              output_segment='deposits')
+    cut = digi.create_action('DigiDepositEnergyCut/EnergyCut-%04X' % (mask, ))
+    cut.deposit_cutoff = 5 * units.keV
+    proc.adopt_container_processor(cut, digi.containers())
+  # The flat mappings must contain the same cells and energy as the deposit vectors
+  event.adopt_action('DigiTestDepositCompare/Compare',
+                     input_segment='deposits',
+                     reference_mask=0xAAA0,
+                     compare_mask=0xAAA1)
+  event.adopt_action('DigiStoreDump/HeaderDump')
+  # ========================================================================================================
+  digi.info('Starting digitization core')
+  digi.run_checked(num_events=5, num_threads=7, parallel=5)
+
+
+if __name__ == '__main__':
+  run()
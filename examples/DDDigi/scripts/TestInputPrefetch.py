@@ -0,0 +1,47 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import
+
+
+def run():
+  import DigiTest
+  digi = DigiTest.Test(geometry=None)
+  source = digi.next_input()
+
+  input = digi.input_action('DigiParallelActionSequence/READER')  # noqa: A001
+  # Default: synchronous reading
+  input.adopt_action('DigiDDG4ROOT/SignalReader',
+                     mask=0xCBAA,
+                     input=[source],
+                     keep_raw=False)
+  # Same input read ahead by a reader thread with TTreeCache and implicit multi-threading
+  input.adopt_action('DigiDDG4ROOT/PrefetchReader',
+                     mask=0xCBAB,
+                     input=[source],
+                     keep_raw=False,
+                     prefetch=3,
+                     cache_size=10 * 1024 * 1024,
+                     implicit_mt=True)
+  # ========================================================================================================
+  event = digi.event_action('DigiSequentialActionSequence/EventAction')
+  event.adopt_action('DigiTestDepositCompare/Compare',
+                     input_segment='inputs',
+                     reference_mask=0xCBAA,
+                     compare_mask=0xCBAB)
+  event.adopt_action('DigiStoreDump/HeaderDump')
+  # ========================================================================================================
+  digi.info('Starting digitization core')
+  # Events are processed one after the other: both readers must see the same entries
+  digi.run_checked(num_events=10, num_threads=7, parallel=1)
+
+
+if __name__ == '__main__':
+  run()
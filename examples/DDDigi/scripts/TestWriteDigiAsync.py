@@ -0,0 +1,83 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import
+
+
+# ---------------------------------------------------------------------------
+def summarize(file_name):
+  """
+      Summarize the content of every event written to a DDDigi ROOT file:
+      per branch the number of entries and for deposits the total energy.
+
+      \author  M.Frank
+      \version 1.0
+  """
+  import ROOT
+  summary = []
+  root_file = ROOT.TFile.Open(file_name)
+  tree = root_file.Get('EVENT')
+  branches = sorted([b.GetName() for b in tree.GetListOfBranches()])
+  for entry in range(tree.GetEntries()):
+    tree.GetEntry(entry)
+    event = []
+    for name in branches:
+      data = getattr(tree, name)
+      energy = 0.0
+      if name != 'MCParticles':
+        energy = sum([d.second.deposit for d in data])
+      event.append((name, data.size(), energy))
+    summary.append(event)
+  root_file.Close()
+  return summary
+
+
+# ---------------------------------------------------------------------------
+def run():
+  import DigiTest
+  digi = DigiTest.Test(geometry=None)
+  digi.input_action('DigiDDG4ROOT/SignalReader', mask=0x0, input=[digi.next_input()])
+  hit_type = 'TrackerHits'
+  if digi.hit_type:
+    hit_type = digi.hit_type
+  cont = [c + '/' + hit_type for c in digi.containers()]
+  # Default: synchronous output. Compare against the output written by the writer thread
+  outputs = {'sync': 0, 'async': 4}
+  for tag, depth in outputs.items():
+    writ = digi.output_action('Digi2ROOTWriter/EventWriter-' + tag,
+                              parallel=True,
+                              input_mask=0x0,
+                              input_segment='input',
+                              output='dddigi_write_digi_' + tag + '.root',
+                              queue_depth=depth)
+    proc = digi.create_action('Digi2ROOTProcessor/Writer-' + tag)
+    writ.adopt_container_processor(proc, cont)
+    writ.adopt_container_processor(proc, 'MCParticles/MCParticles')
+  # Events are processed one after the other: both writers see the events in the same order
+  digi.run_checked(num_events=5, num_threads=10, parallel=1)
+
+  sync = summarize('dddigi_write_digi_sync_00000000.root')
+  async_output = summarize('dddigi_write_digi_async_00000000.root')
+  if len(sync) > 0 and sync == async_output:
+    digi.always('+++ Compared %d events written synchronously and asynchronously. '
+                'Output comparison Test PASSED' % (len(sync), ))
+  else:
+    digi.error('+++ Synchronous output: %d events, asynchronous output: %d events. '
+               'Output comparison Test FAILED' % (len(sync), len(async_output), ))
+    for s, a in zip(sync, async_output):
+      if s != a:
+        digi.error('+++ Synchronous:  ' + str(s))
+        digi.error('+++ Asynchronous: ' + str(a))
+        break
+
+
+# ---------------------------------------------------------------------------
+if __name__ == '__main__':
+  run()
@@ -0,0 +1,139 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+/// Framework include files
+#include <DD4hep/Factories.h>
+#include <DD4hep/Printout.h>
+#include <DDDigi/DigiData.h>
+
+/// C/C++ include files
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cstring>
+#include <iostream>
+
+using namespace dd4hep;
+
+/// Plugin to test concurrent access to the DDDigi data segment
+/**
+ *  Factory: DD4hep_DigiDataSegmentTest
+ *
+ *  Every thread inserts its own items and reads back the items of all
+ *  threads. Items which are not yet inserted are simply not found.
+ *  The segment starts with a small table, which must grow while the
+ *  threads are running. At the end every item must be present exactly
+ *  once and the iteration must visit the items in ascending key order.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ */
+static long test_DigiDataSegment(Detector& , int argc, char** argv) {
+  using namespace dd4hep::digi;
+  int num_threads = 16, num_items = 500;
+  for(int i = 0; i < argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-threads",argv[i],3) && i+1 < argc )
+      num_threads = ::atoi(argv[++i]);
+    else if ( 0 == ::strncmp("-items",argv[i],3) && i+1 < argc )
+      num_items   = ::atoi(argv[++i]);
+    else  {
+      std::cout <<
+        "Usage: -plugin DD4hep_DigiDataSegmentTest -arg [-arg]                    \n"
+        "     -threads  <value>  Number of concurrent threads [default: 16]       \n"
+        "     -items    <value>  Number of items per thread   [default: 500]      \n"
+        "\tArguments given: " << arguments(argc,argv) << std::endl << std::flush;
+      ::exit(EINVAL);
+    }
+  }
+  std::mutex        lock;
+  DataSegment       segment(lock, 3, 16);
+  std::atomic<long> found(0);
+  std::vector<std::thread> threads;
+
+  auto start = std::chrono::high_resolution_clock::now();
+  for(int t = 0; t < num_threads; ++t)  {
+    threads.emplace_back([&segment, &found, t, num_threads, num_items]()  {
+	long cnt = 0;
+	for(int i = 0; i < num_items; ++i)  {
+	  Key key;
+	  key.set_item(t*num_items + i).set_segment(segment.id);
+	  segment.emplace_any(key, std::make_any<long>(key.value()));
+	  for(int j = 0; j < num_threads; ++j)  {
+	    Key k;
+	    k.set_item(j*num_items + i).set_segment(segment.id);
+	    if ( const long* val = segment.pointer<long>(k) )
+	      cnt += (*val == long(k.value())) ? 1 : 0;
+	  }
+	}
+	found += cnt;
+      });
+  }
+  for(auto& t : threads) t.join();
+  auto stop = std::chrono::high_resolution_clock::now();
+
+  const std::size_t num_total = std::size_t(num_threads) * std::size_t(num_items);
+  long missing = 0, wrong = 0;
+  for(std::size_t i = 0; i < num_total; ++i)  {
+    Key key;
+    key.set_item(i).set_segment(segment.id);
+    const long* val = segment.pointer<long>(key);
+    missing += val ? 0 : 1;
+    wrong   += (val && *val != long(key.value())) ? 1 : 0;
+  }
+  /// Iteration: every item once and in ascending key order
+  std::size_t iterated = 0;
+  bool ordered = true;
+  Key::key_type last = 0;
+  for(const auto& e : segment)  {
+    ordered = ordered && (iterated == 0 || e.first.value() > last);
+    last = e.first.value();
+    iterated += e.second.has_value() ? 1 : 0;
+  }
+  /// Duplicate keys must be refused
+  bool duplicate = false;
+  try  {
+    Key key;
+    key.set_item(0).set_segment(segment.id);
+    segment.emplace_any(key, std::make_any<long>(0));
+  }
+  catch(const std::exception&)  {
+    duplicate = true;
+  }
+  /// Erased items disappear from lookups and iterations and may be inserted again
+  Key erased;
+  erased.set_item(num_items).set_segment(segment.id);
+  bool erase_ok = segment.erase(erased) && !segment.pointer<long>(erased) &&
+    segment.size() == num_total - 1 && segment.find(erased) == segment.end();
+  segment.emplace_any(erased, std::make_any<long>(-1));
+  erase_ok = erase_ok && segment.size() == num_total && *segment.pointer<long>(erased) == -1;
+  /// find() positions the iterator at the key: the next entry has the next larger key
+  auto it = segment.find(erased);
+  Key next_key;
+  next_key.set_item(num_items + 1).set_segment(segment.id);
+  bool find_ok = it != segment.end() && it->first == erased && (++it)->first == next_key;
+
+  printout(ALWAYS, "DataSegmentTest", "+++ Segment: %ld items in %ld slots. %ld reads succeeded. %.1f ms",
+           long(segment.size()), long(segment.capacity()), long(found),
+           std::chrono::duration<double, std::milli>(stop-start).count());
+  if ( missing == 0 && wrong == 0 && duplicate && ordered && erase_ok && find_ok &&
+       iterated == segment.size() && segment.size() == num_total && segment.capacity() > 16 )  {
+    printout(ALWAYS, "DataSegmentTest", "+++ Data segment test PASSED");
+    return 1;
+  }
+  printout(ERROR, "DataSegmentTest", "+++ Data segment test FAILED: %ld missing %ld wrong items. "
+           "Ordered:%s Duplicates:%s Erase:%s Find:%s", missing, wrong,
+           yes_no(ordered), yes_no(duplicate), yes_no(erase_ok), yes_no(find_ok));
+  return 0;
+}
+DECLARE_APPLY(DD4hep_DigiDataSegmentTest,test_DigiDataSegment)
@@ -0,0 +1,174 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include <DD4hep/InstanceCount.h>
+#include <DDDigi/DigiData.h>
+#include <DDDigi/DigiContext.h>
+#include <DDDigi/DigiEventAction.h>
+
+/// C/C++ include files
+#include <set>
+#include <cmath>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Digitization part of the AIDA detector description toolkit
+  namespace digi {
+
+    /// Test action comparing the deposit containers of two masks
+    /**
+     *  Every deposit container or particle container of the reference mask
+     *  in the input segment must have a counterpart with the same item key
+     *  at the compare mask. The containers may be of different type,
+     *  e.g. DepositVector and DepositArrays. For deposits the number of
+     *  distinct cells and the total energy of the deposits, which are not
+     *  flagged as KILLED, are compared. For particles the container sizes.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DigiTestDepositCompare : public DigiEventAction {
+    protected:
+      /// Summary of a deposit container
+      struct summary_t  {
+        std::set<CellID> cells   { };
+        double           energy  { 0e0 };
+        std::size_t      entries { 0 };
+        bool             valid   { false };
+      };
+      /// Property: Input data segment name
+      std::string m_input_segment   { "deposits" };
+      /// Property: Mask of the reference containers
+      int         m_reference_mask  { 0 };
+      /// Property: Mask of the containers to be compared
+      int         m_compare_mask    { 0 };
+      /// Property: Relative tolerance of the energy comparison
+      double      m_tolerance       { 1e-9 };
+
+      /// Add deposit to the summary
+      static void add(summary_t& sum, CellID cell, double deposit, uint64_t flag)  {
+        if ( 0 == (flag&EnergyDeposit::KILLED) )  {
+          sum.cells.insert(cell);
+          sum.energy += deposit;
+          ++sum.entries;
+        }
+      }
+      /// Summarize deposit containers with deposit objects
+      template <typename T> static void summarize(summary_t& sum, const T& cont)  {
+        for( const auto& dep : cont )
+          add(sum, dep.first, dep.second.deposit, dep.second.flag);
+        sum.valid = true;
+      }
+      /// Summarize deposit containers with structure-of-arrays layout
+      static void summarize(summary_t& sum, const DepositArrays& cont)  {
+        for( std::size_t i = 0; i < cont.size(); ++i )
+          add(sum, cont.cells[i], cont.deposits[i], cont.flags[i]);
+        sum.valid = true;
+      }
+      /// Summarize any deposit container
+      static summary_t summarize(const std::any& data)  {
+        summary_t sum;
+        if ( const auto* v = std::any_cast<DepositVector>(&data) )
+          summarize(sum, *v);
+        else if ( const auto* m = std::any_cast<DepositMapping>(&data) )
+          summarize(sum, *m);
+        else if ( const auto* f = std::any_cast<DepositFlatMapping>(&data) )
+          summarize(sum, *f);
+        else if ( const auto* a = std::any_cast<DepositArrays>(&data) )
+          summarize(sum, *a);
+        return sum;
+      }
+
+    protected:
+      /// Define standard assignments and constructors
+      DDDIGI_DEFINE_ACTION_CONSTRUCTORS(DigiTestDepositCompare);
+
+    public:
+      /// Standard constructor
+      DigiTestDepositCompare(const DigiKernel& kernel, const std::string& nam)
+        : DigiEventAction(kernel, nam)
+      {
+        declareProperty("input_segment",  m_input_segment);
+        declareProperty("reference_mask", m_reference_mask);
+        declareProperty("compare_mask",   m_compare_mask);
+        declareProperty("tolerance",      m_tolerance);
+        InstanceCount::increment(this);
+      }
+      /// Default destructor
+      virtual ~DigiTestDepositCompare()  {
+        InstanceCount::decrement(this);
+      }
+      /// Main functional callback
+      virtual void execute(DigiContext& context)  const override  {
+        const auto& segment = context.event->get_segment(m_input_segment);
+        const char* evt = context.event->id();
+        std::size_t num_compared = 0, num_errors = 0;
+        for( const auto& entry : segment )  {
+          Key key(entry.first);
+          if ( key.mask() != Key::mask_type(m_reference_mask) )
+            continue;
+          Key other(key);
+          other.set_mask(Key::mask_type(m_compare_mask));
+          const std::any* data = segment.entry(other);
+          if ( const auto* parts = std::any_cast<ParticleMapping>(&entry.second) )  {
+            const auto* cmp = data ? std::any_cast<ParticleMapping>(data) : nullptr;
+            if ( !cmp || cmp->size() != parts->size() )  {
+              error("%s+++ %-32s Particle container mismatch: %ld particles at mask %04X, %ld at mask %04X",
+                    evt, parts->name.c_str(), parts->size(), m_reference_mask,
+                    long(cmp ? cmp->size() : 0), m_compare_mask);
+              ++num_errors;
+            }
+            ++num_compared;
+            continue;
+          }
+          summary_t ref = summarize(entry.second);
+          if ( !ref.valid )
+            continue;
+          summary_t cmp = data ? summarize(*data) : summary_t();
+          double diff = std::abs(ref.energy - cmp.energy);
+          if ( !cmp.valid || ref.cells != cmp.cells ||
+               diff > m_tolerance * std::max(std::abs(ref.energy), 1e0) )  {
+            error("%s+++ %-32s Deposit mismatch: mask %04X: %6ld cells %12.6g energy  mask %04X: %6ld cells %12.6g energy",
+                  evt, Key::key_name(key).c_str(), m_reference_mask, ref.cells.size(), ref.energy,
+                  m_compare_mask, cmp.cells.size(), cmp.energy);
+            ++num_errors;
+          }
+          else  {
+            info("%s+++ %-32s %6ld deposits in %6ld cells with %12.6g energy agree",
+                 evt, Key::key_name(key).c_str(), ref.entries, ref.cells.size(), ref.energy);
+          }
+          ++num_compared;
+        }
+        if ( num_compared == 0 )  {
+          error("%s+++ No containers with mask %04X found in segment %s",
+                evt, m_reference_mask, m_input_segment.c_str());
+        }
+        else if ( num_errors == 0 )  {
+          always("%s+++ Compared %ld containers of mask %04X and %04X. Deposit comparison Test PASSED",
+                 evt, num_compared, m_reference_mask, m_compare_mask);
+        }
+        else  {
+          error("%s+++ %ld of %ld containers of mask %04X and %04X differ. Deposit comparison Test FAILED",
+                evt, num_errors, num_compared, m_reference_mask, m_compare_mask);
+        }
+      }
+    };
+  }    // End namespace digi
+}      // End namespace dd4hep
+
+/// Factory instantiation:
+#include <DDDigi/DigiFactories.h>
+DECLARE_DIGIACTION_NS(dd4hep::digi,DigiTestDepositCompare)
@@ -0,0 +1,66 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+#
+from __future__ import absolute_import, unicode_literals
+import logging
+#
+logging.basicConfig(format='%(levelname)s: %(message)s', level=logging.INFO)
+logger = logging.getLogger(__name__)
+#
+#
+"""
+
+   dd4hep simulation example: benchmark of the Geant4VolumeManager
+   touchable lookup: std::map of placement paths versus hash index
+
+"""
+
+
+def run():
+  import os
+  import DDG4
+  from g4units import GeV
+
+  kernel = DDG4.Kernel()
+  install_dir = os.environ['DD4hepExamplesINSTALL']
+  kernel.loadGeometry(str("file:" + install_dir + "/examples/ClientTests/compact/SiliconBlock.xml"))
+
+  DDG4.importConstants(kernel.detectorDescription(), debug=False)
+  geant4 = DDG4.Geant4(kernel, tracker='Geant4TrackerCombineAction')
+  geant4.printDetectors()
+  # Configure UI
+  geant4.setupUI(typ="tcsh", vis=False, macro=None, ui=False)
+
+  # Configure field
+  geant4.setupTrackingField(prt=True)
+
+  # Configure G4 geometry setup
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorGeometryConstruction/ConstructGeo")
+  # Configure G4 sensitive detectors: populates the volume manager
+  geant4.setupDetectors()
+
+  # Setup particle gun
+  gun = geant4.setupGun("Gun", particle='e-', energy=2 * GeV, multiplicity=1)
+  gun.direction = (0.0, 0.0, 1.0)
+  kernel.NumEvents = 10
+  # Instantiate the benchmark stepping action
+  stepping = DDG4.SteppingAction(kernel, 'TestVolumeManagerLookup/VolMgrLookup')
+  stepping.Repeat = 20
+  kernel.steppingAction().add(stepping)
+
+  # Now build the physics list:
+  geant4.setupPhysics('QGSP_BERT')
+  # Start the engine...
+  geant4.execute()
+
+
+if __name__ == "__main__":
+  run()
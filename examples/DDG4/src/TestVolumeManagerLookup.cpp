@@ -0,0 +1,101 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//==========================================================================
+
+// Framework include files
+#include "DDG4/Geant4SteppingAction.h"
+#include "DDG4/Geant4TouchableHandler.h"
+#include "DDG4/Geant4VolumeManager.h"
+#include "DDG4/Geant4Mapping.h"
+
+#include <G4Step.hh>
+#include <G4VTouchable.hh>
+
+// C/C++ include files
+#include <chrono>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
+  namespace sim {
+
+    /// Micro-benchmark of the touchable to placement lookup of the Geant4VolumeManager
+    /** For every step the placement of the pre-step touchable is resolved
+     *  - by materializing the placement path and searching the ordered map g4Paths
+     *  - by the flat hash index g4PathIndex
+     *  Both lookups must agree. The accumulated timings are printed at the end.
+     *
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class TestVolumeManagerLookup : public Geant4SteppingAction {
+      typedef std::chrono::high_resolution_clock clock_t;
+      /// Property: Number of lookup repetitions per step
+      std::size_t m_repeat   { 10UL };
+      std::size_t m_calls    { 0UL };
+      std::size_t m_found    { 0UL };
+      std::size_t m_mismatch { 0UL };
+      double      m_map_ns   { 0e0 };
+      double      m_hash_ns  { 0e0 };
+
+    public:
+      /// Standard constructor
+      TestVolumeManagerLookup(Geant4Context* context, const std::string& nam)
+	: Geant4SteppingAction(context, nam)
+      {
+        declareProperty("Repeat", m_repeat);
+      }
+      /// Default destructor
+      virtual ~TestVolumeManagerLookup()   {
+        std::size_t num = std::max(m_calls*m_repeat, 1UL);
+	info("+++ Lookups: %ld steps, %ld sensitive, %ld mismatches",
+             m_calls, m_found, m_mismatch);
+	info("+++ std::map   lookup: %9.1f ns/call", m_map_ns/double(num));
+	info("+++ Hash index lookup: %9.1f ns/call", m_hash_ns/double(num));
+        if ( m_mismatch == 0 && m_found > 0 )
+          always("+++ Volume manager lookup test PASSED");
+        else
+          error("+++ Volume manager lookup test FAILED");
+      }
+      /// stepping callback
+      virtual void operator()(const G4Step* step, G4SteppingManager*) {
+        const G4VTouchable* touchable = step->GetPreStepPoint()->GetTouchable();
+        const Geant4GeometryInfo& info = Geant4Mapping::instance().data();
+        const Geant4GeometryInfo::Placement* map_result = nullptr;
+        const Geant4GeometryInfo::PlacementIndex::Entry* hash_result = nullptr;
+        if ( !touchable || touchable->GetHistoryDepth() <= 0 )
+          return;
+
+        auto start = clock_t::now();
+        for( std::size_t i = 0; i < m_repeat; ++i )   {
+          Geant4TouchableHandler handler(touchable);
+          auto iter = info.g4Paths.find(handler.placementPath());
+          map_result = iter == info.g4Paths.end() ? nullptr : &iter->second;
+        }
+        auto middle = clock_t::now();
+        for( std::size_t i = 0; i < m_repeat; ++i )   {
+          hash_result = info.g4PathIndex.find(touchable);
+        }
+        auto stop = clock_t::now();
+
+        m_map_ns  += std::chrono::duration<double, std::nano>(middle - start).count();
+        m_hash_ns += std::chrono::duration<double, std::nano>(stop - middle).count();
+        m_found   += map_result ? 1 : 0;
+        if ( map_result != (hash_result ? hash_result->value : nullptr) )
+          ++m_mismatch;
+	++m_calls;
+      }
+    };
+  }    // End namespace sim
+}      // End namespace dd4hep
+
+#include "DDG4/Factories.h"
+DECLARE_GEANT4ACTION_NS(dd4hep::sim,TestVolumeManagerLookup)